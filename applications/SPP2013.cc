@@ -5,6 +5,7 @@
 #include <gCP/postprocessing.h>
 #include <gCP/run_time_parameters.h>
 
+#include <deal.II/distributed/grid_refinement.h>
 #include <deal.II/distributed/solution_transfer.h>
 
 #include <deal.II/dofs/dof_tools.h>
@@ -412,6 +413,8 @@ private:
 
   const double                                      string_width;
 
+  const std::string                                 checkpoint_filepath;
+
   const unsigned int                                x_lower_boundary_id = 0;
 
   const unsigned int                                x_upper_boundary_id = 1;
@@ -440,6 +443,8 @@ private:
 
   void postprocessing();
 
+  void refine_mesh();
+
   void checkpoint();
 
   void triangulation_output();
@@ -501,9 +506,14 @@ string_width(
   (parameters.temporal_discretization_parameters.end_time -
    parameters.temporal_discretization_parameters.start_time) /
   parameters.temporal_discretization_parameters.time_step_size)) +
-  "Step ").size())
+  "Step ").size()),
+checkpoint_filepath(
+  parameters.graphical_output_directory + "checkpoints/checkpoint")
 {
-  if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+  // The output and the checkpoints of a previous run are kept when
+  // restarting from its checkpoint
+  if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0 &&
+      !parameters.flag_restart_from_checkpoint)
   {
     if (fs::exists(parameters.graphical_output_directory + "paraview/"))
     {
@@ -591,7 +601,12 @@ void SemicoupledProblem<dim>::make_grid()
           }
         }
 
-  this->triangulation.refine_global(parameters.n_global_refinements);
+  // The refinement of the coarse mesh is restored from the checkpoint
+  if (parameters.flag_restart_from_checkpoint)
+    triangulation.load(
+      Utilities::get_latest_checkpoint_prefix(checkpoint_filepath));
+  else
+    this->triangulation.refine_global(parameters.n_global_refinements);
 
   // Terminal output
   *pcout << "Triangulation:"
@@ -975,17 +990,78 @@ void SemicoupledProblem<dim>::postprocessing()
 
 
 
+template<int dim>
+void SemicoupledProblem<dim>::refine_mesh()
+{
+  dealii::TimerOutput::Scope  t(*timer_output, "Problem: Mesh refinement");
+
+  // Flag the cells by the error indicator of the slips
+  dealii::Vector<float> estimated_error_per_cell;
+
+  gCP_solver.estimate_error(estimated_error_per_cell);
+
+  dealii::parallel::distributed::GridRefinement::
+    refine_and_coarsen_fixed_number(triangulation,
+                                    estimated_error_per_cell,
+                                    parameters.refinement_fraction,
+                                    parameters.coarsening_fraction);
+
+  // The globally refined grid is not coarsened
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned() &&
+        cell->level() <= static_cast<int>(
+          parameters.n_global_refinements))
+      cell->clear_coarsen_flag();
+
+  // Attach the solution vectors and the quadrature point history and
+  // execute the coarsening and refinement. The refinement level is
+  // capped while the flags are matched at the grain boundaries, as the
+  // mesh smoothing and the matching may flag further cells
+  gCP_solver.prepare_for_coarsening_and_refinement(
+    triangulation,
+    parameters.n_global_refinements +
+      parameters.n_max_adaptive_refinements);
+
+  triangulation.execute_coarsening_and_refinement();
+
+  // Set up the degrees of freedom, constraints and vectors anew. The
+  // children inherit the material id of their parent
+  fe_field->update_ghost_material_ids();
+
+  for (const auto &cell :
+       fe_field->get_dof_handler().active_cell_iterators())
+    if (cell->is_locally_owned())
+      cell->set_active_fe_index(cell->material_id());
+
+  fe_field->setup_dofs();
+
+  setup_constraints();
+
+  fe_field->setup_vectors();
+
+  gCP_solver.init();
+
+  gCP_solver.interpolate_after_coarsening_and_refinement();
+
+  // Terminal output
+  *pcout << "Mesh refinement:"
+         << std::endl
+         << " Number of active cells       = "
+         << triangulation.n_global_active_cells()
+         << std::endl
+         << " Number of degrees of freedom = "
+         << fe_field->n_dofs()
+         << std::endl << std::endl;
+}
+
+
+
 template<int dim>
 void SemicoupledProblem<dim>::checkpoint()
 {
   dealii::TimerOutput::Scope  t(*timer_output, "Problem: Checkpoint");
-  /*
-  dealii::parallel::distributed::SolutionTransfer<dim, dealii::Vector<double>>
-    solution_transfer(dg_dof_handler);
-
-  solution_transfer.prepare_for_serialization(solution);
 
-  triangulation.save("file"); */
+  gCP_solver.save_checkpoint(checkpoint_filepath);
 }
 
 
@@ -1143,8 +1219,27 @@ void SemicoupledProblem<dim>::run()
   discrete_time.set_desired_next_step_size(
     parameters.temporal_discretization_parameters.time_step_size_in_preloading_phase);
 
+  // Restore the solution vectors, the quadrature point history and the
+  // temporal discretization
+  if (parameters.flag_restart_from_checkpoint)
+  {
+    gCP_solver.load_checkpoint(checkpoint_filepath);
+
+    Utilities::load_discrete_time(discrete_time,
+                                  Utilities::get_latest_checkpoint_prefix(
+                                    checkpoint_filepath) + ".time");
+
+    *pcout << "Restarted from the checkpoint at t = "
+           << discrete_time.get_current_time()
+           << std::endl << std::endl;
+  }
+
+  // Wall-clock time elapsed since the last checkpoint
+  dealii::Timer checkpoint_timer;
+
   std::ofstream macroscopic_damage_file;
 
+  if (!parameters.flag_restart_from_checkpoint)
   { // Clear file's contents
     macroscopic_damage_file.open(
       parameters.graphical_output_directory + "macroscopic_damage.txt",
@@ -1245,6 +1340,38 @@ void SemicoupledProblem<dim>::run()
           discrete_time.get_end_time())
       data_output();
 
+    // Adapt the mesh to the current solution
+    if (parameters.refinement_frequency > 0 &&
+        discrete_time.get_step_number() %
+          parameters.refinement_frequency == 0 &&
+        discrete_time.get_current_time() < discrete_time.get_end_time())
+      refine_mesh();
+
+    // Store a checkpoint every n-th step or once the wall-clock interval
+    // elapsed. The elapsed time is synchronized to reach the same
+    // decision in all processes
+    if (parameters.flag_store_checkpoint &&
+        discrete_time.get_current_time() < discrete_time.get_end_time())
+    {
+      const bool flag_checkpoint_step =
+        parameters.checkpoint_frequency > 0 &&
+        discrete_time.get_step_number() %
+          parameters.checkpoint_frequency == 0;
+
+      const bool flag_checkpoint_wall_time =
+        parameters.checkpoint_wall_time_interval > 0.0 &&
+        dealii::Utilities::MPI::max(checkpoint_timer.wall_time(),
+                                    MPI_COMM_WORLD) >=
+          parameters.checkpoint_wall_time_interval;
+
+      if (flag_checkpoint_step || flag_checkpoint_wall_time)
+      {
+        checkpoint();
+
+        checkpoint_timer.restart();
+      }
+    }
+
     // Print macroscopic damage to file
     if (parameters.flag_output_damage_variable ||
         discrete_time.get_current_time() ==
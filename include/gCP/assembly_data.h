@@ -1,7 +1,12 @@
 #ifndef INCLUDE_ASSEMBLY_DATA_H_
 #define INCLUDE_ASSEMBLY_DATA_H_
 
+#include <gCP/quadrature_point_history.h>
+#include <gCP/tensor_product_kernels.h>
+
+#include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/quadrature.h>
+#include <deal.II/base/vectorization.h>
 
 #include <deal.II/fe/fe.h>
 #include <deal.II/fe/fe_values.h>
@@ -48,6 +53,80 @@ struct ScratchBase
 
 
 
+/*!
+ * @brief Copy data of the cells of a
+ * GradientCrystalPlasticitySolver::CellBatch
+ */
+template <typename Copy>
+struct CellBatchCopy
+{
+  CellBatchCopy(const Copy &copy);
+
+  /*!
+   * @brief The copy data of each cell of the batch, indexed by its lane
+   */
+  std::vector<Copy> cell_copies;
+
+  /*!
+   * @brief The number of cells of the batch, i.e., the number of
+   * entries of @ref cell_copies in use
+   */
+  unsigned int      n_cells;
+};
+
+
+
+/*!
+ * @brief Buffers of the sum-factorized kernels applied to a
+ * GradientCrystalPlasticitySolver::CellBatch, see
+ * GradientCrystalPlasticitySolver::evaluate_batch_component
+ *
+ * @details The per component buffers are indexed by the component, as
+ * numbered in GradientCrystalPlasticitySolver::lexicographic_local_dofs,
+ * and by the quadrature point. Each lane holds the values of one cell.
+ */
+template <int dim>
+struct SumFactorizationScratch
+{
+  using VectorizedArrayType = dealii::VectorizedArray<double>;
+
+  SumFactorizationScratch(const unsigned int n_q_points,
+                          const unsigned int n_components);
+
+  typename TensorProductKernels<dim, VectorizedArrayType>::Workspace
+                                                  tensor_product_workspace;
+
+  /*!
+   * @brief The local degrees of freedom values of each cell of the
+   * batch, indexed by its lane
+   */
+  std::vector<dealii::Vector<double>>             batch_local_dof_values;
+
+  dealii::AlignedVector<VectorizedArrayType>      lexicographic_dof_values;
+
+  std::vector<dealii::AlignedVector<VectorizedArrayType>>
+                                                  component_values;
+
+  std::vector<dealii::AlignedVector<
+    dealii::Tensor<1,dim,VectorizedArrayType>>>   component_reference_gradients;
+
+  /*!
+   * @brief The fluxes tested with the shape functions. They include
+   * the JxW values
+   */
+  std::vector<dealii::AlignedVector<VectorizedArrayType>>
+                                                  component_value_fluxes;
+
+  /*!
+   * @brief The fluxes tested with the gradients of the shape functions
+   * pulled back to the reference cell. They include the JxW values
+   */
+  std::vector<dealii::AlignedVector<
+    dealii::Tensor<1,dim,VectorizedArrayType>>>   component_reference_gradient_fluxes;
+};
+
+
+
 namespace Jacobian
 {
 
@@ -87,10 +166,6 @@ struct Scratch : ScratchBase<dim>
 
   Scratch(const Scratch<dim>  &data);
 
-  using GrainInteractionModuli =
-    typename std::pair<std::vector<dealii::FullMatrix<double>>,
-                       std::vector<dealii::FullMatrix<double>>>;
-
   dealii::hp::FEValues<dim>                       hp_fe_values;
 
   dealii::hp::FEFaceValues<dim>                   hp_fe_face_values;
@@ -111,21 +186,19 @@ struct Scratch : ScratchBase<dim>
 
   dealii::SymmetricTensor<4,dim>                  stiffness_tetrad;
 
-  std::vector<dealii::SymmetricTensor<2,dim>>     symmetrized_schmid_tensors;
-
   std::vector<std::vector<double>>                slip_values;
 
   std::vector<std::vector<dealii::Tensor<1,dim>>> slip_gradient_values;
 
   std::vector<std::vector<double>>                old_slip_values;
 
+  std::vector<double>                             slip_resistance_values;
+
   std::vector<std::vector<dealii::SymmetricTensor<2,dim>>>
                                                   vectorial_microstress_law_jacobian_values;
 
   std::vector<dealii::FullMatrix<double>>         scalar_microstress_law_jacobian_values;
 
-  GrainInteractionModuli                          grain_interaction_moduli;
-
   std::vector<dealii::FullMatrix<double>>         intra_gateaux_derivative_values;
 
   std::vector<dealii::FullMatrix<double>>         inter_gateaux_derivative_values;
@@ -140,12 +213,20 @@ struct Scratch : ScratchBase<dim>
 
   std::vector<double>                             damage_variable_values;
 
+  std::vector<dealii::Tensor<1,dim>>              opening_displacement_values;
+
+  std::vector<double>                             max_effective_opening_displacement_values;
+
+  std::vector<double>                             old_effective_opening_displacement_values;
+
   std::vector<dealii::SymmetricTensor<2,dim>>     cohesive_law_jacobian_values;
 
   std::vector<dealii::SymmetricTensor<2,dim>>     contact_law_jacobian_values;
 
   std::vector<dealii::SymmetricTensor<2,dim>>     sym_grad_vector_phi;
 
+  std::vector<dealii::SymmetricTensor<2,dim>>     stiffness_sym_grad_vector_phi;
+
   std::vector<std::vector<double>>                scalar_phi;
 
   std::vector<std::vector<dealii::Tensor<1,dim>>> grad_scalar_phi;
@@ -157,6 +238,8 @@ struct Scratch : ScratchBase<dim>
   std::vector<std::vector<double>>                face_scalar_phi;
 
   std::vector<std::vector<double>>                neighbour_face_scalar_phi;
+
+  dealii::Vector<double>                          local_dof_values;
 };
 
 
@@ -165,6 +248,92 @@ struct Scratch : ScratchBase<dim>
 
 
 
+namespace JacobianAction
+{
+
+
+
+struct Copy : CopyBase
+{
+  Copy(const unsigned int dofs_per_cell);
+
+  dealii::Vector<double>  local_dst_values;
+};
+
+
+
+/*!
+ * @brief Scratch of the matrix-free application of the Jacobian
+ *
+ * @details The bulk integrals are evaluated with the sum-factorized
+ * kernels for a whole cell batch at once, i.e., @ref hp_fe_values only
+ * provides the JxW values and the inverse Jacobians of the mapping of
+ * the cell at hand. The integrals over the grain boundaries are
+ * evaluated with @ref hp_fe_face_values and
+ * @ref neighbour_hp_fe_face_values.
+ */
+template <int dim>
+struct Scratch : ScratchBase<dim>, SumFactorizationScratch<dim>
+{
+  Scratch(const dealii::hp::MappingCollection<dim>  &mapping_collection,
+          const dealii::hp::QCollection<dim>        &quadrature_collection,
+          const dealii::hp::QCollection<dim-1>      &face_quadrature_collection,
+          const dealii::hp::FECollection<dim>       &finite_element,
+          const dealii::UpdateFlags                 update_flags,
+          const dealii::UpdateFlags                 face_update_flags,
+          const unsigned int                        n_slips);
+
+  Scratch(const Scratch<dim>  &data);
+
+  dealii::hp::FEValues<dim>                       hp_fe_values;
+
+  dealii::hp::FEFaceValues<dim>                   hp_fe_face_values;
+
+  dealii::hp::FEFaceValues<dim>                   neighbour_hp_fe_face_values;
+
+  const unsigned int                              n_face_q_points;
+
+  const unsigned int                              n_slips;
+
+  std::vector<double>                             JxW_values;
+
+  std::vector<double>                             face_JxW_values;
+
+  dealii::Vector<double>                          neighbour_local_dof_values;
+
+  std::vector<std::vector<dealii::Tensor<1,dim>>> displacement_gradient_values;
+
+  std::vector<dealii::SymmetricTensor<2,dim>>     strain_tensor_values;
+
+  std::vector<dealii::SymmetricTensor<2,dim>>     stress_tensor_values;
+
+  std::vector<std::vector<double>>                slip_values;
+
+  std::vector<std::vector<dealii::Tensor<1,dim>>> slip_gradient_values;
+
+  std::vector<double>                             value_flux_values;
+
+  std::vector<dealii::Tensor<1,dim>>              gradient_flux_values;
+
+  std::vector<dealii::Tensor<1,dim>>              face_displacement_values;
+
+  std::vector<dealii::Tensor<1,dim>>              neighbour_face_displacement_values;
+
+  std::vector<dealii::Tensor<1,dim>>              face_traction_values;
+
+  std::vector<std::vector<double>>                face_slip_values;
+
+  std::vector<std::vector<double>>                neighbour_face_slip_values;
+
+  std::vector<std::vector<double>>                face_microtraction_values;
+};
+
+
+
+} // namespace JacobianAction
+
+
+
 namespace Residual
 {
 
@@ -176,13 +345,19 @@ struct Copy : CopyBase
 
   dealii::Vector<double>      local_rhs;
 
+  /*!
+   * @brief The contributions to @ref local_rhs which are not affine in
+   * the solution
+   */
+  dealii::Vector<double>      local_nonlinear_rhs;
+
   dealii::FullMatrix<double>  local_matrix_for_inhomogeneous_bcs;
 };
 
 
 
 template <int dim>
-struct Scratch : ScratchBase<dim>
+struct Scratch : ScratchBase<dim>, SumFactorizationScratch<dim>
 {
   Scratch(const dealii::hp::MappingCollection<dim>  &mapping_collection,
           const dealii::hp::QCollection<dim>        &quadrature_collection,
@@ -194,10 +369,6 @@ struct Scratch : ScratchBase<dim>
 
   Scratch(const Scratch<dim>  &data);
 
-  using GrainInteractionModuli =
-    typename std::pair<std::vector<dealii::FullMatrix<double>>,
-                       std::vector<dealii::FullMatrix<double>>>;
-
   dealii::hp::FEValues<dim>                       hp_fe_values;
 
   dealii::hp::FEFaceValues<dim>                   hp_fe_face_values;
@@ -224,8 +395,6 @@ struct Scratch : ScratchBase<dim>
 
   std::vector<std::vector<dealii::Tensor<1,dim>>> slip_gradient_values;
 
-  GrainInteractionModuli                          grain_interaction_moduli;
-
   std::vector<std::vector<dealii::Tensor<1,dim>>> vectorial_microstress_values;
 
   std::vector<std::vector<double>>                resolved_stress_values;
@@ -234,6 +403,8 @@ struct Scratch : ScratchBase<dim>
 
   std::vector<std::vector<double>>                old_slip_values;
 
+  std::vector<double>                             slip_resistance_values;
+
   std::vector<std::vector<double>>                scalar_microstress_values;
 
   std::vector<std::vector<double>>                microscopic_traction_values;
@@ -250,6 +421,10 @@ struct Scratch : ScratchBase<dim>
 
   std::vector<dealii::Tensor<1,dim>>              neighbor_cell_old_displacement_values;
 
+  std::vector<dealii::Tensor<1,dim>>              opening_displacement_values;
+
+  std::vector<double>                             max_effective_opening_displacement_values;
+
   std::vector<dealii::Tensor<1,dim>>              cohesive_traction_values;
 
   std::vector<dealii::Tensor<1,dim>>              contact_traction_values;
@@ -260,6 +435,15 @@ struct Scratch : ScratchBase<dim>
 
   std::vector<std::vector<double>>                neighbour_face_slip_values;
 
+  /*!
+   * @brief The interface quadrature point history of the grain
+   * boundary faces of the cell, indexed by the position of the face
+   * among the ones of the cell and by the face quadrature point. Only
+   * used if the history is updated during the assembly
+   */
+  std::vector<std::vector<InterfaceQuadraturePointHistory<dim>>>
+                                                  interface_quadrature_point_history;
+
   std::vector<dealii::Tensor<1,dim>>              vector_phi;
 
   std::vector<dealii::Tensor<1,dim>>              face_vector_phi;
@@ -271,6 +455,42 @@ struct Scratch : ScratchBase<dim>
   std::vector<std::vector<double>>                face_scalar_phi;
 
   std::vector<std::vector<dealii::Tensor<1,dim>>> grad_scalar_phi;
+
+  dealii::Vector<double>                          local_dof_values;
+
+  /*!
+   * @brief Flag indicating if the bulk integrals are evaluated with
+   * the sum-factorized kernels, i.e., cell batch by cell batch.
+   * @ref hp_fe_values then only provides the mapping data, i.e., the
+   * JxW values, the inverse Jacobians and the quadrature points.
+   */
+  bool                                            flag_sum_factorization;
+
+  std::vector<std::vector<dealii::Tensor<1,dim>>> displacement_gradient_values;
+
+  std::vector<double>                             value_flux_values;
+
+  std::vector<dealii::Tensor<1,dim>>              gradient_flux_values;
+
+  /*!
+   * @brief The slips of the old solution of the cell batch, indexed by
+   * the slip and the quadrature point
+   */
+  std::vector<dealii::AlignedVector<dealii::VectorizedArray<double>>>
+                                                  batch_old_slip_values;
+
+  /*!
+   * @brief Counterparts of @ref component_value_fluxes and
+   * @ref component_reference_gradient_fluxes of the slips for the
+   * contributions which are not affine in the solution, indexed by the
+   * slip and the quadrature point
+   */
+  std::vector<dealii::AlignedVector<dealii::VectorizedArray<double>>>
+                                                  nonlinear_value_fluxes;
+
+  std::vector<dealii::AlignedVector<
+    dealii::Tensor<1,dim,dealii::VectorizedArray<double>>>>
+                                                  nonlinear_reference_gradient_fluxes;
 };
 
 
@@ -339,7 +559,13 @@ struct Scratch : ScratchBase<dim>
 
   std::vector<dealii::Tensor<1,dim>>  neighbor_cell_old_displacement_values;
 
+  std::vector<dealii::Tensor<1,dim>>  opening_displacement_values;
+
+  std::vector<double>                 max_effective_opening_displacement_values;
+
   std::vector<dealii::Tensor<1,dim>>  cohesive_traction_values;
+
+  dealii::Vector<double>              local_dof_values;
 };
 
 
@@ -349,6 +575,55 @@ struct Scratch : ScratchBase<dim>
 
 
 
+namespace LinearSystem
+{
+
+
+
+struct Copy
+{
+  Copy(const unsigned int dofs_per_cell);
+
+  Jacobian::Copy  jacobian_copy;
+
+  Residual::Copy  residual_copy;
+};
+
+
+
+/*!
+ * @brief Scratch of the fused assembly of the residual and the
+ * Jacobian.
+ *
+ * @details Only the hp::FEValues instance of @ref residual_scratch is
+ * reinitialized. The values at the quadrature points shared by both
+ * local operations are evaluated once and copied into
+ * @ref jacobian_scratch.
+ */
+template <int dim>
+struct Scratch
+{
+  Scratch(const dealii::hp::MappingCollection<dim>  &mapping_collection,
+          const dealii::hp::QCollection<dim>        &quadrature_collection,
+          const dealii::hp::QCollection<dim-1>      &face_quadrature_collection,
+          const dealii::hp::FECollection<dim>       &finite_element_collection,
+          const dealii::UpdateFlags                 update_flags,
+          const dealii::UpdateFlags                 face_update_flags,
+          const unsigned int                        n_slips);
+
+  Scratch(const Scratch<dim>  &data);
+
+  Jacobian::Scratch<dim>  jacobian_scratch;
+
+  Residual::Scratch<dim>  residual_scratch;
+};
+
+
+
+} // namespace LinearSystem
+
+
+
 
 namespace Postprocessing
 {
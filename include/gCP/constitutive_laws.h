@@ -5,7 +5,9 @@
 #include <gCP/quadrature_point_history.h>
 #include <gCP/run_time_parameters.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/table.h>
 
 #include <deal.II/fe/fe_values.h>
 
@@ -32,12 +34,12 @@ public:
     const unsigned int                      crystal_id,
     const unsigned int                      q_point,
     const dealii::SymmetricTensor<2,dim>    strain_tensor_value,
-    const std::vector<std::vector<double>>  slip_values) const;
+    const std::vector<std::vector<double>>  &slip_values) const;
 
   const dealii::SymmetricTensor<2,dim> get_plastic_strain_tensor(
     const unsigned int                      crystal_id,
     const unsigned int                      q_point,
-    const std::vector<std::vector<double>>  slip_values) const;
+    const std::vector<std::vector<double>>  &slip_values) const;
 
 private:
   std::shared_ptr<const CrystalsData<dim>>    crystals_data;
@@ -81,6 +83,31 @@ public:
     const unsigned int                    crystal_id,
     const dealii::SymmetricTensor<2,dim>  strain_tensor_values) const;
 
+  /*!
+   * @brief Returns the contractions \f$ \bs{C} : \bs{P}_\alpha \f$ of
+   * the stiffness tetrad with the symmetrized Schmid tensors of the
+   * crystal @p crystal_id.
+   */
+  const std::vector<dealii::SymmetricTensor<2,dim>>
+    &get_stiffness_schmid_contractions(const unsigned int crystal_id) const;
+
+  /*!
+   * @brief Returns the contractions \f$ \bs{P}_\alpha : \bs{C} \f$ of
+   * the symmetrized Schmid tensors with the stiffness tetrad of the
+   * crystal @p crystal_id.
+   */
+  const std::vector<dealii::SymmetricTensor<2,dim>>
+    &get_schmid_stiffness_contractions(const unsigned int crystal_id) const;
+
+  /*!
+   * @brief Returns the matrix with the entries
+   * \f$ \bs{P}_\alpha : \bs{C} : \bs{P}_\beta \f$ of the crystal
+   * @p crystal_id.
+   */
+  const dealii::FullMatrix<double>
+    &get_schmid_stiffness_schmid_contractions(
+      const unsigned int crystal_id) const;
+
 private:
   enum class Crystallite
   {
@@ -106,8 +133,41 @@ private:
 
   std::vector<dealii::SymmetricTensor<4,3>>   stiffness_tetrads_3d;
 
+  /*!
+   * @brief The contractions \f$ \bs{C} : \bs{P}_\alpha \f$ per crystal
+   * and slip system. Only computed in the polycrystalline case.
+   */
+  std::vector<std::vector<dealii::SymmetricTensor<2,dim>>>
+                                              stiffness_schmid_contractions;
+
+  /*!
+   * @brief The contractions \f$ \bs{P}_\alpha : \bs{C} \f$ per crystal
+   * and slip system. Only computed in the polycrystalline case.
+   */
+  std::vector<std::vector<dealii::SymmetricTensor<2,dim>>>
+                                              schmid_stiffness_contractions;
+
+  /*!
+   * @brief The matrices \f$ \bs{P}_\alpha : \bs{C} : \bs{P}_\beta \f$
+   * per crystal. Only computed in the polycrystalline case.
+   */
+  std::vector<dealii::FullMatrix<double>>     schmid_stiffness_schmid_contractions;
 
   bool                                        flag_init_was_called;
+
+  /*!
+   * @brief Returns the stiffness tetrad @p stiffness_tetrad rotated by
+   * @p rotation_tensor
+   *
+   * @details The rotation is computed in Voigt notation as
+   * \f$ \bs{M} \bs{C} \bs{M}^T \f$, where \f$ \bs{M} \f$ is the Bond
+   * matrix of the rotation, instead of contracting the tetrad with
+   * four rotation tensors.
+   */
+  template <int spacedim>
+  static dealii::SymmetricTensor<4,spacedim> get_rotated_stiffness_tetrad(
+    const dealii::SymmetricTensor<4,spacedim> &stiffness_tetrad,
+    const dealii::Tensor<2,spacedim>          &rotation_tensor);
 };
 
 
@@ -195,6 +255,75 @@ inline const dealii::SymmetricTensor<4,3>
 }
 
 
+
+template <int dim>
+inline const std::vector<dealii::SymmetricTensor<2,dim>>
+&HookeLaw<dim>::get_stiffness_schmid_contractions(
+  const unsigned int crystal_id) const
+{
+  AssertThrow(crystallite == Crystallite::Polycrystalline,
+              dealii::ExcMessage("This method is meant for the"
+                                 " case of a polycrystalline."
+                                 " Nonetheless no CrystalsData<dim>'s"
+                                 " shared pointer was passed on to the"
+                                 " constructor"));
+
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The HookeLaw<dim> instance has not"
+                                 " been initialized."));
+
+  AssertIndexRange(crystal_id, crystals_data->get_n_crystals());
+
+  return (stiffness_schmid_contractions[crystal_id]);
+}
+
+
+
+template <int dim>
+inline const std::vector<dealii::SymmetricTensor<2,dim>>
+&HookeLaw<dim>::get_schmid_stiffness_contractions(
+  const unsigned int crystal_id) const
+{
+  AssertThrow(crystallite == Crystallite::Polycrystalline,
+              dealii::ExcMessage("This method is meant for the"
+                                 " case of a polycrystalline."
+                                 " Nonetheless no CrystalsData<dim>'s"
+                                 " shared pointer was passed on to the"
+                                 " constructor"));
+
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The HookeLaw<dim> instance has not"
+                                 " been initialized."));
+
+  AssertIndexRange(crystal_id, crystals_data->get_n_crystals());
+
+  return (schmid_stiffness_contractions[crystal_id]);
+}
+
+
+
+template <int dim>
+inline const dealii::FullMatrix<double>
+&HookeLaw<dim>::get_schmid_stiffness_schmid_contractions(
+  const unsigned int crystal_id) const
+{
+  AssertThrow(crystallite == Crystallite::Polycrystalline,
+              dealii::ExcMessage("This method is meant for the"
+                                 " case of a polycrystalline."
+                                 " Nonetheless no CrystalsData<dim>'s"
+                                 " shared pointer was passed on to the"
+                                 " constructor"));
+
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The HookeLaw<dim> instance has not"
+                                 " been initialized."));
+
+  AssertIndexRange(crystal_id, crystals_data->get_n_crystals());
+
+  return (schmid_stiffness_schmid_contractions[crystal_id]);
+}
+
+
 template<int dim>
 class ResolvedShearStressLaw
 {
@@ -249,12 +378,69 @@ public:
     const double slip_resistance,
     const double time_step_size);
 
-  dealii::FullMatrix<double> get_jacobian(
+  /*!
+   * @brief Computes the scalar microstresses of all slip systems at all
+   * quadrature points of a cell at once
+   *
+   * @details The regularization function is evaluated slip by slip
+   * over contiguous arrays of quadrature points with the selection of
+   * the function hoisted out of the loops.
+   *
+   * @param slip_values The slip values at t^{n}, indexed by slip and
+   * quadrature point
+   * @param old_slip_values The slip values at t^{n-1}
+   * @param slip_resistances The slip resistances of the cell, indexed
+   * by quadrature point and slip. See
+   * @ref QuadraturePointHistoryStorage::get_slip_resistances
+   * @param time_step_size The time step size
+   * @param scalar_microstresses The scalar microstresses, indexed as
+   * @p slip_values. Only its first slip_values[0].size() entries per
+   * slip are overwritten.
+   */
+  void get_scalar_microstresses(
+    const std::vector<std::vector<double>>  &slip_values,
+    const std::vector<std::vector<double>>  &old_slip_values,
+    const dealii::ArrayView<const double>   slip_resistances,
+    const double                            time_step_size,
+    std::vector<std::vector<double>>        &scalar_microstresses) const;
+
+  /*!
+   * @brief Computes the Jacobian of the scalar microstresses w.r.t.
+   * the slips at a quadrature point into @p jacobian
+   *
+   * @details The hardening matrix is the sum of a rank-one matrix and
+   * a diagonal one. The Jacobian thus reads
+   *
+   * \f[
+   *    J_{\alpha\beta} = h q f_\alpha f_\beta +
+   *      \delta_{\alpha\beta} \left( h (1 - q) f_\alpha^2 +
+   *      \frac{g_0 + g_\alpha}{\Delta t} f'_\alpha \right)
+   * \f]
+   *
+   * where \f$ f_\alpha \f$ and \f$ f'_\alpha \f$ are the
+   * regularization function and its derivative evaluated at the slip
+   * rate of the slip system \f$ \alpha \f$. They are evaluated once
+   * per slip system. No memory is allocated. The common numbers of
+   * slip systems are dispatched to specializations sized at compile
+   * time, see @ref Utilities::dispatch_n_slips.
+   *
+   * @param q_point The quadrature point
+   * @param slip_values The slip values at t^{n}, indexed by slip and
+   * quadrature point
+   * @param old_slip_values The slip values at t^{n-1}
+   * @param slip_resistances The slip resistances at the quadrature
+   * point
+   * @param time_step_size The time step size
+   * @param jacobian The Jacobian. It has to be of size n_slips x
+   * n_slips
+   */
+  void get_jacobian(
     const unsigned int                      q_point,
-    const std::vector<std::vector<double>>  slip_values,
-    const std::vector<std::vector<double>>  old_slip_values,
-    const std::vector<double>               slip_resistances,
-    const double                            time_step_size);
+    const std::vector<std::vector<double>>  &slip_values,
+    const std::vector<std::vector<double>>  &old_slip_values,
+    const dealii::ArrayView<const double>   slip_resistances,
+    const double                            time_step_size,
+    dealii::FullMatrix<double>              &jacobian) const;
 
 private:
   std::shared_ptr<const CrystalsData<dim>>  crystals_data;
@@ -278,6 +464,40 @@ private:
   double get_regularization_function_value(const double slip_rate) const;
 
   double get_regularization_function_derivative_value(const double slip_rate) const;
+
+  /*!
+   * @brief Implementation of @ref get_jacobian for
+   * @p n_slips_at_compile_time slip systems or, if it is zero, for the
+   * number of slip systems given at run time
+   */
+  template <unsigned int n_slips_at_compile_time>
+  void compute_jacobian(
+    const unsigned int                      q_point,
+    const std::vector<std::vector<double>>  &slip_values,
+    const std::vector<std::vector<double>>  &old_slip_values,
+    const dealii::ArrayView<const double>   slip_resistances,
+    const double                            time_step_size,
+    dealii::FullMatrix<double>              &jacobian) const;
+
+  /*!
+   * @brief Evaluates the regularization function at each entry of
+   * @p slip_rates
+   *
+   * @details @p values may alias @p slip_rates, i.e., the values can
+   * be computed in place.
+   */
+  void get_regularization_function_values(
+    const dealii::ArrayView<const double> &slip_rates,
+    const dealii::ArrayView<double>       &values) const;
+
+  /*!
+   * @brief Evaluates the derivative of the regularization function at
+   * each entry of @p slip_rates. See
+   * @ref get_regularization_function_values
+   */
+  void get_regularization_function_derivative_values(
+    const dealii::ArrayView<const double> &slip_rates,
+    const dealii::ArrayView<double>       &derivative_values) const;
 };
 
 
@@ -329,6 +549,51 @@ public:
     const unsigned int          slip_id,
     const std::vector<dealii::Tensor<1,dim>> slip_gradient) const;
 
+  /*!
+   * @brief Computes the vectorial microstresses of all slip systems at
+   * all quadrature points of a cell of the crystal @p crystal_id
+   *
+   * @param slip_gradient_values Slip gradients indexed as
+   * [slip_id][q_point]
+   * @param vectorial_microstresses Output indexed as
+   * [slip_id][q_point]. Has to be of the same size as
+   * @p slip_gradient_values
+   */
+  void get_vectorial_microstresses(
+    const unsigned int                                    crystal_id,
+    const std::vector<std::vector<dealii::Tensor<1,dim>>> &slip_gradient_values,
+    std::vector<std::vector<dealii::Tensor<1,dim>>>       &vectorial_microstresses) const;
+
+  /*!
+   * @brief Computes the Jacobians of the vectorial microstresses of
+   * all slip systems at all quadrature points of a cell of the crystal
+   * @p crystal_id
+   *
+   * @details In the quadratic case, i.e., a defect energy index of 2,
+   * the Jacobians do not depend on the slip gradients and are copied
+   * from the ones precomputed in @ref init. The common numbers of slip
+   * systems are dispatched to specializations sized at compile time,
+   * see @ref Utilities::dispatch_n_slips.
+   *
+   * @param slip_gradient_values Slip gradients indexed as
+   * [slip_id][q_point]
+   * @param jacobians Output indexed as [q_point][slip_id]
+   */
+  void get_jacobians(
+    const unsigned int                                        crystal_id,
+    const std::vector<std::vector<dealii::Tensor<1,dim>>>     &slip_gradient_values,
+    std::vector<std::vector<dealii::SymmetricTensor<2,dim>>>  &jacobians) const;
+
+  /*!
+   * @brief Returns the slip gradient independent Jacobians of the
+   * crystal @p crystal_id indexed by the slip system
+   *
+   * @details Only available in the quadratic case, i.e., a defect
+   * energy index of 2.
+   */
+  const std::vector<dealii::SymmetricTensor<2,dim>> &
+    get_quadratic_jacobians(const unsigned int crystal_id) const;
+
 private:
   std::shared_ptr<const CrystalsData<dim>>    crystals_data;
 
@@ -338,17 +603,148 @@ private:
 
   const double                                defect_energy_index;
 
+  /*!
+   * @brief The constant prefactor
+   * \f$ S_0 l^p \f$ of the vectorial microstress, where \f$ l \f$ is
+   * the energetic length scale and \f$ p \f$ the defect energy index
+   */
+  const double                                prefactor;
+
+  /*!
+   * @brief Flag indicating a defect energy index of 2, in which case
+   * the vectorial microstress is linear in the slip gradient and no
+   * power has to be evaluated
+   */
+  const bool                                  flag_quadratic;
+
   std::vector<std::vector<dealii::SymmetricTensor<2,dim>>>
                                               slip_direction_dyads;
 
   std::vector<std::vector<dealii::SymmetricTensor<2,dim>>>
                                               slip_binormal_dyads;
 
+  /*!
+   * @brief The components of the slip directions stored contiguously
+   * per crystal and spatial component, i.e., indexed as
+   * (crystal_id, component, slip_id)
+   */
+  dealii::Table<3,double>                     slip_direction_components;
+
+  /*!
+   * @brief The components of the slip orthogonals stored contiguously
+   * per crystal and spatial component, i.e., indexed as
+   * (crystal_id, component, slip_id)
+   */
+  dealii::Table<3,double>                     slip_orthogonal_components;
+
+  /*!
+   * @brief The slip gradient independent Jacobians of the quadratic
+   * case per crystal and slip system. Only computed if
+   * @ref flag_quadratic is set.
+   */
+  std::vector<std::vector<dealii::SymmetricTensor<2,dim>>>
+                                              quadratic_jacobians;
+
   bool                                        flag_init_was_called;
+
+  /*!
+   * @brief Returns the projections of the slip gradient
+   * @p slip_gradient onto the slip direction and the slip orthogonal
+   * of the slip system @p slip_id of the crystal @p crystal_id
+   */
+  std::pair<double, double> get_projections(
+    const unsigned int          crystal_id,
+    const unsigned int          slip_id,
+    const dealii::Tensor<1,dim> &slip_gradient) const;
+
+  /*!
+   * @brief Returns \f$ \abs{x}^{p-2} \f$, where \f$ p \f$ is the
+   * defect energy index, bypassing std::pow in the quadratic case
+   */
+  double get_power(const double projection) const;
+
+  /*!
+   * @brief Implementation of @ref get_vectorial_microstresses for
+   * @p n_slips_at_compile_time slip systems or, if it is zero, for the
+   * number of slip systems given at run time
+   */
+  template <unsigned int n_slips_at_compile_time>
+  void compute_vectorial_microstresses(
+    const unsigned int                                    crystal_id,
+    const std::vector<std::vector<dealii::Tensor<1,dim>>> &slip_gradient_values,
+    std::vector<std::vector<dealii::Tensor<1,dim>>>       &vectorial_microstresses) const;
+
+  /*!
+   * @brief Implementation of @ref get_jacobians for
+   * @p n_slips_at_compile_time slip systems or, if it is zero, for the
+   * number of slip systems given at run time
+   */
+  template <unsigned int n_slips_at_compile_time>
+  void compute_jacobians(
+    const unsigned int                                        crystal_id,
+    const std::vector<std::vector<dealii::Tensor<1,dim>>>     &slip_gradient_values,
+    std::vector<std::vector<dealii::SymmetricTensor<2,dim>>>  &jacobians) const;
 };
 
 
 
+template <int dim>
+inline std::pair<double, double>
+VectorialMicrostressLaw<dim>::get_projections(
+  const unsigned int          crystal_id,
+  const unsigned int          slip_id,
+  const dealii::Tensor<1,dim> &slip_gradient) const
+{
+  double direction_projection   = 0.0;
+
+  double orthogonal_projection  = 0.0;
+
+  for (unsigned int i = 0; i < dim; ++i)
+  {
+    direction_projection +=
+      slip_direction_components(crystal_id, i, slip_id) *
+      slip_gradient[i];
+
+    orthogonal_projection +=
+      slip_orthogonal_components(crystal_id, i, slip_id) *
+      slip_gradient[i];
+  }
+
+  return (std::make_pair(direction_projection, orthogonal_projection));
+}
+
+
+
+template <int dim>
+inline double
+VectorialMicrostressLaw<dim>::get_power(const double projection) const
+{
+  if (flag_quadratic)
+    return (1.0);
+  else
+    return (std::pow(std::abs(projection), defect_energy_index - 2.));
+}
+
+
+
+template <int dim>
+inline const std::vector<dealii::SymmetricTensor<2,dim>> &
+VectorialMicrostressLaw<dim>::get_quadratic_jacobians(
+  const unsigned int crystal_id) const
+{
+  Assert(flag_init_was_called,
+         dealii::ExcMessage("The VectorialMicrostressLaw<dim> "
+                            "instance has not been initialized."));
+  Assert(flag_quadratic,
+         dealii::ExcMessage("The Jacobians depend on the slip gradients "
+                            "if the defect energy index is not 2."));
+  AssertIndexRange(crystal_id, quadratic_jacobians.size());
+
+  return (quadratic_jacobians[crystal_id]);
+}
+
+
+
 template<int dim>
 class MicroscopicTractionLaw
 {
@@ -361,25 +757,55 @@ public:
     typename std::pair<std::vector<dealii::FullMatrix<double>>,
                        std::vector<dealii::FullMatrix<double>>>;
 
+  /*!
+   * @brief Returns the intra- and inter-grain interaction moduli at
+   * the quadrature points of a grain boundary face
+   *
+   * @details They only depend on the crystals at both sides of the
+   * face and on its normal vectors. The solver therefore computes them
+   * once per grain boundary face after each change of the mesh, see
+   * GradientCrystalPlasticitySolver::make_grain_interaction_moduli().
+   * The tangential projections of the slip normals are computed once
+   * per slip system and quadrature point. The common numbers of slip
+   * systems are dispatched to specializations sized at compile time,
+   * see @ref Utilities::dispatch_n_slips.
+   */
   GrainInteractionModuli get_grain_interaction_moduli(
-    const unsigned int                  crystal_id_current_cell,
-    const unsigned int                  crystal_id_neighbour_cell,
-    std::vector<dealii::Tensor<1,dim>>  normal_vector_values) const;
+    const unsigned int                        crystal_id_current_cell,
+    const unsigned int                        crystal_id_neighbour_cell,
+    const std::vector<dealii::Tensor<1,dim>>  &normal_vector_values) const;
 
   double get_microscopic_traction(
     const unsigned int                      q_point,
     const unsigned int                      slip_id_alpha,
-    const GrainInteractionModuli            grain_interaction_moduli,
-    const std::vector<std::vector<double>>  slip_values_current_cell,
-    const std::vector<std::vector<double>>  slip_values_neighbour_cell) const;
+    const GrainInteractionModuli            &grain_interaction_moduli,
+    const std::vector<std::vector<double>>  &slip_values_current_cell,
+    const std::vector<std::vector<double>>  &slip_values_neighbour_cell) const;
+
+  /*!
+   * @brief Batched counterpart of @ref get_microscopic_traction
+   * evaluating all slip systems at all quadrature points of a grain
+   * boundary face
+   *
+   * @details The common numbers of slip systems are dispatched to
+   * specializations sized at compile time, see
+   * @ref Utilities::dispatch_n_slips.
+   *
+   * @param microscopic_tractions Output indexed as [slip_id][q_point]
+   */
+  void get_microscopic_tractions(
+    const GrainInteractionModuli            &grain_interaction_moduli,
+    const std::vector<std::vector<double>>  &slip_values_current_cell,
+    const std::vector<std::vector<double>>  &slip_values_neighbour_cell,
+    std::vector<std::vector<double>>        &microscopic_tractions) const;
 
   const dealii::FullMatrix<double> get_intra_gateaux_derivative(
     const unsigned int            q_point,
-    const GrainInteractionModuli  grain_interaction_moduli) const;
+    const GrainInteractionModuli  &grain_interaction_moduli) const;
 
   const dealii::FullMatrix<double> get_inter_gateaux_derivative(
     const unsigned int            q_point,
-    const GrainInteractionModuli  grain_interaction_moduli) const;
+    const GrainInteractionModuli  &grain_interaction_moduli) const;
 
   double get_free_energy_density(
     const unsigned int                      neighbor_cell_crystal_id,
@@ -393,10 +819,63 @@ private:
   std::shared_ptr<const CrystalsData<dim>>    crystals_data;
 
   const double                                grain_boundary_modulus;
+
+  /*!
+   * @brief Returns the cross product of @p slip_normal and
+   * @p normal_vector. In two dimensions both are embedded into the
+   * three-dimensional space.
+   */
+  static dealii::Tensor<1,3> get_tangential_slip_normal(
+    const dealii::Tensor<1,dim> &slip_normal,
+    const dealii::Tensor<1,dim> &normal_vector);
+
+  /*!
+   * @brief Implementation of @ref get_grain_interaction_moduli for
+   * @p n_slips_at_compile_time slip systems or, if it is zero, for the
+   * number of slip systems given at run time
+   */
+  template <unsigned int n_slips_at_compile_time>
+  GrainInteractionModuli compute_grain_interaction_moduli(
+    const unsigned int                        crystal_id_current_cell,
+    const unsigned int                        crystal_id_neighbour_cell,
+    const std::vector<dealii::Tensor<1,dim>>  &normal_vector_values) const;
+
+  /*!
+   * @brief Implementation of @ref get_microscopic_tractions for
+   * @p n_slips_at_compile_time slip systems or, if it is zero, for the
+   * number of slip systems given at run time
+   */
+  template <unsigned int n_slips_at_compile_time>
+  void compute_microscopic_tractions(
+    const GrainInteractionModuli            &grain_interaction_moduli,
+    const std::vector<std::vector<double>>  &slip_values_current_cell,
+    const std::vector<std::vector<double>>  &slip_values_neighbour_cell,
+    std::vector<std::vector<double>>        &microscopic_tractions) const;
 };
 
 
 
+template <int dim>
+inline dealii::Tensor<1,3>
+MicroscopicTractionLaw<dim>::get_tangential_slip_normal(
+  const dealii::Tensor<1,dim> &slip_normal,
+  const dealii::Tensor<1,dim> &normal_vector)
+{
+  dealii::Tensor<1,3> tangential_slip_normal;
+
+  if constexpr (dim == 2)
+    tangential_slip_normal[2] =
+      slip_normal[0] * normal_vector[1] -
+      slip_normal[1] * normal_vector[0];
+  else
+    tangential_slip_normal =
+      dealii::cross_product_3d(slip_normal, normal_vector);
+
+  return (tangential_slip_normal);
+}
+
+
+
 template<int dim>
 class CohesiveLaw
 {
@@ -442,6 +921,68 @@ public:
     const double                old_effective_opening_displacement,
     const double                time_step_size) const;
 
+  /*!
+   * @brief Batched counterpart of @ref get_cohesive_traction evaluating
+   * all quadrature points of a face (or of several faces) at once
+   *
+   * @details The loading and the unloading branches share the
+   * expression
+   *  \f[
+   *      \bs{t} = \frac{T_{\mathrm{c}}}{\delta_{\mathrm{c}}}
+   *      \exp\left(1 - \frac{\delta_{\mathrm{eff}}^{\max}}
+   *      {\delta_{\mathrm{c}}}\right)
+   *      \left(\macaulay{\delta_{\mathrm{n}}} \bs{n} +
+   *      \beta^2 \bs{\delta}_{\mathrm{t}}\right)
+   *  \f]
+   * as the effective opening displacement equals its maximum while
+   * loading. The loop is therefore free of branches and evaluates a
+   * single exponential per quadrature point.
+   *
+   * @param opening_displacements Opening displacements at the
+   * quadrature points
+   * @param normal_vectors Normal vectors at the quadrature points
+   * @param max_effective_opening_displacements Maximum effective
+   * opening displacements stored in the history
+   * @param cohesive_tractions Output. Has to be of the same size as
+   * @p opening_displacements
+   */
+  void get_cohesive_tractions(
+    const std::vector<dealii::Tensor<1,dim>>  &opening_displacements,
+    const std::vector<dealii::Tensor<1,dim>>  &normal_vectors,
+    const std::vector<double>                 &max_effective_opening_displacements,
+    std::vector<dealii::Tensor<1,dim>>        &cohesive_tractions) const;
+
+  /*!
+   * @brief Batched counterpart of @ref get_jacobian evaluating all
+   * quadrature points of a face (or of several faces) at once
+   *
+   * @details The loading branch is selected through a mask multiplying
+   * the rank-one term instead of a conditional, i.e.,
+   *  \f[
+   *      \bs{J} = \frac{T_{\mathrm{c}}}{\delta_{\mathrm{c}}}
+   *      \exp\left(1 - \frac{\delta_{\mathrm{eff}}^{\max}}
+   *      {\delta_{\mathrm{c}}}\right)
+   *      \left(\bs{I}_{\mathrm{eff}} - m
+   *      \frac{\delta_{\mathrm{eff}}}{\delta_{\mathrm{c}}}
+   *      \bs{d} \otimes \bs{d}\right), \quad
+   *      m \in \{0, 1\}
+   *  \f]
+   *
+   * @param old_effective_opening_displacements Effective opening
+   * displacements of the last converged step
+   * @param time_step_size Size of the time step. Only its sign enters
+   * the loading criterion
+   * @param jacobians Output. Has to be of the same size as
+   * @p opening_displacements
+   */
+  void get_jacobians(
+    const std::vector<dealii::Tensor<1,dim>>  &opening_displacements,
+    const std::vector<dealii::Tensor<1,dim>>  &normal_vectors,
+    const std::vector<double>                 &max_effective_opening_displacements,
+    const std::vector<double>                 &old_effective_opening_displacements,
+    const double                              time_step_size,
+    std::vector<dealii::SymmetricTensor<2,dim>> &jacobians) const;
+
   double get_free_energy_density(
     const double effective_opening_displacement) const;
 
@@ -457,6 +998,37 @@ public:
     const dealii::Tensor<1,dim> opening_displacement,
     const dealii::Tensor<1,dim> normal_vector) const;
 
+  /*!
+   * @brief Returns the damage variable under monotonic loading, i.e.,
+   *  \f[
+   *      D = 1 - \left(1 + \frac{\delta_{\mathrm{eff}}^{\max}}
+   *      {\delta_{\mathrm{c}}}\right)
+   *      \exp\left(- \frac{\delta_{\mathrm{eff}}^{\max}}
+   *      {\delta_{\mathrm{c}}}\right)
+   *  \f]
+   */
+  double get_damage_variable(
+    const double max_effective_opening_displacement) const;
+
+  /*!
+   * @brief Returns the damage variable under cyclic loading, i.e., the
+   * committed damage variable plus its increment
+   *  \f[
+   *      \Delta D = c_{\mathrm{a}}
+   *      \macaulay{\delta_{\mathrm{eff}} - \delta_{\mathrm{eff}}^{n-1}}
+   *      \left(1 - D^{n-1} + c_{\mathrm{d}}\right)^{m}
+   *      \left(Y - Y_{\mathrm{e}}\right)
+   *  \f]
+   * bounded by one.
+   */
+  double get_damage_variable(
+    const double committed_damage_variable,
+    const double effective_opening_displacement,
+    const double old_effective_opening_displacement,
+    const double thermodynamic_force) const;
+
+  double get_tangential_to_normal_stiffness_ratio() const;
+
   EffectiveQuantities
     get_effective_quantities(
       const dealii::Tensor<1,dim> opening_displacement,
@@ -472,6 +1044,16 @@ private:
 
   double degradation_exponent;
 
+  double damage_accumulation_constant;
+
+  double damage_decay_constant;
+
+  double damage_decay_exponent;
+
+  double endurance_limit;
+
+  bool   flag_set_damage_to_zero;
+
   double macaulay_brackets(const double value) const;
 
   double get_effective_cohesive_traction(
@@ -514,6 +1096,15 @@ CohesiveLaw<dim>::get_degradation_function_derivative_value(
 
 
 
+template <int dim>
+inline double
+CohesiveLaw<dim>::get_tangential_to_normal_stiffness_ratio() const
+{
+  return (tangential_to_normal_stiffness_ratio);
+}
+
+
+
 template <int dim>
 inline double
 CohesiveLaw<dim>::macaulay_brackets(const double value) const
@@ -616,6 +1207,37 @@ public:
     const dealii::Tensor<1,dim> opening_displacement,
     const dealii::Tensor<1,dim> normal_vector) const;
 
+  /*!
+   * @brief Batched counterpart of @ref get_contact_traction
+   *
+   * @details The Macaulay brackets are evaluated as masks so that the
+   * loop over the quadrature points is free of branches.
+   *
+   * @param opening_displacements Opening displacements at the
+   * quadrature points
+   * @param normal_vectors Normal vectors at the quadrature points
+   * @param contact_tractions Output. Has to be of the same size as
+   * @p opening_displacements
+   */
+  void get_contact_tractions(
+    const std::vector<dealii::Tensor<1,dim>>  &opening_displacements,
+    const std::vector<dealii::Tensor<1,dim>>  &normal_vectors,
+    std::vector<dealii::Tensor<1,dim>>        &contact_tractions) const;
+
+  /*!
+   * @brief Batched counterpart of @ref get_jacobian
+   *
+   * @param opening_displacements Opening displacements at the
+   * quadrature points
+   * @param normal_vectors Normal vectors at the quadrature points
+   * @param jacobians Output. Has to be of the same size as
+   * @p opening_displacements
+   */
+  void get_jacobians(
+    const std::vector<dealii::Tensor<1,dim>>    &opening_displacements,
+    const std::vector<dealii::Tensor<1,dim>>    &normal_vectors,
+    std::vector<dealii::SymmetricTensor<2,dim>> &jacobians) const;
+
 private:
   /*!
    * @brief The penalty coefficient multiplying the @ref stiffness value
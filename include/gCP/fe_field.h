@@ -3,6 +3,7 @@
 
 #include <deal.II/base/index_set.h>
 
+#include <deal.II/distributed/solution_transfer.h>
 #include <deal.II/distributed/tria.h>
 
 #include <deal.II/dofs/dof_handler.h>
@@ -13,6 +14,9 @@
 #include <deal.II/lac/generic_linear_algebra.h>
 
 #include <gCP/utilities.h>
+
+#include <memory>
+
 namespace gCP
 {
 
@@ -215,6 +219,20 @@ public:
     const unsigned int crystal_id,
     const unsigned int local_component) const;
 
+  /*!
+   * @brief Returns the local degrees of freedom of the crystal
+   * @p crystal_id which belong to the displacement field.
+   */
+  const std::vector<unsigned int>&
+    get_displacement_local_dofs(const unsigned int crystal_id) const;
+
+  /*!
+   * @brief Returns the local degrees of freedom of the crystal
+   * @p crystal_id grouped by the slip they belong to.
+   */
+  const std::vector<std::vector<unsigned int>>&
+    get_slips_local_dofs(const unsigned int crystal_id) const;
+
   /**
    * @brief Get the displacement extractor object
    *
@@ -257,6 +275,45 @@ public:
    */
   void prepare_for_serialization_of_active_fe_indices();
 
+  /*!
+   * @brief Attaches @ref solution, @ref old_solution and
+   * @ref old_old_solution to the triangulation for its serialization.
+   *
+   * @details The data is written by the subsequent call to
+   * dealii::parallel::distributed::Triangulation::save(). The
+   * active finite element indices are not serialized as they are
+   * given by the material identifiers of the cells.
+   */
+  void prepare_for_serialization();
+
+  /*!
+   * @brief Restores @ref solution, @ref old_solution and
+   * @ref old_old_solution from a triangulation loaded with
+   * dealii::parallel::distributed::Triangulation::load().
+   *
+   * @details It has to be called after @ref setup_vectors and before
+   * the deserialization of any other data attached to the triangulation
+   * after the vectors, as the data is read in the order it was attached.
+   */
+  void deserialize();
+
+  /*!
+   * @brief Attaches @ref solution, @ref old_solution and
+   * @ref old_old_solution to the triangulation for their transfer
+   * during its coarsening and refinement.
+   */
+  void prepare_for_coarsening_and_refinement();
+
+  /*!
+   * @brief Interpolates @ref solution, @ref old_solution and
+   * @ref old_old_solution onto the coarsened and refined triangulation.
+   *
+   * @details It has to be called after the degrees of freedom and the
+   * vectors were set up anew, see @ref setup_dofs and
+   * @ref setup_vectors.
+   */
+  void interpolate_after_coarsening_and_refinement();
+
   /*!
    * @brief Returns the number of degrees of freedom.
    */
@@ -371,6 +428,20 @@ private:
    */
   std::vector<unsigned int>         global_component_mapping;
 
+  /*!
+   * @brief The local degrees of freedom of each crystal belonging to
+   * the displacement field.
+   */
+  std::vector<std::vector<unsigned int>>
+                                    displacement_local_dofs;
+
+  /*!
+   * @brief The local degrees of freedom of each crystal grouped by
+   * the slip they belong to.
+   */
+  std::vector<std::vector<std::vector<unsigned int>>>
+                                    slips_local_dofs;
+
   /*!
    * @brief
    *
@@ -442,6 +513,18 @@ private:
    * @todo Docu
    */
   bool                              flag_setup_vectors_was_called;
+
+  /*!
+   * @brief The instance transferring the solution vectors during the
+   * serialization and the coarsening and refinement. It has to outlive
+   * the call to dealii::parallel::distributed::Triangulation::save() and
+   * dealii::parallel::distributed::Triangulation::execute_coarsening_and_refinement(),
+   * respectively.
+   */
+  std::unique_ptr<
+    dealii::parallel::distributed::SolutionTransfer<
+      dim, dealii::LinearAlgebraTrilinos::MPI::Vector>>
+                                    solution_transfer;
 };
 
 
@@ -565,6 +648,28 @@ FEField<dim>::get_global_component(
 
 
 
+template <int dim>
+inline const std::vector<unsigned int>&
+FEField<dim>::get_displacement_local_dofs(const unsigned int crystal_id) const
+{
+  AssertIndexRange(crystal_id, displacement_local_dofs.size());
+
+  return (displacement_local_dofs[crystal_id]);
+}
+
+
+
+template <int dim>
+inline const std::vector<std::vector<unsigned int>>&
+FEField<dim>::get_slips_local_dofs(const unsigned int crystal_id) const
+{
+  AssertIndexRange(crystal_id, slips_local_dofs.size());
+
+  return (slips_local_dofs[crystal_id]);
+}
+
+
+
 template <int dim>
 inline const dealii::FEValuesExtractors::Vector&
 FEField<dim>::get_displacement_extractor(const unsigned int crystal_id) const
@@ -8,17 +8,42 @@
 #include <gCP/postprocessing.h>
 #include <gCP/quadrature_point_history.h>
 #include <gCP/run_time_parameters.h>
+#include <gCP/tensor_product_kernels.h>
 #include <gCP/utilities.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/discrete_time.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/table_handler.h>
 #include <deal.II/base/tensor_function.h>
 #include <deal.II/base/timer.h>
 #include <deal.II/base/quadrature_point_data.h>
 #include <deal.II/base/utilities.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/base/work_stream.h>
 
+#include <deal.II/distributed/cell_data_transfer.h>
+
+#include <deal.II/grid/filtered_iterator.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/trilinos_solver.h>
+
+#include <array>
+#include <atomic>
 #include <memory>
 #include <fstream>
+#include <string>
+
+namespace Tests
+{
+  /*!
+   * @brief Access of the tests to the internals of
+   * gCP::GradientCrystalPlasticitySolver. Defined in the tests
+   */
+  template <int dim>
+  class SolverAccess;
+} // namespace Tests
 
 namespace gCP
 {
@@ -78,6 +103,72 @@ public:
 
   double get_macroscopic_damage();
 
+  /*!
+   * @brief Writes a checkpoint into the files prefixed by @p filename
+   *
+   * @details The triangulation, the solution vectors of @ref fe_field
+   * and the quadrature point history at the bulk and at the grain
+   * boundaries are written with the parallel binary I/O of
+   * dealii::parallel::distributed::Triangulation::save(). The state of
+   * the dealii::DiscreteTime instance and the log of the nonlinear
+   * solver are written by the root process. The files alternate
+   * between two prefixes and the pointer file is only updated once
+   * all of them were written, see Utilities::commit_checkpoint.
+   */
+  void save_checkpoint(const std::string &filename);
+
+  /*!
+   * @brief Restores the state written by @ref save_checkpoint
+   *
+   * @details It has to be called once the triangulation was loaded
+   * with dealii::parallel::distributed::Triangulation::load() from
+   * Utilities::get_latest_checkpoint_prefix() of @p filename and
+   * @ref fe_field and this instance were set up, i.e., after
+   * @ref init. The dealii::DiscreteTime instance is not restored as it
+   * is owned by the caller. See Utilities::load_discrete_time.
+   */
+  void load_checkpoint(const std::string &filename);
+
+  /*!
+   * @brief Computes the Kelly error indicator of the slips at the
+   * locally owned cells
+   *
+   * @details The slips of a crystal vanish inside the others. The jumps
+   * across the grain boundaries are thus included, i.e., the indicator
+   * marks both the slip bands and the vicinity of the grain boundaries.
+   */
+  void estimate_error(dealii::Vector<float> &estimated_error_per_cell) const;
+
+  /*!
+   * @brief Prepares the coarsening and refinement of @p triangulation,
+   * i.e., it has to be called right before
+   * dealii::parallel::distributed::Triangulation::execute_coarsening_and_refinement()
+   *
+   * @details The grain boundaries have to be conforming. The flags of
+   * the cells at both sides of a grain boundary are therefore made
+   * consistent across all processes, see
+   * Utilities::match_refinement_flags_at_grain_boundaries, where cells
+   * on the level @p max_level or finer are not refined. Afterwards the
+   * solution vectors of @ref fe_field and the quadrature point history
+   * are attached to the triangulation.
+   */
+  void prepare_for_coarsening_and_refinement(
+    dealii::parallel::distributed::Triangulation<dim> &triangulation,
+    const unsigned int max_level = dealii::numbers::invalid_unsigned_int);
+
+  /*!
+   * @brief Transfers the solution vectors and the quadrature point
+   * history onto the coarsened and refined triangulation
+   *
+   * @details It has to be called once @ref fe_field and this instance
+   * were set up anew, i.e., after @ref init. The slip resistances are
+   * projected onto a discontinuous polynomial space and evaluated at
+   * the quadrature points of the new cells. The internal variables of
+   * the cohesive law are likewise projected face-wise and evaluated at
+   * the quadrature points of the new faces.
+   */
+  void interpolate_after_coarsening_and_refinement();
+
   /*!
    * @brief Temporary method
    *
@@ -86,6 +177,8 @@ public:
   void output_data_to_file(std::ostream &file) const;
 
 private:
+  friend class Tests::SolverAccess<dim>;
+
   const RunTimeParameters::SolverParameters         &parameters;
 
   const RunTimeParameters::TemporalDiscretizationParameters
@@ -133,18 +226,218 @@ private:
   std::shared_ptr<ConstitutiveLaws::ContactLaw<dim>>
                                                     contact_law;
 
-  dealii::CellDataStorage<
-    typename dealii::Triangulation<dim>::cell_iterator,
-    QuadraturePointHistory<dim>>                    quadrature_point_history;
+  /*!
+   * @brief The slip resistances at the quadrature points, indexed by
+   * the active cell index
+   */
+  QuadraturePointHistoryStorage<dim>                quadrature_point_history;
 
   InterfaceDataStorage<
     typename dealii::Triangulation<dim>::cell_iterator,
     InterfaceQuadraturePointHistory<dim>>           interface_quadrature_point_history;
 
+  /*!
+   * @brief The quadrature point history of each locally owned cell
+   * flattened into a single vector, indexed by the active cell index.
+   * Only populated during the serialization and the coarsening and
+   * refinement. See @ref pack_local_quadrature_point_history
+   */
+  std::vector<std::vector<double>>                  serialized_quadrature_point_history;
+
+  /*!
+   * @brief The instance transferring
+   * @ref serialized_quadrature_point_history during the serialization
+   * and the coarsening and refinement. It has to outlive the call to
+   * dealii::parallel::distributed::Triangulation::save() and
+   * dealii::parallel::distributed::Triangulation::execute_coarsening_and_refinement(),
+   * respectively.
+   */
+  std::unique_ptr<
+    dealii::parallel::distributed::CellDataTransfer<
+      dim, dim, std::vector<std::vector<double>>>>  cell_data_transfer;
+
+  /*!
+   * @brief The discontinuous finite element onto which the slip
+   * resistances are projected during the coarsening and refinement
+   */
+  std::unique_ptr<const dealii::FiniteElement<dim>> history_projection_fe;
+
+  /*!
+   * @brief The matrix projecting the values at the quadrature points
+   * onto the degrees of freedom of @ref history_projection_fe
+   */
+  dealii::FullMatrix<double>                        history_projection_matrix;
+
+  /*!
+   * @brief The matrix interpolating the degrees of freedom of
+   * @ref history_projection_fe to the quadrature points
+   */
+  dealii::FullMatrix<double>                        history_interpolation_matrix;
+
+  /*!
+   * @brief The discontinuous finite element onto which the internal
+   * variables of the cohesive law are projected face-wise during the
+   * coarsening and refinement
+   */
+  std::unique_ptr<const dealii::FiniteElement<dim-1>>
+                                                    history_face_projection_fe;
+
+  /*!
+   * @brief The matrix projecting the values at the face quadrature
+   * points onto the degrees of freedom of
+   * @ref history_face_projection_fe
+   */
+  dealii::FullMatrix<double>                        history_face_projection_matrix;
+
+  /*!
+   * @brief The matrix interpolating the degrees of freedom of
+   * @ref history_face_projection_fe to the face quadrature points
+   */
+  dealii::FullMatrix<double>                        history_face_interpolation_matrix;
+
   dealii::Vector<float>                             cell_is_at_grain_boundary;
 
+  /*!
+   * @brief A face at a grain boundary as seen from a locally owned
+   * cell
+   */
+  struct GrainBoundaryFace
+  {
+    typename dealii::DoFHandler<dim>::active_cell_iterator  cell;
+
+    unsigned int                                            face_index;
+
+    typename dealii::DoFHandler<dim>::active_cell_iterator  neighbour_cell;
+
+    /*!
+     * @brief The index of the face as seen from @ref neighbour_cell
+     */
+    unsigned int                                            neighbour_face_index;
+
+    unsigned int                                            neighbour_crystal_id;
+
+    /*!
+     * @brief The identifier of the face inside
+     * @ref interface_quadrature_point_history. Shared with the entry
+     * of the neighbour cell, if the latter is locally owned.
+     */
+    unsigned int                                            interface_id;
+
+    /*!
+     * @brief The intra- and inter-grain interaction moduli at the
+     * quadrature points of the face as seen from @ref cell
+     *
+     * @details Only computed if microtractions are prescribed at the
+     * grain boundaries, see @ref make_grain_interaction_moduli
+     */
+    typename ConstitutiveLaws::MicroscopicTractionLaw<dim>::
+      GrainInteractionModuli                                grain_interaction_moduli;
+  };
+
+  /*!
+   * @brief The faces at the grain boundaries of the locally owned
+   * cells, sorted by the active cell index of the cells
+   *
+   * @details Built once in @ref init, i.e., it has to be rebuilt
+   * only if the mesh changes. The faces of a cell are accessed
+   * through @ref get_grain_boundary_faces.
+   */
+  std::vector<GrainBoundaryFace>                    grain_boundary_faces;
+
+  /*!
+   * @brief The faces of the cell with active cell index @p i are
+   * stored in the range
+   * [grain_boundary_faces_offsets[i], grain_boundary_faces_offsets[i+1])
+   * of @ref grain_boundary_faces
+   */
+  std::vector<unsigned int>                         grain_boundary_faces_offsets;
+
+  /*!
+   * @brief The index inside @ref grain_boundary_faces of one of the
+   * faces of each entry of @ref interface_quadrature_point_history,
+   * indexed by the interface identifier
+   *
+   * @details The faces of which both cells are locally owned appear
+   * twice in @ref grain_boundary_faces. Visiting only the faces listed
+   * here updates the shared interface data exactly once and without
+   * concurrent writes. Built in @ref init_quadrature_point_history.
+   */
+  std::vector<unsigned int>                         interface_grain_boundary_faces;
+
+  /*!
+   * @brief The trial damage variables of
+   * @ref interface_quadrature_point_history prior to the current
+   * assembly, indexed by interface_id * n_face_q_points + face_q_point
+   *
+   * @details The assemblies updating the interface quadrature point
+   * history read the previous trial damage variable of a face from
+   * here, as the cell of the face listed in
+   * @ref interface_grain_boundary_faces overwrites it concurrently.
+   * Empty unless the loading is cyclic.
+   */
+  std::vector<double>                               trial_interface_damage_variables;
+
+  /*!
+   * @brief The locally owned cells of the DoFHandler of @ref fe_field
+   * grouped into colors, i.e., sets of cells which write into disjoint
+   * rows of the global matrix and vectors.
+   *
+   * @details Only computed if
+   * @ref RunTimeParameters::SolverParameters::flag_colored_assembly
+   * is set.
+   */
+  std::vector<std::vector<
+    typename dealii::DoFHandler<dim>::active_cell_iterator>>
+                                                    colored_cells;
+
+  /*!
+   * @brief Same as @ref colored_cells for @ref projection_dof_handler
+   */
+  std::vector<std::vector<
+    typename dealii::DoFHandler<dim>::active_cell_iterator>>
+                                                    colored_projection_cells;
+
   dealii::LinearAlgebraTrilinos::MPI::SparseMatrix  jacobian;
 
+  /*!
+   * @brief The ILU preconditioner of the Krylov solvers. It is only
+   * recomputed if @ref jacobian was assembled since its last
+   * initialization
+   */
+  dealii::LinearAlgebraTrilinos::MPI::PreconditionILU
+                                                    ilu_preconditioner;
+
+  /*!
+   * @brief Control of @ref direct_solver. The direct solver performs
+   * no iterations but holds on to it during its whole lifetime
+   */
+  dealii::SolverControl                             direct_solver_control;
+
+  /*!
+   * @brief The direct solver. It holds the factorization of
+   * @ref jacobian, which is only recomputed if the latter was assembled
+   * since the last factorization
+   */
+  std::unique_ptr<dealii::TrilinosWrappers::SolverDirect>
+                                                    direct_solver;
+
+  /*!
+   * @brief Flag indicating if @ref jacobian has to be assembled in the
+   * next Newton iteration.
+   *
+   * @details Only relevant if
+   * @ref RunTimeParameters::NewtonRaphsonParameters::flag_reuse_jacobian
+   * is set. Otherwise the Jacobian is assembled in every iteration.
+   */
+  bool                                              flag_refresh_jacobian;
+
+  /*!
+   * @brief Flag indicating if @ref ilu_preconditioner has to be
+   * initialized, or @ref direct_solver has to factorize @ref jacobian,
+   * before the next linear solve
+   */
+  bool                                              flag_refresh_preconditioner;
+
   dealii::LinearAlgebraTrilinos::MPI::Vector        trial_solution;
 
   dealii::LinearAlgebraTrilinos::MPI::Vector        initial_trial_solution;
@@ -187,11 +480,388 @@ private:
 
   void init_quadrature_point_history();
 
+  /*!
+   * @brief Returns the quadrature point history of the cell with the
+   * active cell index @p active_cell_index flattened into a single
+   * vector
+   *
+   * @details The slip resistances at the quadrature points are followed,
+   * if decohesion is allowed, by a flag for each face of the cell
+   * indicating if it lies at a grain boundary. In that case the flag is
+   * followed by the internal variables at the quadrature points of the
+   * face.
+   */
+  std::vector<double> pack_local_quadrature_point_history(
+    const unsigned int active_cell_index) const;
+
+  /*!
+   * @brief Sets both the trial and the committed quadrature point
+   * history of the cell with the active cell index @p active_cell_index
+   * from @p values. See @ref pack_local_quadrature_point_history
+   */
+  void unpack_local_quadrature_point_history(
+    const unsigned int          active_cell_index,
+    const std::vector<double>   &values);
+
+  /*!
+   * @brief Transfers the packed quadrature point history of a cell to
+   * its children. See @ref interpolate_after_coarsening_and_refinement
+   */
+  std::vector<std::vector<double>> refine_local_quadrature_point_history(
+    const std::vector<double> &parent_values) const;
+
+  /*!
+   * @brief Transfers the packed quadrature point history of the
+   * children of a cell to the latter. See
+   * @ref interpolate_after_coarsening_and_refinement
+   */
+  std::vector<double> coarsen_local_quadrature_point_history(
+    const std::vector<std::vector<double>> &children_values) const;
+
+  /*!
+   * @brief Attaches the quadrature point history of the locally owned
+   * cells to the triangulation for its serialization
+   *
+   * @details It has to be called after
+   * FEField::prepare_for_serialization, as the data is deserialized in
+   * the order it was attached.
+   */
+  void prepare_quadrature_point_history_for_serialization();
+
+  /*!
+   * @brief Restores the quadrature point history attached by
+   * @ref prepare_quadrature_point_history_for_serialization. The
+   * restored values are both the trial and the committed ones.
+   */
+  void deserialize_quadrature_point_history();
+
+  /*!
+   * @brief SIMD type of the sum-factorized kernels. Each lane holds
+   * the values of one cell of a @ref CellBatch
+   */
+  using VectorizedArrayType = dealii::VectorizedArray<double>;
+
+  /*!
+   * @brief Sum-factorized kernels of the displacement and the slip
+   * components. Only set if
+   * @ref RunTimeParameters::SolverParameters::flag_sum_factorization
+   * or @ref RunTimeParameters::KrylovParameters::flag_matrix_free is
+   * set.
+   */
+  std::unique_ptr<const TensorProductKernels<dim, VectorizedArrayType>>
+                                                    displacement_kernels;
+
+  std::unique_ptr<const TensorProductKernels<dim, VectorizedArrayType>>
+                                                    slip_kernels;
+
+  /*!
+   * @brief The local degree of freedom of each lexicographic degree of
+   * freedom of the kernels, indexed by the crystal, the component and
+   * the lexicographic index. The first dim components are the ones of
+   * the displacement, the remaining ones the slips.
+   */
+  std::vector<std::vector<std::vector<unsigned int>>>
+                                                    lexicographic_local_dofs;
+
+  /*!
+   * @brief Builds @ref displacement_kernels, @ref slip_kernels and
+   * @ref lexicographic_local_dofs
+   */
+  void setup_sum_factorization();
+
+  /*!
+   * @brief Locally owned cells of the same crystal whose bulk integrals
+   * are evaluated at once, one cell per lane of
+   * @ref VectorizedArrayType
+   *
+   * @details The cells share the reference element and
+   * @ref lexicographic_local_dofs. The quadrature point operations and
+   * the grain boundary integrals are still evaluated cell by cell.
+   */
+  struct CellBatch
+  {
+    std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator>
+                                                    cells;
+  };
+
+  using CellBatchIterator = typename std::vector<CellBatch>::const_iterator;
+
+  /*!
+   * @brief The local vectors of the cells of a @ref CellBatch into
+   * which the bulk integrals are scattered, indexed by the lane
+   */
+  using BatchLocalVectors =
+    std::array<dealii::Vector<double> *, VectorizedArrayType::size()>;
+
+  /*!
+   * @brief The locally owned cells of the DoFHandler of @ref fe_field
+   * grouped into batches. Only set together with
+   * @ref displacement_kernels.
+   */
+  std::vector<CellBatch>                            cell_batches;
+
+  /*!
+   * @brief Counterpart of @ref cell_batches for the colored assembly,
+   * i.e., the cells of each entry of @ref colored_cells grouped into
+   * batches. The batches of a color write into disjoint rows.
+   */
+  std::vector<std::vector<CellBatch>>               colored_cell_batches;
+
+  /*!
+   * @brief Builds @ref cell_batches and @ref colored_cell_batches
+   */
+  void make_cell_batches();
+
+  /*!
+   * @brief The dense index of each locally owned active cell.
+   * dealii::numbers::invalid_unsigned_int flags the remaining ones.
+   *
+   * @details Indexes the data which is only stored at the locally
+   * owned cells, e.g., @ref local_jacobian_tangents.
+   */
+  std::vector<unsigned int>                         locally_owned_cell_indices;
+
+  unsigned int                                      n_locally_owned_cells;
+
+  /*!
+   * @brief Builds @ref locally_owned_cell_indices and counts the
+   * locally owned cells
+   */
+  void make_locally_owned_cell_indices();
+
+  /*!
+   * @brief Returns the dense index of the locally owned cell with the
+   * active cell index @p active_cell_index
+   */
+  unsigned int get_locally_owned_cell_index(
+    const unsigned int active_cell_index) const;
+
+  /*!
+   * @brief Builds @ref grain_boundary_faces and
+   * @ref cell_is_at_grain_boundary
+   *
+   * @details The handles to the interface quadrature point history are
+   * set in @ref init_quadrature_point_history
+   */
+  void make_grain_boundary_faces();
+
+  /*!
+   * @brief Computes the grain interaction moduli of each entry of
+   * @ref grain_boundary_faces
+   *
+   * @details They only depend on the crystals at both sides of the
+   * face and on its normal vectors. Hence they are computed once in
+   * @ref init, i.e., only anew if the mesh changes, instead of at
+   * each assembly.
+   */
+  void make_grain_interaction_moduli();
+
+  /*!
+   * @brief Returns the faces at the grain boundaries of the cell with
+   * the active cell index @p active_cell_index
+   *
+   * @details Being indexed by the active cell index, it can be called
+   * with the cells of any DoFHandler on the underlying triangulation.
+   */
+  dealii::ArrayView<const GrainBoundaryFace> get_grain_boundary_faces(
+    const unsigned int active_cell_index) const;
+
   void make_sparsity_pattern(
     dealii::TrilinosWrappers::SparsityPattern &sparsity_pattern);
 
   void distribute_constraints_to_initial_trial_solution();
 
+  /*!
+   * @brief Computes @ref colored_cells and @ref colored_projection_cells
+   *
+   * @details Two cells conflict if they share a degree of freedom
+   * once the constraints are resolved. At the grain boundaries the
+   * degrees of freedom of the neighbour cells are also taken into
+   * account.
+   */
+  void make_cell_coloring();
+
+  /*!
+   * @brief Runs @p worker and @p copier over the locally owned cells
+   * of @p dof_handler using the WorkStream approach.
+   *
+   * @details If
+   * @ref RunTimeParameters::SolverParameters::flag_colored_assembly
+   * is set, the cells are traversed color by color as given by
+   * @p cell_colors and the copier runs concurrently on the worker
+   * threads. Otherwise all copies go through a single copier thread.
+   * Both traversals are timed in their own @ref timer_output section,
+   * named after the traversal, @p assembly_name and the number of
+   * threads, e.g., "Solver: Colored residual assembly on 8 threads" and
+   * "Solver: Serial copier residual assembly on 8 threads". The scaling
+   * of both with the number of threads can thus be compared across
+   * runs.
+   */
+  template <typename Worker,
+            typename Copier,
+            typename ScratchData,
+            typename CopyData>
+  void run_work_stream(
+    const dealii::DoFHandler<dim>                     &dof_handler,
+    const std::vector<std::vector<
+      typename dealii::DoFHandler<dim>::active_cell_iterator>>
+                                                      &cell_colors,
+    const std::string                                 &assembly_name,
+    const Worker                                      &worker,
+    const Copier                                      &copier,
+    const ScratchData                                 &scratch,
+    const CopyData                                    &copy) const;
+
+  /*!
+   * @brief Same as above for the locally owned cells grouped into the
+   * cell batches @p batches, respectively @p colored_batches, e.g.,
+   * @ref cell_batches and @ref colored_cell_batches. @p worker is
+   * called with a @ref CellBatchIterator.
+   */
+  template <typename Worker,
+            typename Copier,
+            typename ScratchData,
+            typename CopyData>
+  void run_work_stream(
+    const std::vector<CellBatch>                      &batches,
+    const std::vector<std::vector<CellBatch>>         &colored_batches,
+    const std::string                                 &assembly_name,
+    const Worker                                      &worker,
+    const Copier                                      &copier,
+    const ScratchData                                 &scratch,
+    const CopyData                                    &copy) const;
+
+  /*!
+   * @brief Evaluates the slips of @p vector at the quadrature points
+   * of @p cell.
+   *
+   * @details The local degrees of freedom values are gathered once and
+   * all slips are evaluated in a single pass over the local degrees
+   * of freedom, instead of one FEValuesViews::Scalar call per slip,
+   * each of which gathers the local values anew. The inner loops run
+   * over contiguous quadrature point data.
+   *
+   * @note The gradients are only computed if @p slip_gradient_values
+   * is not a null pointer.
+   */
+  void evaluate_local_slips(
+    const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+    const dealii::FEValues<dim>                                   &fe_values,
+    const dealii::LinearAlgebraTrilinos::MPI::Vector              &vector,
+    dealii::Vector<double>                                        &local_dof_values,
+    std::vector<std::vector<double>>                              &slip_values,
+    std::vector<std::vector<dealii::Tensor<1,dim>>>               *slip_gradient_values = nullptr) const;
+
+  /*!
+   * @brief Gathers the local values of @p vector at each cell of
+   * @p cell_batch into
+   * @ref AssemblyData::SumFactorizationScratch::batch_local_dof_values
+   */
+  void gather_batch_dof_values(
+    const CellBatch                                   &cell_batch,
+    const dealii::LinearAlgebraTrilinos::MPI::Vector  &vector,
+    gCP::AssemblyData::SumFactorizationScratch<dim>   &scratch) const;
+
+  /*!
+   * @brief Evaluates the values and the reference gradients of the
+   * component @p component at the quadrature points of all cells of
+   * @p cell_batch at once with @p kernels
+   *
+   * @details The local degrees of freedom values have to be gathered
+   * beforehand, see @ref gather_batch_dof_values. The component is
+   * numbered as in @ref lexicographic_local_dofs. Null pointers are
+   * skipped.
+   */
+  void evaluate_batch_component(
+    const CellBatch                                         &cell_batch,
+    const TensorProductKernels<dim, VectorizedArrayType>    &kernels,
+    const unsigned int                                      component,
+    gCP::AssemblyData::SumFactorizationScratch<dim>         &scratch,
+    dealii::AlignedVector<VectorizedArrayType>              *values,
+    dealii::AlignedVector<
+      dealii::Tensor<1,dim,VectorizedArrayType>>            *reference_gradients) const;
+
+  /*!
+   * @brief Integrates @p value_fluxes tested with the shape functions
+   * of the component @p component and @p reference_gradient_fluxes
+   * tested with their reference gradients for all cells of
+   * @p cell_batch at once and adds the result of each cell to its
+   * entry of @p local_vectors
+   *
+   * @details See @ref set_lane_fluxes for the fluxes. Null pointers
+   * are skipped.
+   */
+  void integrate_batch_component(
+    const CellBatch                                         &cell_batch,
+    const TensorProductKernels<dim, VectorizedArrayType>    &kernels,
+    const unsigned int                                      component,
+    gCP::AssemblyData::SumFactorizationScratch<dim>         &scratch,
+    const dealii::AlignedVector<VectorizedArrayType>        *value_fluxes,
+    const dealii::AlignedVector<
+      dealii::Tensor<1,dim,VectorizedArrayType>>            *reference_gradient_fluxes,
+    const BatchLocalVectors                                 &local_vectors) const;
+
+  /*!
+   * @brief Copies the lane @p lane of @p batch_values into @p values
+   * and pushes the lane of @p batch_reference_gradients forward to the
+   * real cell of @p fe_values, i.e., grad = J^{-T} grad_ref, into
+   * @p gradients
+   *
+   * @details @p fe_values only has to provide the inverse Jacobians of
+   * the mapping. Null pointers are skipped.
+   */
+  void get_lane_values(
+    const dealii::FEValues<dim>                             &fe_values,
+    const unsigned int                                      lane,
+    const dealii::AlignedVector<VectorizedArrayType>        *batch_values,
+    const dealii::AlignedVector<
+      dealii::Tensor<1,dim,VectorizedArrayType>>            *batch_reference_gradients,
+    std::vector<double>                                     *values,
+    std::vector<dealii::Tensor<1,dim>>                      *gradients) const;
+
+  /*!
+   * @brief Counterpart of @ref get_lane_values. Copies @p value_fluxes
+   * into the lane @p lane of @p batch_value_fluxes and pulls
+   * @p gradient_fluxes back to the reference cell, i.e.,
+   * flux_ref = J^{-1} flux, into the lane of
+   * @p batch_reference_gradient_fluxes
+   *
+   * @details The fluxes have to include the JxW values. Null pointers
+   * are skipped.
+   */
+  void set_lane_fluxes(
+    const dealii::FEValues<dim>                             &fe_values,
+    const unsigned int                                      lane,
+    const std::vector<double>                               *value_fluxes,
+    const std::vector<dealii::Tensor<1,dim>>                *gradient_fluxes,
+    dealii::AlignedVector<VectorizedArrayType>              *batch_value_fluxes,
+    dealii::AlignedVector<
+      dealii::Tensor<1,dim,VectorizedArrayType>>            *batch_reference_gradient_fluxes) const;
+
+  /*!
+   * @brief Sum-factorized counterpart of the quadrature point loop of
+   * @ref assemble_local_residual. The stresses, resolved stresses and
+   * microstresses of the cell stored in @p scratch are set as the
+   * fluxes of the lane @p lane. See @ref integrate_batch_bulk_residual
+   */
+  void set_lane_bulk_residual_fluxes(
+    const dealii::FEValues<dim>                 &fe_values,
+    const unsigned int                          lane,
+    gCP::AssemblyData::Residual::Scratch<dim>   &scratch,
+    const bool flag_assemble_linear_contributions) const;
+
+  /*!
+   * @brief Integrates the fluxes of all cells of @p cell_batch set by
+   * @ref set_lane_bulk_residual_fluxes against the test functions of
+   * the displacement and the slips
+   */
+  void integrate_batch_bulk_residual(
+    const CellBatch                                             &cell_batch,
+    gCP::AssemblyData::Residual::Scratch<dim>                   &scratch,
+    gCP::AssemblyData::CellBatchCopy<
+      gCP::AssemblyData::Residual::Copy>                        &data,
+    const bool flag_assemble_linear_contributions) const;
+
   void assemble_jacobian();
 
   void assemble_local_jacobian(
@@ -199,23 +869,473 @@ private:
     gCP::AssemblyData::Jacobian::Scratch<dim>                     &scratch,
     gCP::AssemblyData::Jacobian::Copy                             &data);
 
+  /*!
+   * @brief Assembles the local Jacobian using the already
+   * reinitialized @p fe_values and the slip values stored in
+   * @p scratch
+   *
+   * @details If @p trial_interface_quadrature_point_history is given,
+   * the interface quadrature point history of the grain boundary faces
+   * of the cell is taken from it instead of from
+   * @ref interface_quadrature_point_history. See
+   * @ref AssemblyData::Residual::Scratch::interface_quadrature_point_history
+   */
+  void assemble_local_jacobian(
+    const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+    const dealii::FEValues<dim>                                   &fe_values,
+    gCP::AssemblyData::Jacobian::Scratch<dim>                     &scratch,
+    gCP::AssemblyData::Jacobian::Copy                             &data,
+    const std::vector<std::vector<InterfaceQuadraturePointHistory<dim>>>
+      *trial_interface_quadrature_point_history = nullptr);
+
   void copy_local_to_global_jacobian(
     const gCP::AssemblyData::Jacobian::Copy &data);
 
+  /*!
+   * @brief A local Jacobian together with the state it was computed
+   * at
+   */
+  struct LocalJacobianCacheEntry
+  {
+    bool                                            is_valid = false;
+
+    unsigned int                                    step_number;
+
+    double                                          step_size;
+
+    dealii::FullMatrix<double>                      local_matrix;
+
+    std::vector<std::vector<double>>                slip_rates;
+
+    std::vector<double>                             slip_resistances;
+
+    std::vector<std::vector<dealii::Tensor<1,dim>>> slip_gradients;
+  };
+
+  /*!
+   * @brief Cache of the local Jacobians indexed by the dense index of
+   * the locally owned cells, see @ref get_locally_owned_cell_index. See
+   * @ref RunTimeParameters::SolverParameters::flag_cache_local_jacobians
+   *
+   * @details Each entry is only accessed by the worker assembling the
+   * corresponding cell. Since the residual is always assembled
+   * exactly, a stale entry only affects the rate of convergence of
+   * the Newton-Raphson method.
+   */
+  std::vector<LocalJacobianCacheEntry>              local_jacobian_cache;
+
+  std::atomic<unsigned int>                         n_local_jacobian_cache_hits;
+
+  std::atomic<unsigned int>                         n_local_jacobian_cache_misses;
+
+  /*!
+   * @brief Copies the cached local Jacobian of @p cell into
+   * @p local_matrix if it was computed during the current time step
+   * and the slip rates and slip gradients stored in @p scratch as well
+   * as the trial @p slip_resistances are close enough to the cached
+   * ones.
+   *
+   * @details The cache is invalidated at each time step as the slip
+   * resistances are updated at the end of the previous one.
+   *
+   * @return Whether the cached local Jacobian was used
+   */
+  bool get_cached_local_jacobian(
+    const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+    const gCP::AssemblyData::Jacobian::Scratch<dim>               &scratch,
+    const dealii::ArrayView<const double>                         &slip_resistances,
+    dealii::FullMatrix<double>                                    &local_matrix);
+
+  /*!
+   * @brief Stores @p local_matrix together with the slip rates and
+   * slip gradients stored in @p scratch and the trial
+   * @p slip_resistances in the cache
+   */
+  void cache_local_jacobian(
+    const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+    const gCP::AssemblyData::Jacobian::Scratch<dim>               &scratch,
+    const dealii::ArrayView<const double>                         &slip_resistances,
+    const dealii::FullMatrix<double>                              &local_matrix);
+
+  /*!
+   * @brief Wrapper class exposing the cell-wise action of the Jacobian
+   * to deal.II's iterative solvers
+   *
+   * @details Used when @ref RunTimeParameters::KrylovParameters::flag_matrix_free
+   * is set. The global Jacobian matrix is never assembled.
+   */
+  class JacobianOperator
+  {
+  public:
+    JacobianOperator(GradientCrystalPlasticitySolver<dim> &solver);
+
+    void vmult(
+      dealii::LinearAlgebraTrilinos::MPI::Vector        &dst,
+      const dealii::LinearAlgebraTrilinos::MPI::Vector  &src) const;
+
+  private:
+    GradientCrystalPlasticitySolver<dim>  &solver;
+  };
+
+  /*!
+   * @brief Jacobi preconditioner of the matrix-free mode, i.e., the
+   * inverse of the Jacobian's diagonal
+   */
+  dealii::DiagonalMatrix<dealii::LinearAlgebraTrilinos::MPI::Vector>
+                                                    jacobi_preconditioner;
+
+  /*!
+   * @brief The source vector of @ref apply_jacobian with the
+   * constraints distributed
+   *
+   * @details Allocated in @ref init, as the Jacobian is applied once
+   * per Krylov iteration
+   */
+  dealii::LinearAlgebraTrilinos::MPI::Vector        distributed_src;
+
+  /*!
+   * @brief Ghosted copy of @ref distributed_src, from which the values
+   * of the neighbour cells at the grain boundaries are read
+   */
+  dealii::LinearAlgebraTrilinos::MPI::Vector        ghost_src;
+
+  /*!
+   * @brief Computes @p dst as the action of the Jacobian on @p src
+   * without assembling the global matrix.
+   *
+   * @details Constrained rows are treated as identity rows.
+   */
+  void apply_jacobian(
+    dealii::LinearAlgebraTrilinos::MPI::Vector        &dst,
+    const dealii::LinearAlgebraTrilinos::MPI::Vector  &src);
+
+  /*!
+   * @brief Computes the rows of the action of the Jacobian on
+   * @p src which belong to the cells of @p cell_batch from the tangent
+   * moduli stored in @ref local_jacobian_tangents
+   *
+   * @details The bulk integrals are evaluated with the sum-factorized
+   * kernels for all cells of the batch at once, i.e., the values and
+   * gradients of @p src are computed at the quadrature points,
+   * multiplied by the tangent moduli and tested with the shape
+   * functions without forming the local matrices. At the grain
+   * boundaries the values of the neighbour cell are read from @p src,
+   * which therefore has to be ghosted.
+   */
+  void apply_local_jacobian(
+    const CellBatch                                             &cell_batch,
+    gCP::AssemblyData::JacobianAction::Scratch<dim>             &scratch,
+    gCP::AssemblyData::CellBatchCopy<
+      gCP::AssemblyData::JacobianAction::Copy>                  &data,
+    const dealii::LinearAlgebraTrilinos::MPI::Vector            &src);
+
+  /*!
+   * @brief Multiplies the values of @p src at the quadrature points
+   * of @p cell, the lane @p lane of its cell batch, with the tangent
+   * moduli and sets the results as the fluxes of the lane. The grain
+   * boundary integrals of the cell are added to @p data.
+   */
+  void apply_local_jacobian(
+    const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+    const unsigned int                                            lane,
+    gCP::AssemblyData::JacobianAction::Scratch<dim>               &scratch,
+    gCP::AssemblyData::JacobianAction::Copy                       &data,
+    const dealii::LinearAlgebraTrilinos::MPI::Vector              &src);
+
+  /*!
+   * @brief The tangent moduli of the Jacobian at the quadrature points
+   * of a locally owned cell and of its grain boundary faces
+   *
+   * @details Only the moduli which depend on the state are stored.
+   * The stiffness tetrad, its contractions with the Schmid tensors,
+   * the Jacobians of a linear vectorial microstress law and the grain
+   * interaction moduli are constant per crystal, respectively per
+   * face, and are read from their owners.
+   */
+  struct LocalJacobianTangent
+  {
+    /*!
+     * @brief The Jacobian of the scalar microstresses w.r.t. the
+     * slips indexed as [(q_point * n_slips + alpha) * n_slips + beta]
+     */
+    std::vector<double>                             scalar_microstress_moduli;
+
+    /*!
+     * @brief The Jacobians of the vectorial microstresses indexed as
+     * [q_point * n_slips + slip_id]. Empty if the vectorial
+     * microstress law is linear.
+     */
+    std::vector<dealii::SymmetricTensor<2,dim>>     vectorial_microstress_moduli;
+
+    /*!
+     * @brief The derivative of the degraded cohesive traction and
+     * the contact traction w.r.t. the opening displacement indexed as
+     * [face * n_face_q_points + face_q_point], where the faces are
+     * numbered as in @ref get_grain_boundary_faces. Empty if
+     * decohesion is not allowed.
+     */
+    std::vector<dealii::SymmetricTensor<2,dim>>     macrotraction_moduli;
+
+    /*!
+     * @brief The degraded intra-grain Gateaux derivatives of the
+     * microscopic traction indexed as
+     * [((face * n_face_q_points + face_q_point) * n_slips + alpha) *
+     * n_slips + beta]. Empty if no microtractions are prescribed at
+     * the grain boundaries.
+     */
+    std::vector<double>                             intra_microtraction_moduli;
+
+    /*!
+     * @brief The degraded inter-grain Gateaux derivatives of the
+     * microscopic traction. Same layout as
+     * @ref intra_microtraction_moduli
+     */
+    std::vector<double>                             inter_microtraction_moduli;
+  };
+
+  /*!
+   * @brief The tangent moduli of the locally owned cells indexed by
+   * @ref get_locally_owned_cell_index
+   *
+   * @details Computed together with @ref jacobi_preconditioner, i.e.,
+   * once per Jacobian refresh. Their size per cell scales with the
+   * number of quadrature points instead of the squared number of
+   * local degrees of freedom.
+   */
+  std::vector<LocalJacobianTangent>                 local_jacobian_tangents;
+
+  /*!
+   * @brief Computes the tangent moduli of @p cell into
+   * @ref local_jacobian_tangents and the diagonal of its local
+   * Jacobian into data.local_dst_values
+   */
+  void assemble_local_jacobian_tangent(
+    const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+    gCP::AssemblyData::Jacobian::Scratch<dim>                     &scratch,
+    gCP::AssemblyData::JacobianAction::Copy                       &data);
+
+  /*!
+   * @brief Assembles the tangent moduli into
+   * @ref local_jacobian_tangents and the diagonal of the Jacobian, and
+   * stores the inverse of the latter in @ref jacobi_preconditioner
+   */
+  void assemble_jacobi_preconditioner();
+
+  /*!
+   * @brief Returns the relative difference between the actions of the
+   * matrix-free and of the assembled Jacobian on @p src
+   *
+   * @details Both are computed anew at the current trial solution. The
+   * constrained rows are excluded, as the matrix-free operator treats
+   * them as identity rows. It is only meant for testing the
+   * matrix-free mode, see Tests::SolverAccess, and therefore requires
+   * the Jacobian matrix, i.e.,
+   * @ref RunTimeParameters::KrylovParameters::flag_matrix_free has to
+   * be unset. The data of the matrix-free mode is released afterwards.
+   * The Jacobian matrix is overwritten, i.e., it is flagged to be
+   * reassembled by the nonlinear solver.
+   */
+  double compute_matrix_free_jacobian_error(
+    const dealii::LinearAlgebraTrilinos::MPI::Vector &src);
+
   double assemble_residual();
 
+  /*!
+   * @brief Assembles the local residual
+   *
+   * @details The contributions which are not affine in the solution are
+   * additionally stored in
+   * @ref AssemblyData::Residual::Copy::local_nonlinear_rhs. If
+   * @p flag_nonlinear_contributions_only is set, only those are
+   * assembled. If @p flag_update_quadrature_point_history is set, the
+   * slip resistances of the cell and the interface quadrature point
+   * history of its grain boundary faces are updated with the values
+   * evaluated for the residual.
+   */
+  void assemble_local_residual(
+    const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+    gCP::AssemblyData::Residual::Scratch<dim>                     &scratch,
+    gCP::AssemblyData::Residual::Copy                             &data,
+    const bool flag_nonlinear_contributions_only = false,
+    const bool flag_update_quadrature_point_history = false);
+
+  /*!
+   * @brief Sum-factorized counterpart of the above for the cells of
+   * @p cell_batch
+   *
+   * @details The slips and the displacement gradients of all cells are
+   * evaluated at once, each cell is then assembled as above and the
+   * bulk integrals of all cells are again evaluated at once.
+   */
+  void assemble_local_residual(
+    const CellBatch                                             &cell_batch,
+    gCP::AssemblyData::Residual::Scratch<dim>                   &scratch,
+    gCP::AssemblyData::CellBatchCopy<
+      gCP::AssemblyData::Residual::Copy>                        &data,
+    const bool flag_nonlinear_contributions_only,
+    const bool flag_update_quadrature_point_history);
+
+  /*!
+   * @brief Assembles the local residual using the already
+   * reinitialized @p fe_values and the slip values stored in
+   * @p scratch
+   *
+   * @details In the sum-factorized path the displacement gradients are
+   * also read from @p scratch and the bulk integrals are left to the
+   * caller, see @ref set_lane_bulk_residual_fluxes. The contributions
+   * of @ref AssemblyData::Residual::Copy::local_nonlinear_rhs are then
+   * not yet added to @ref AssemblyData::Residual::Copy::local_rhs.
+   *
+   * If @p flag_update_interface_quadrature_point_history is
+   * set and decohesion is allowed, the interface quadrature point
+   * history of each grain boundary face of the cell is computed into
+   * @ref AssemblyData::Residual::Scratch::interface_quadrature_point_history
+   * from its committed values and the trial solution. Both cells of a
+   * face compute it, but only the one of the face listed in
+   * @ref interface_grain_boundary_faces writes it into
+   * @ref interface_quadrature_point_history. The other one therefore
+   * never reads values which are written concurrently.
+   */
   void assemble_local_residual(
     const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+    const dealii::FEValues<dim>                                   &fe_values,
     gCP::AssemblyData::Residual::Scratch<dim>                     &scratch,
-    gCP::AssemblyData::Residual::Copy                             &data);
+    gCP::AssemblyData::Residual::Copy                             &data,
+    const bool flag_nonlinear_contributions_only = false,
+    const bool flag_update_interface_quadrature_point_history = false);
 
   void copy_local_to_global_residual(
     const gCP::AssemblyData::Residual::Copy &data);
 
+  /*!
+   * @brief The contributions to @ref residual which are not affine in
+   * the solution, i.e., those of the scalar microstress, of the
+   * cohesive and contact laws and, depending on the parameters, of the
+   * vectorial microstress and the microscopic traction.
+   *
+   * @details Only assembled if
+   * @ref RunTimeParameters::LineSearchParameters::flag_reuse_linear_contributions
+   * is set.
+   */
+  dealii::LinearAlgebraTrilinos::MPI::Vector        nonlinear_residual;
+
+  /*!
+   * @brief The affine part of the residual at the start of the line
+   * search, i.e., at a relaxation parameter equal to zero
+   */
+  dealii::LinearAlgebraTrilinos::MPI::Vector        linear_residual;
+
+  /*!
+   * @brief The increment of @ref linear_residual along the Newton
+   * update, i.e., the action of the linear part of the Jacobian on it
+   */
+  dealii::LinearAlgebraTrilinos::MPI::Vector        linear_residual_increment;
+
+  /*!
+   * @brief Stores the affine part of the last assembled residual in
+   * @ref linear_residual
+   */
+  void store_linear_residual();
+
+  /*!
+   * @brief Stores the difference between the affine part of the last
+   * assembled residual, that of a full Newton step, and
+   * @ref linear_residual in @ref linear_residual_increment
+   */
+  void store_linear_residual_increment();
+
+  /*!
+   * @brief Assembles the residual at the current trial solution of the
+   * line search.
+   *
+   * @details Only the nonlinear contributions are assembled. The affine
+   * ones are obtained from
+   * \f[
+   *    \mathbf{R}_{\text{lin}}(\mathbf{u} + \lambda \Delta \mathbf{u})
+   *    = \mathbf{R}_{\text{lin}}(\mathbf{u}) +
+   *      \lambda \mathbf{K}_{\text{lin}} \Delta \mathbf{u}
+   * \f]
+   * using @ref linear_residual and @ref linear_residual_increment.
+   *
+   * @return The same value as @ref assemble_residual
+   */
+  double assemble_line_search_residual(const double relaxation_parameter);
+
+  /*!
+   * @brief Returns true if the vectorial microstress is linear in the
+   * slip gradients, i.e., for a quadratic defect energy
+   */
+  bool vectorial_microstress_law_is_linear() const;
+
+  /*!
+   * @brief Returns true if the microscopic traction is linear in the
+   * slips, i.e., if it is not degraded by the damage variable
+   */
+  bool microscopic_traction_law_is_linear() const;
+
+  /*!
+   * @brief Updates the quadrature point history and assembles the
+   * residual and the Jacobian in a single sweep over the cells.
+   *
+   * @details Equivalent to calling
+   * @ref reset_and_update_quadrature_point_history,
+   * @ref assemble_residual and @ref assemble_jacobian in sequence, but
+   * the hp::FEValues instance is reinitialized and the slips are
+   * evaluated only once per cell. The interface quadrature point
+   * history is updated face-wise inside the same sweep, see
+   * @ref assemble_local_residual.
+   *
+   * @return The same value as @ref assemble_residual
+   */
+  double assemble_linear_system();
+
+  void assemble_local_linear_system(
+    const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+    gCP::AssemblyData::LinearSystem::Scratch<dim>                 &scratch,
+    gCP::AssemblyData::LinearSystem::Copy                         &data);
+
   void prepare_quadrature_point_history();
 
   void reset_quadrature_point_history();
 
+  /*!
+   * @brief Commits the slip resistances at the converged trial
+   * solution if they are stored compressed
+   *
+   * @details The compressed storage holds no trial values, see
+   * @ref QuadraturePointHistoryStorage. The committed values are
+   * therefore advanced once the time step converged, from the slips of
+   * the trial and of the old solution.
+   */
+  void commit_quadrature_point_history();
+
+  /*!
+   * @brief Returns the committed internal variables at a quadrature
+   * point of the grain boundary face @p interface_id
+   */
+  typename InterfaceQuadraturePointHistory<dim>::CommittedValues
+    get_committed_interface_values(const unsigned int interface_id,
+                                   const unsigned int face_q_point) const;
+
+  /*!
+   * @brief Sets the committed internal variables at a quadrature point
+   * of the grain boundary face @p interface_id
+   */
+  void set_committed_interface_values(
+    const unsigned int interface_id,
+    const unsigned int face_q_point,
+    const typename InterfaceQuadraturePointHistory<dim>::CommittedValues
+      &committed_values);
+
+  /*!
+   * @brief Updates the quadrature point history at the trial solution
+   *
+   * @details The slip resistances are updated cell-wise and the
+   * interface quadrature point history face-wise, i.e., once per entry
+   * of @ref interface_grain_boundary_faces. Not called if the
+   * assemblies update the history themselves, see
+   * @ref RunTimeParameters::ProblemParameters::flag_fused_history_update
+   */
   void reset_and_update_quadrature_point_history();
 
   void update_local_quadrature_point_history(
@@ -223,18 +1343,72 @@ private:
     gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>       &scratch,
     gCP::AssemblyData::QuadraturePointHistory::Copy               &data);
 
+  /*!
+   * @brief Updates the interface quadrature point history of
+   * @p grain_boundary_face at the trial solution
+   */
+  void update_local_interface_quadrature_point_history(
+    const GrainBoundaryFace                                   &grain_boundary_face,
+    gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>   &scratch);
+
+  /*!
+   * @brief Updates @p local_interface_quadrature_point_history, i.e.,
+   * the interface quadrature point history of @p grain_boundary_face,
+   * from its committed values and the given values at the face
+   * quadrature points
+   *
+   * @details Under cyclic loading the thermodynamic force depends on
+   * the trial damage variable stored in
+   * @p local_interface_quadrature_point_history prior to the update.
+   * The slip values only enter the latter.
+   */
+  void update_interface_quadrature_point_history(
+    const GrainBoundaryFace                   &grain_boundary_face,
+    const std::vector<dealii::Tensor<1,dim>>  &current_cell_displacement_values,
+    const std::vector<dealii::Tensor<1,dim>>  &neighbor_cell_displacement_values,
+    const std::vector<dealii::Tensor<1,dim>>  &normal_vector_values,
+    const std::vector<std::vector<double>>    &face_slip_values,
+    const std::vector<std::vector<double>>    &neighbor_face_slip_values,
+    const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+      &local_interface_quadrature_point_history) const;
+
+  /*!
+   * @brief Stores the trial damage variables of
+   * @ref interface_quadrature_point_history in
+   * @ref trial_interface_damage_variables
+   *
+   * @details Called before each assembly updating the interface
+   * quadrature point history. Only needed under cyclic loading, see
+   * @ref update_interface_quadrature_point_history
+   */
+  void store_trial_interface_damage_variables();
+
   void store_effective_opening_displacement_in_quadrature_history();
 
   void store_local_effective_opening_displacement(
-    const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
-    gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>       &scratch,
-    gCP::AssemblyData::QuadraturePointHistory::Copy               &data);
+    const GrainBoundaryFace                                   &grain_boundary_face,
+    gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>   &scratch);
 
   void copy_local_to_global_quadrature_point_history(
     const gCP::AssemblyData::QuadraturePointHistory::Copy &){};
 
   unsigned int solve_linearized_system();
 
+  /*!
+   * @brief Returns true if the Jacobian is to be reassembled in the
+   * next Newton iteration, i.e., if the line search had to backtrack
+   * or if the contraction factor @p current_residual_norm /
+   * @p previous_residual_norm exceeds
+   * @ref RunTimeParameters::NewtonRaphsonParameters::jacobian_refresh_threshold.
+   * A growing or undefined contraction factor also triggers it.
+   *
+   * @details Shared by the Newton-Raphson loops of
+   * @ref solve_nonlinear_system and @ref compute_initial_guess. See
+   * @ref flag_refresh_jacobian
+   */
+  bool needs_jacobian_refresh(const double current_residual_norm,
+                              const double previous_residual_norm) const;
+
   bool compute_initial_guess();
 
   void update_trial_solution(const double relaxation_parameter);
@@ -344,6 +1518,219 @@ GradientCrystalPlasticitySolver<dim>::get_residual() const
 
 
 
+template <int dim>
+inline dealii::ArrayView<
+  const typename GradientCrystalPlasticitySolver<dim>::GrainBoundaryFace>
+GradientCrystalPlasticitySolver<dim>::get_grain_boundary_faces(
+  const unsigned int active_cell_index) const
+{
+  AssertIndexRange(active_cell_index + 1,
+                   grain_boundary_faces_offsets.size());
+
+  return (dealii::ArrayView<const GrainBoundaryFace>(
+    grain_boundary_faces.data() +
+      grain_boundary_faces_offsets[active_cell_index],
+    grain_boundary_faces_offsets[active_cell_index + 1] -
+      grain_boundary_faces_offsets[active_cell_index]));
+}
+
+
+
+template <int dim>
+inline typename InterfaceQuadraturePointHistory<dim>::CommittedValues
+GradientCrystalPlasticitySolver<dim>::get_committed_interface_values(
+  const unsigned int interface_id,
+  const unsigned int face_q_point) const
+{
+  return (typename InterfaceQuadraturePointHistory<dim>::CommittedValues{
+            interface_quadrature_point_history.get_committed_value(
+              interface_id, face_q_point, 0),
+            interface_quadrature_point_history.get_committed_value(
+              interface_id, face_q_point, 1),
+            interface_quadrature_point_history.get_committed_value(
+              interface_id, face_q_point, 2)});
+}
+
+
+
+template <int dim>
+inline void
+GradientCrystalPlasticitySolver<dim>::set_committed_interface_values(
+  const unsigned int interface_id,
+  const unsigned int face_q_point,
+  const typename InterfaceQuadraturePointHistory<dim>::CommittedValues
+    &committed_values)
+{
+  interface_quadrature_point_history.set_committed_value(
+    interface_id, face_q_point, 0, committed_values.damage_variable);
+
+  interface_quadrature_point_history.set_committed_value(
+    interface_id, face_q_point, 1,
+    committed_values.max_effective_opening_displacement);
+
+  interface_quadrature_point_history.set_committed_value(
+    interface_id, face_q_point, 2,
+    committed_values.old_effective_opening_displacement);
+}
+
+
+
+template <int dim>
+inline unsigned int
+GradientCrystalPlasticitySolver<dim>::get_locally_owned_cell_index(
+  const unsigned int active_cell_index) const
+{
+  AssertIndexRange(active_cell_index, locally_owned_cell_indices.size());
+  Assert(locally_owned_cell_indices[active_cell_index] !=
+           dealii::numbers::invalid_unsigned_int,
+         dealii::ExcMessage("The cell is not locally owned."));
+
+  return (locally_owned_cell_indices[active_cell_index]);
+}
+
+
+
+template <int dim>
+inline bool
+GradientCrystalPlasticitySolver<dim>::vectorial_microstress_law_is_linear() const
+{
+  return (parameters.constitutive_laws_parameters.
+            vectorial_microstress_law_parameters.defect_energy_index == 2.0);
+}
+
+
+
+template <int dim>
+inline bool
+GradientCrystalPlasticitySolver<dim>::microscopic_traction_law_is_linear() const
+{
+  return (!(fe_field->is_decohesion_allowed() &&
+            parameters.constitutive_laws_parameters.
+              cohesive_law_parameters.flag_couple_microtraction_to_damage));
+}
+
+
+
+template <int dim>
+inline GradientCrystalPlasticitySolver<dim>::JacobianOperator::
+JacobianOperator(GradientCrystalPlasticitySolver<dim> &solver)
+:
+solver(solver)
+{}
+
+
+
+template <int dim>
+inline void
+GradientCrystalPlasticitySolver<dim>::JacobianOperator::vmult(
+  dealii::LinearAlgebraTrilinos::MPI::Vector        &dst,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector  &src) const
+{
+  solver.apply_jacobian(dst, src);
+}
+
+
+
+template <int dim>
+template <typename Worker,
+          typename Copier,
+          typename ScratchData,
+          typename CopyData>
+inline void
+GradientCrystalPlasticitySolver<dim>::run_work_stream(
+  const dealii::DoFHandler<dim>                     &dof_handler,
+  const std::vector<std::vector<
+    typename dealii::DoFHandler<dim>::active_cell_iterator>>
+                                                    &cell_colors,
+  const std::string                                 &assembly_name,
+  const Worker                                      &worker,
+  const Copier                                      &copier,
+  const ScratchData                                 &scratch,
+  const CopyData                                    &copy) const
+{
+  using CellFilter =
+    dealii::FilteredIterator<
+      typename dealii::DoFHandler<dim>::active_cell_iterator>;
+
+  dealii::TimerOutput::Scope  t(
+    *timer_output,
+    "Solver: " +
+    std::string(parameters.flag_colored_assembly ?
+                  "Colored " : "Serial copier ") +
+    assembly_name + " on " +
+    std::to_string(dealii::MultithreadInfo::n_threads()) + " threads");
+
+  if (parameters.flag_colored_assembly)
+    dealii::WorkStream::run(cell_colors,
+                            worker,
+                            copier,
+                            scratch,
+                            copy);
+  else
+    dealii::WorkStream::run(
+      CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
+                 dof_handler.begin_active()),
+      CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
+                 dof_handler.end()),
+      worker,
+      copier,
+      scratch,
+      copy);
+}
+
+
+
+template <int dim>
+template <typename Worker,
+          typename Copier,
+          typename ScratchData,
+          typename CopyData>
+inline void
+GradientCrystalPlasticitySolver<dim>::run_work_stream(
+  const std::vector<CellBatch>                      &batches,
+  const std::vector<std::vector<CellBatch>>         &colored_batches,
+  const std::string                                 &assembly_name,
+  const Worker                                      &worker,
+  const Copier                                      &copier,
+  const ScratchData                                 &scratch,
+  const CopyData                                    &copy) const
+{
+  dealii::TimerOutput::Scope  t(
+    *timer_output,
+    "Solver: " +
+    std::string(parameters.flag_colored_assembly ?
+                  "Colored " : "Serial copier ") +
+    assembly_name + " on " +
+    std::to_string(dealii::MultithreadInfo::n_threads()) + " threads");
+
+  if (parameters.flag_colored_assembly)
+  {
+    std::vector<std::vector<CellBatchIterator>> batch_colors(
+      colored_batches.size());
+
+    for (unsigned int color = 0; color < colored_batches.size(); ++color)
+      for (auto cell_batch = colored_batches[color].begin();
+           cell_batch != colored_batches[color].end();
+           ++cell_batch)
+        batch_colors[color].push_back(cell_batch);
+
+    dealii::WorkStream::run(batch_colors,
+                            worker,
+                            copier,
+                            scratch,
+                            copy);
+  }
+  else
+    dealii::WorkStream::run(batches.begin(),
+                            batches.end(),
+                            worker,
+                            copier,
+                            scratch,
+                            copy);
+}
+
+
+
 }  // namespace gCP
 
 
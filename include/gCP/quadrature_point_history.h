@@ -3,8 +3,15 @@
 
 #include <gCP/run_time_parameters.h>
 
+#include <deal.II/base/array_view.h>
+
 #include <deal.II/distributed/tria.h>
 
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <map>
 
 namespace gCP
@@ -12,6 +19,208 @@ namespace gCP
 
 
 
+namespace ConstitutiveLaws
+{
+  template <int dim>
+  class CohesiveLaw;
+} // namespace ConstitutiveLaws
+
+
+
+/*!
+ * @brief Buffer of the history values committed at the end of a time
+ * step
+ *
+ * @details The values are stored in the format given by
+ * @ref RunTimeParameters::HistoryStoragePrecision. In the reduced
+ * formats each value is encoded in a 32-bit word, either as a float or
+ * as a signed fixed-point number with the resolution
+ * @ref fixed_point_resolution. @ref get returns the decoded value,
+ * i.e., the one actually stored, such that the computations of the
+ * next time step start from it.
+ */
+class HistoryBuffer
+{
+public:
+  /*!
+   * @brief Default constructor
+   */
+  HistoryBuffer();
+
+  /*!
+   * @brief Allocates @p n_values values and sets them to zero
+   *
+   * @param n_values The number of values
+   * @param precision The format of the values
+   * @param fixed_point_resolution The resolution of the fixed-point
+   * format
+   */
+  void reinit(
+    const std::size_t                                 n_values,
+    const RunTimeParameters::HistoryStoragePrecision  precision,
+    const double                                      fixed_point_resolution);
+
+  /*!
+   * @brief Returns the number of values
+   */
+  std::size_t size() const;
+
+  /*!
+   * @brief Returns true if the values are encoded in 32-bit words
+   */
+  bool is_compressed() const;
+
+  /*!
+   * @brief Returns the (decoded) value at @p index
+   */
+  double get(const std::size_t index) const;
+
+  /*!
+   * @brief Stores @p value at @p index in the format of the buffer
+   */
+  void set(const std::size_t index, const double value);
+
+  /*!
+   * @brief Returns the memory consumption of the buffer in bytes
+   */
+  std::size_t memory_consumption() const;
+
+private:
+  /*!
+   * @brief The format of the values
+   */
+  RunTimeParameters::HistoryStoragePrecision  precision;
+
+  /*!
+   * @brief The resolution of the fixed-point format
+   */
+  double                                      fixed_point_resolution;
+
+  /*!
+   * @brief The values in double precision. Empty in the reduced
+   * formats
+   */
+  std::vector<double>                         values;
+
+  /*!
+   * @brief The values encoded in the format given by @ref precision.
+   * Empty in double precision
+   */
+  std::vector<std::int32_t>                   codes;
+
+  /*!
+   * @brief Encodes a value in the format given by @ref precision
+   */
+  std::int32_t encode(const double value) const;
+
+  /*!
+   * @brief Decodes a value encoded by @ref encode
+   */
+  double decode(const std::int32_t code) const;
+};
+
+
+
+inline std::size_t
+HistoryBuffer::size() const
+{
+  return (is_compressed() ? codes.size() : values.size());
+}
+
+
+
+inline bool
+HistoryBuffer::is_compressed() const
+{
+  return (precision != RunTimeParameters::HistoryStoragePrecision::Double);
+}
+
+
+
+inline double
+HistoryBuffer::get(const std::size_t index) const
+{
+  AssertIndexRange(index, size());
+
+  if (is_compressed())
+    return (decode(codes[index]));
+
+  return (values[index]);
+}
+
+
+
+inline void
+HistoryBuffer::set(const std::size_t index, const double value)
+{
+  AssertIndexRange(index, size());
+
+  if (is_compressed())
+    codes[index] = encode(value);
+  else
+    values[index] = value;
+}
+
+
+
+inline std::int32_t
+HistoryBuffer::encode(const double value) const
+{
+  switch (precision)
+  {
+  case RunTimeParameters::HistoryStoragePrecision::Single:
+    {
+      const float single_precision_value = static_cast<float>(value);
+
+      std::int32_t code;
+
+      std::memcpy(&code, &single_precision_value, sizeof(code));
+
+      return (code);
+    }
+  case RunTimeParameters::HistoryStoragePrecision::FixedPoint:
+    {
+      const double code = std::round(value / fixed_point_resolution);
+
+      AssertThrow(
+        std::fabs(code) <= std::numeric_limits<std::int32_t>::max(),
+        dealii::ExcMessage("The history value exceeds the range of "
+                           "the fixed-point format. Increase its "
+                           "resolution."));
+
+      return (static_cast<std::int32_t>(code));
+    }
+  default:
+    Assert(false, dealii::ExcInternalError());
+    return (0);
+  }
+}
+
+
+
+inline double
+HistoryBuffer::decode(const std::int32_t code) const
+{
+  switch (precision)
+  {
+  case RunTimeParameters::HistoryStoragePrecision::Single:
+    {
+      float single_precision_value;
+
+      std::memcpy(&single_precision_value, &code, sizeof(code));
+
+      return (single_precision_value);
+    }
+  case RunTimeParameters::HistoryStoragePrecision::FixedPoint:
+    return (code * fixed_point_resolution);
+  default:
+    Assert(false, dealii::ExcInternalError());
+    return (0.0);
+  }
+}
+
+
+
 /*!
  * @brief
  *
@@ -54,81 +263,143 @@ inline double InterfaceData<dim>::get_value() const
 
 
 /*!
- * @brief
+ * @brief The internal variables of the cohesive zone model at a
+ * quadrature point of a grain boundary
  *
- * @tparam dim
- * @todo Docu
+ * @details An instance only holds the trial values of the internal
+ * variables. The values committed at the end of a time step, see
+ * @ref CommittedValues, are stored by the @ref InterfaceDataStorage
+ * in the format given by
+ * @ref RunTimeParameters::HistoryStoragePrecision and passed to the
+ * methods which need them. The trial values can not be recomputed
+ * from the committed ones on demand, as the damage evolution under
+ * cyclic loading depends on the trial damage variable of the previous
+ * iteration through the thermodynamic force. The parameters of the
+ * cohesive law are taken from the
+ * @ref ConstitutiveLaws::CohesiveLaw instance passed to the methods.
+ *
+ * @tparam dim Spatial dimension
  */
 template <int dim>
 class InterfaceQuadraturePointHistory
 {
 public:
+  /*!
+   * @brief The internal variables committed at the end of a time step
+   */
+  struct CommittedValues
+  {
+    double damage_variable;
 
-  InterfaceQuadraturePointHistory();
+    double max_effective_opening_displacement;
+
+    /*!
+     * @brief The effective opening displacement of the last converged
+     * time step. See @ref store_effective_opening_displacement
+     */
+    double old_effective_opening_displacement;
+  };
+
+  /*!
+   * @brief The number of values of @ref CommittedValues
+   */
+  static constexpr unsigned int n_committed_values = 3;
 
-  virtual ~InterfaceQuadraturePointHistory() = default;
+  InterfaceQuadraturePointHistory();
 
   double get_damage_variable() const;
 
   double get_max_effective_opening_displacement() const;
 
-  void init(
-    const RunTimeParameters::CohesiveLawParameters &parameters);
-
   void set(const double damage_variable_value);
 
-  void store_current_values();
+  /*!
+   * @brief Returns the trial values to be committed. The old effective
+   * opening displacement is taken over from @p committed_values, as it
+   * is committed by @ref store_effective_opening_displacement
+   */
+  CommittedValues get_values_to_commit(
+    const CommittedValues &committed_values) const;
 
-  void reset_values();
+  /*!
+   * @brief Resets the trial values to the committed ones
+   */
+  void reset_values(const CommittedValues &committed_values);
 
   void update_values(
-    const dealii::Tensor<1,dim> neighbor_cell_displacement,
-    const dealii::Tensor<1,dim> current_cell_displacement);
-  /*
-  void update_values(
-    const double  effective_opening_displacement,
-    const double  cohesive_traction_norm);
-  */
+    const dealii::Tensor<1,dim>                   neighbor_cell_displacement,
+    const dealii::Tensor<1,dim>                   current_cell_displacement,
+    const CommittedValues                         &committed_values,
+    const ConstitutiveLaws::CohesiveLaw<dim>      &cohesive_law);
 
   void update_values(
-    const double  effective_opening_displacement,
-    const double  thermodynamic_force);
+    const double                                  effective_opening_displacement,
+    const double                                  thermodynamic_force,
+    const CommittedValues                         &committed_values,
+    const ConstitutiveLaws::CohesiveLaw<dim>      &cohesive_law);
 
   void update_values(
-    const double  effective_opening_displacement);
+    const double                                  effective_opening_displacement,
+    const CommittedValues                         &committed_values);
 
   /*!
-   * @brief Computes the effective opening displacement and stores it
-   * in @ref old_effective_opening_displacement.
+   * @brief Computes the effective opening displacement, which is to
+   * be committed as
+   * @ref CommittedValues::old_effective_opening_displacement.
    *
    * @details This method is to be called at the end of each pseudo-time
    * iteration. It is needed as the effective opening displacement is
    * dependent of the normal vector when the material is anisotropic,
-   * i.e., @ref tangential_to_normal_stiffness_ratio is different than
+   * i.e., the tangential to normal stiffness ratio is different than
    * zero
    *
    * @param neighbor_cell_displacement
    * @param current_cell_displacement
    * @param normal_vector
+   * @param effective_cohesive_traction
+   * @param cohesive_law
+   * @return The effective opening displacement
    * @todo Docu
    */
-  void store_effective_opening_displacement(
-    const dealii::Tensor<1,dim> neighbor_cell_displacement,
-    const dealii::Tensor<1,dim> current_cell_displacement,
-    const dealii::Tensor<1,dim> normal_vector);
+  double store_effective_opening_displacement(
+    const dealii::Tensor<1,dim>               neighbor_cell_displacement,
+    const dealii::Tensor<1,dim>               current_cell_displacement,
+    const dealii::Tensor<1,dim>               normal_vector,
+    const double                              effective_cohesive_traction,
+    const ConstitutiveLaws::CohesiveLaw<dim>  &cohesive_law);
 
   /*!
-   * @brief Temporary method
+   * @brief The number of values written by @ref pack_values
    */
-  void store_effective_opening_displacement(
-    const dealii::Tensor<1,dim> neighbor_cell_displacement,
-    const dealii::Tensor<1,dim> current_cell_displacement,
-    const dealii::Tensor<1,dim> normal_vector,
-    const double                effective_cohesive_traction);
+  static constexpr unsigned int n_packed_values = 3;
 
-  // The methods
-  double get_old_effective_opening_displacement() const;
+  /*!
+   * @brief Appends the internal variables at the current state to
+   * @p values, e.g., for checkpointing.
+   */
+  void pack_values(std::vector<double>    &values,
+                   const CommittedValues  &committed_values) const;
+
+  /*!
+   * @brief Sets the internal variables from the first
+   * @ref n_packed_values entries of @p values. See @ref pack_values
+   *
+   * @details The values are taken as the committed state, i.e., they
+   * are also returned to be stored as the committed values.
+   */
+  CommittedValues unpack_values(const dealii::ArrayView<const double> values);
+
+  /*!
+   * @brief Bounds the packed values of several quadrature points, given
+   * one after the other in @p values, to their admissible ranges, e.g.,
+   * after their projection between coarsened and refined faces.
+   *
+   * @details The damage variable is bounded to [0,1] and the opening
+   * displacements to non-negative values.
+   */
+  static void bound_packed_values(std::vector<double> &values);
 
+  // The methods
   double get_effective_cohesive_traction() const;
 
   double get_effective_opening_displacement() const;
@@ -136,28 +407,10 @@ public:
   // are temporary and will be deleted eventually.
 
 private:
-  double                    critical_cohesive_traction;
-
-  double                    critical_opening_displacement;
-
-  double                    tangential_to_normal_stiffness_ratio;
-
-  double                    damage_accumulation_constant;
-
-  double                    damage_decay_constant;
-
-  double                    damage_decay_exponent;
-
-  double                    endurance_limit;
-
   double                    damage_variable;
 
   double                    max_effective_opening_displacement;
 
-  double                    old_effective_opening_displacement;
-
-  std::vector<double>       tmp_scalar_values;
-
   // The variables
   double                    effective_opening_displacement;
 
@@ -169,16 +422,7 @@ private:
 
   // are temporary and will be deleted eventually.
 
-  bool                      flag_set_damage_to_zero;
-
-  bool                      flag_values_were_updated;
-
-  bool                      flag_init_was_called;
-
   double macaulay_brackets(const double value) const;
-
-  double get_master_relation(
-    const double effective_opening_displacement) const;
 };
 
 
@@ -201,15 +445,6 @@ get_max_effective_opening_displacement() const
 
 
 
-template <int dim>
-inline double InterfaceQuadraturePointHistory<dim>::
-get_old_effective_opening_displacement() const
-{
-  return (old_effective_opening_displacement);
-}
-
-
-
 template <int dim>
 inline double InterfaceQuadraturePointHistory<dim>::
 get_effective_cohesive_traction() const
@@ -241,163 +476,477 @@ InterfaceQuadraturePointHistory<dim>::macaulay_brackets(
 
 
 
+/*!
+ * @brief Contiguous storage of the slip resistances of all quadrature
+ * points of the locally owned cells.
+ *
+ * @details Counterpart of a dealii::CellDataStorage of per quadrature
+ * point instances laid out as a structure of arrays. The values are indexed by (active cell index, quadrature
+ * point, slip). The active cell indices of the locally owned cells are
+ * mapped to a dense local numbering, such that no memory is spent on
+ * ghost and artificial cells. The values are stored in two buffers:
+ * one holds the trial values, which are updated during the
+ * Newton-Raphson iterations, and the other one the committed values of
+ * the last converged time step.
+ * Since each quadrature point owns a disjoint range of the buffers,
+ * the entries of different cells can be accessed concurrently, e.g.,
+ * by the workers of a dealii::WorkStream.
+ *
+ * The trial values of a cell are only valid if they were updated
+ * during the current epoch. Otherwise the committed values are
+ * returned in their place. Resetting the trial values thus amounts to
+ * starting a new epoch and committing them to swapping the roles of
+ * the buffers, instead of copying the values of every quadrature
+ * point.
+ *
+ * If a reduced @ref RunTimeParameters::HistoryStoragePrecision is
+ * chosen, only the committed values are stored, compressed in a
+ * @ref HistoryBuffer. The trial values are not stored at all. They are
+ * recomputed from the decoded committed values and the slip increments
+ * whenever they are needed, see @ref get_slip_resistances, and
+ * committed by @ref commit_values once the time step converged. The
+ * storage thus needs 4 instead of 16 bytes per value. All computations
+ * are carried out in double precision.
+ *
+ * @tparam dim Spatial dimension
+ */
 template <int dim>
-inline double
-InterfaceQuadraturePointHistory<dim>::get_master_relation(
-  const double effective_opening_displacement) const
-{
-  return (critical_cohesive_traction *
-          effective_opening_displacement /
-          critical_opening_displacement *
-          std::exp(1.0 - effective_opening_displacement /
-                         critical_opening_displacement));
-}
-
-
-
-template <int dim>
-struct QuadraturePointHistory
+class QuadraturePointHistoryStorage
 {
 public:
   /*!
    * @brief Default constructor
+   */
+  QuadraturePointHistoryStorage();
+
+  /*!
+   * @brief Numbers the locally owned cells of @p triangulation,
+   * allocates the buffers and sets all slip resistances to zero
+   *
+   * @details It has to be called again whenever the triangulation
+   * changes.
    *
+   * @param parameters The material parameters of the evolution
+   * equation
+   * @param triangulation The triangulation whose locally owned cells
+   * are stored
+   * @param n_q_points The number of quadrature points per cell
+   * @param n_slips The number of slip systems of the crystals
+   * @param precision The format of the committed values
+   * @param fixed_point_resolution The resolution of the fixed-point
+   * format
    */
-  QuadraturePointHistory();
+  void initialize(
+    const RunTimeParameters::ScalarMicroscopicStressLawParameters
+      &parameters,
+    const dealii::Triangulation<dim> &triangulation,
+    const unsigned int n_q_points,
+    const unsigned int n_slips,
+    const RunTimeParameters::HistoryStoragePrecision precision =
+      RunTimeParameters::HistoryStoragePrecision::Double,
+    const double fixed_point_resolution = 1e-6);
 
   /*!
-   * @brief Default destructor
+   * @brief Returns the trial slip resistance of a slip system at a
+   * quadrature point
    *
+   * @details If the committed values are compressed the trial values
+   * are not stored and the committed value is returned instead. It
+   * equals the trial value once the time step was committed, e.g.,
+   * when writing a checkpoint.
    */
-  virtual ~QuadraturePointHistory() = default;
+  double get_slip_resistance(const unsigned int cell_index,
+                             const unsigned int q_point,
+                             const unsigned int slip_id) const;
 
   /*!
-   * @brief Get the slip resistance value at the quadrature point
-   * of a slip system
+   * @brief Returns a view to the trial slip resistances of all slip
+   * systems at a quadrature point
    *
-   * @param slip_id The id number of the slip system
-   * @return double The slip resistance value corresponding to
-   * @ref slip_id
+   * @details Only available if the committed values are stored in
+   * double precision.
    */
-  double get_slip_resistance(const unsigned int slip_id) const;
+  dealii::ArrayView<const double> get_slip_resistances(
+    const unsigned int cell_index,
+    const unsigned int q_point) const;
 
   /*!
-   * @brief Get the slip resistance value at the quadrature point
-   * of all slip systems
+   * @brief Returns a view to the trial slip resistances of all slip
+   * systems at all quadrature points of a cell, indexed by quadrature
+   * point and slip
    *
-   * @return std::vector<double> The slip resistance value of all
-   * slip systems
+   * @details Only available if the committed values are stored in
+   * double precision.
    */
-  std::vector<double> get_slip_resistances() const;
+  dealii::ArrayView<const double> get_slip_resistances(
+    const unsigned int cell_index) const;
 
   /*!
-   * @brief Initiates the @ref QuadraturePointHistory instance
+   * @brief Returns a view to the trial slip resistances of all slip
+   * systems at all quadrature points of a cell, indexed by quadrature
+   * point and slip
    *
-   * @param parameters The material parameters of the evolution
-   * equation
-   * @param n_slips The number of slip systems of the crystal
+   * @details In double precision this is the view returned by the
+   * overload above, i.e., @ref update_values has to be called
+   * beforehand. If the committed values are compressed the trial values
+   * are computed into @p slip_resistances from the decoded committed
+   * values and the slip increments.
+   *
+   * @param cell_index The active cell index of the cell
+   * @param slips The slip values at t^{n}
+   * @param old_slips The slip values at t^{n-1}
+   * @param slip_resistances Storage of the computed values
    */
-  void init(
-    const RunTimeParameters::ScalarMicroscopicStressLawParameters
-      &parameters,
-    const unsigned int n_slips);
+  dealii::ArrayView<const double> get_slip_resistances(
+    const unsigned int                      cell_index,
+    const std::vector<std::vector<double>>  &slips,
+    const std::vector<std::vector<double>>  &old_slips,
+    std::vector<double>                     &slip_resistances) const;
+
+  /*!
+   * @brief Returns the committed slip resistance of a slip system at a
+   * quadrature point
+   */
+  double get_committed_slip_resistance(const unsigned int cell_index,
+                                       const unsigned int q_point,
+                                       const unsigned int slip_id) const;
 
   /*!
-   * @brief Stores the values of @ref slip_resistances in @ref
-   * tmp_slip_resistances
+   * @brief Sets both the trial and the committed slip resistances of
+   * all slip systems at a quadrature point, e.g., when restarting from
+   * a checkpoint
    *
-   * @details The values are stored in order to reset
-   * @ref slip_resistances in @ref update_values
+   * @details It has to be called for all quadrature points of the cell,
+   * as the buffers of the cell are flagged as holding the same values.
+   */
+  void set_slip_resistances(
+    const unsigned int                      cell_index,
+    const unsigned int                      q_point,
+    const dealii::ArrayView<const double>   slip_resistances);
+
+  /*!
+   * @brief Commits the trial slip resistances of all quadrature points
+   *
+   * @details The buffers swap their roles. Only the cells whose trial
+   * values are outdated but differ from the committed ones, i.e., which
+   * were updated in a previous epoch but not in the current one, are
+   * copied. Nothing is done if the committed values are compressed, as
+   * they are then committed by @ref commit_values.
    */
   void store_current_values();
 
   /*!
-   * @brief Resets the values of @ref slip_resistances back to the value
-   * stored in @ref tmp_slip_resistances
+   * @brief Resets the trial slip resistances of all quadrature points
+   * to the committed ones by starting a new epoch
    */
   void reset_values();
 
   /*!
-   * @brief Updates the slip resistance values at the quadratue point
+   * @brief Commits the slip resistances at a quadrature point computed
+   * from the committed ones and the slip increments
    *
-   * @details The slip resitance values at the quadrature point @ref
-   * q_point are computed using the temporally discretized evolution
-   * equation
+   * @details Only to be used if the committed values are compressed.
+   * It has to be called once per quadrature point and time step with
+   * the converged slip values.
+   *
+   * @param cell_index The active cell index of the cell
+   * @param q_point The quadrature point
+   * @param slips The slip values at t^{n}
+   * @param old_slips The slip values at t^{n-1}
+   */
+  void commit_values(
+    const unsigned int                      cell_index,
+    const unsigned int                      q_point,
+    const std::vector<std::vector<double>>  &slips,
+    const std::vector<std::vector<double>>  &old_slips);
+
+  /*!
+   * @brief Returns true if the committed values are compressed, i.e.,
+   * if the trial values are not stored
+   */
+  bool is_compressed() const;
+
+  /*!
+   * @brief Returns the memory consumption of the buffers in bytes
+   */
+  std::size_t memory_consumption() const;
+
+  /*!
+   * @brief Updates the trial slip resistances at a quadrature point
+   *
+   * @details The trial slip resistances are computed from the
+   * committed ones using the temporally discretized evolution equation
    *
    * \f[
    *    g^{n}_{\alpha} =
    *     g^{n-1}_{\alpha} +
    *     \sum_1^{\text{n_slips}} h_{\alpha\beta}
-   *      \abs{\gamma^{n}_{\alpha} - \gamma^{n-1}_{\alpha}}
+   *      \abs{\gamma^{n}_{\beta} - \gamma^{n-1}_{\beta}}
    * \f]
    *
+   * Marks the trial values of the whole cell as valid for the
+   * current epoch. It therefore has to be called for all quadrature
+   * points of the cell before its values are read. The common numbers
+   * of slip systems are dispatched to specializations sized at compile
+   * time, see @ref Utilities::dispatch_n_slips. Nothing is done if the
+   * committed values are compressed.
+   *
+   * @param cell_index The active cell index of the cell
    * @param q_point The quadrature point at which the slip resitance
    * values are updated
    * @param slips The slip values at t^{n}
    * @param old_slips The slip values at t^{n-1}
-   * @todo Docu
    */
   void update_values(
+    const unsigned int                      cell_index,
     const unsigned int                      q_point,
     const std::vector<std::vector<double>>  &slips,
     const std::vector<std::vector<double>>  &old_slips);
 
 private:
-  unsigned int        n_slips;
-
-  double              initial_slip_resistance;
+  /*!
+   * @brief The number of locally owned cells
+   */
+  unsigned int        n_cells;
 
-  std::vector<double> slip_resistances;
+  unsigned int        n_q_points;
 
-  std::vector<double> tmp_slip_resistances;
+  unsigned int        n_slips;
 
   double              linear_hardening_modulus;
 
   double              hardening_parameter;
 
-  bool                flag_init_was_called;
+  /*!
+   * @brief The two buffers of slip resistances. Empty if the committed
+   * values are compressed
+   */
+  std::array<std::vector<double>, 2>  buffers;
+
+  /*!
+   * @brief The compressed committed slip resistances. Empty in double
+   * precision
+   */
+  HistoryBuffer                       compressed_buffer;
+
+  /*!
+   * @brief The index of the buffer holding the committed values
+   */
+  unsigned int                        committed_buffer_id;
+
+  /*!
+   * @brief The current epoch. It is incremented each time the trial
+   * values are reset or committed
+   */
+  unsigned int                        epoch;
+
+  /*!
+   * @brief The epoch at which the trial values of each cell were last
+   * updated. dealii::numbers::invalid_unsigned_int flags cells whose
+   * buffers hold the same values
+   */
+  std::vector<unsigned int>           cell_epochs;
+
+  /*!
+   * @brief The local index of each active cell.
+   * dealii::numbers::invalid_unsigned_int flags the cells which are not
+   * locally owned
+   */
+  std::vector<unsigned int>           local_cell_indices;
+
+  bool                                flag_init_was_called;
+
+  /*!
+   * @brief Returns the local index of the cell with the active cell
+   * index @p cell_index
+   */
+  unsigned int get_local_cell_index(const unsigned int cell_index) const;
+
+  /*!
+   * @brief Returns the position of the first slip resistance of a
+   * quadrature point inside the buffers
+   */
+  std::size_t get_offset(const unsigned int cell_index,
+                         const unsigned int q_point) const;
+
+  /*!
+   * @brief Returns the buffer holding the trial values of the cell
+   */
+  const std::vector<double> &get_trial_buffer(
+    const unsigned int cell_index) const;
+
+  /*!
+   * @brief Increments @ref epoch
+   */
+  void start_new_epoch();
+
+  /*!
+   * @brief Computes the trial slip resistances at a quadrature point
+   * for @p n_slips_at_compile_time slip systems or, if it is zero, for
+   * the number of slip systems given at run time
+   *
+   * @details This is the only place where the evolution equation is
+   * evaluated, see @ref update_values. Each trial value is passed to
+   * @p set_trial_value together with its slip system right after it
+   * was computed. Only the committed value of the slip system at hand
+   * enters it, i.e., @p set_trial_value may overwrite the committed
+   * values.
+   */
+  template <unsigned int n_slips_at_compile_time, typename TrialValueSetter>
+  void compute_trial_values(
+    const unsigned int                      cell_index,
+    const unsigned int                      q_point,
+    const std::vector<std::vector<double>>  &slips,
+    const std::vector<std::vector<double>>  &old_slips,
+    const TrialValueSetter                  &set_trial_value) const;
+
+  /*!
+   * @brief Dispatches @ref compute_trial_values to the specialization
+   * of the number of slip systems, see
+   * @ref Utilities::dispatch_n_slips
+   */
+  template <typename TrialValueSetter>
+  void dispatch_compute_trial_values(
+    const unsigned int                      cell_index,
+    const unsigned int                      q_point,
+    const std::vector<std::vector<double>>  &slips,
+    const std::vector<std::vector<double>>  &old_slips,
+    const TrialValueSetter                  &set_trial_value) const;
 
   double get_hardening_matrix_entry(const bool self_hardening) const;
 };
 
 
 
+template <int dim>
+inline unsigned int
+QuadraturePointHistoryStorage<dim>::get_local_cell_index(
+  const unsigned int cell_index) const
+{
+  Assert(flag_init_was_called,
+         dealii::ExcMessage("The QuadraturePointHistoryStorage<dim> "
+                            "instance has not been initialized."));
+  AssertIndexRange(cell_index, local_cell_indices.size());
+  Assert(local_cell_indices[cell_index] !=
+           dealii::numbers::invalid_unsigned_int,
+         dealii::ExcMessage("The slip resistances are only stored at "
+                            "the locally owned cells."));
+
+  return (local_cell_indices[cell_index]);
+}
+
+
+
+template <int dim>
+inline std::size_t
+QuadraturePointHistoryStorage<dim>::get_offset(
+  const unsigned int cell_index,
+  const unsigned int q_point) const
+{
+  AssertIndexRange(q_point, n_q_points);
+
+  return ((static_cast<std::size_t>(get_local_cell_index(cell_index)) *
+             n_q_points + q_point) *
+          n_slips);
+}
+
+
+
+template <int dim>
+inline bool
+QuadraturePointHistoryStorage<dim>::is_compressed() const
+{
+  return (compressed_buffer.is_compressed());
+}
+
+
+
+template <int dim>
+inline const std::vector<double> &
+QuadraturePointHistoryStorage<dim>::get_trial_buffer(
+  const unsigned int cell_index) const
+{
+  Assert(!is_compressed(),
+         dealii::ExcMessage("The trial values are not stored if the "
+                            "committed values are compressed."));
+
+  return (buffers[(cell_epochs[get_local_cell_index(cell_index)] == epoch) ?
+                    (1 - committed_buffer_id) : committed_buffer_id]);
+}
+
+
+
 template <int dim>
 inline double
-QuadraturePointHistory<dim>::get_slip_resistance(
+QuadraturePointHistoryStorage<dim>::get_slip_resistance(
+  const unsigned int cell_index,
+  const unsigned int q_point,
   const unsigned int slip_id) const
 {
-  AssertThrow(flag_init_was_called,
-              dealii::ExcMessage("The QuadraturePointHistory<dim> "
-                                 "instance has not been initialized."));
+  AssertIndexRange(slip_id, n_slips);
+
+  if (is_compressed())
+    return (get_committed_slip_resistance(cell_index, q_point, slip_id));
+
+  return (get_trial_buffer(cell_index)[
+            get_offset(cell_index, q_point) + slip_id]);
+}
+
+
+
+template <int dim>
+inline dealii::ArrayView<const double>
+QuadraturePointHistoryStorage<dim>::get_slip_resistances(
+  const unsigned int cell_index,
+  const unsigned int q_point) const
+{
+  const std::size_t offset = get_offset(cell_index, q_point);
 
-  return (slip_resistances[slip_id]);
+  return (dealii::ArrayView<const double>(
+            get_trial_buffer(cell_index).data() + offset,
+            n_slips));
 }
 
 
 
 template <int dim>
-inline std::vector<double>
-QuadraturePointHistory<dim>::get_slip_resistances() const
+inline dealii::ArrayView<const double>
+QuadraturePointHistoryStorage<dim>::get_slip_resistances(
+  const unsigned int cell_index) const
 {
-  AssertThrow(flag_init_was_called,
-              dealii::ExcMessage("The QuadraturePointHistory<dim> "
-                                 "instance has not been initialized."));
+  const std::size_t offset = get_offset(cell_index, 0);
 
-  return (slip_resistances);
+  return (dealii::ArrayView<const double>(
+            get_trial_buffer(cell_index).data() + offset,
+            static_cast<std::size_t>(n_q_points) * n_slips));
 }
 
 
 
 template <int dim>
 inline double
-QuadraturePointHistory<dim>::get_hardening_matrix_entry(
-  const bool self_hardening) const
+QuadraturePointHistoryStorage<dim>::get_committed_slip_resistance(
+  const unsigned int cell_index,
+  const unsigned int q_point,
+  const unsigned int slip_id) const
 {
-  AssertThrow(flag_init_was_called,
-              dealii::ExcMessage("The QuadraturePointHistory<dim> "
-                                 "instance has not been initialized."));
+  AssertIndexRange(slip_id, n_slips);
+
+  const std::size_t offset = get_offset(cell_index, q_point) + slip_id;
+
+  if (is_compressed())
+    return (compressed_buffer.get(offset));
+
+  return (buffers[committed_buffer_id][offset]);
+}
+
+
 
+template <int dim>
+inline double
+QuadraturePointHistoryStorage<dim>::get_hardening_matrix_entry(
+  const bool self_hardening) const
+{
   return (linear_hardening_modulus *
           (hardening_parameter +
            ((self_hardening) ? (1.0 - hardening_parameter) : 0.0)));
@@ -406,11 +955,23 @@ QuadraturePointHistory<dim>::get_hardening_matrix_entry(
 
 
 /*!
- * @brief
+ * @brief Storage of data at the quadrature points of the faces at the
+ * grain boundaries.
  *
- * @tparam DataType
- * @tparam dim
- * @todo Docu
+ * @details Each pair of cells sharing a face at a grain boundary is
+ * assigned a dense integer identifier during @ref initialize. The data
+ * of all faces is stored contiguously, face after face, such that the
+ * data of a face is accessed in constant time through its identifier.
+ * The lookup by a pair of dealii::CellId is only meant to be used
+ * during the set up to obtain said identifier.
+ *
+ * Optionally, a fixed number of scalar values per quadrature point,
+ * e.g., the committed internal variables of the data, are stored in a
+ * @ref HistoryBuffer next to the data, i.e., possibly compressed.
+ *
+ * @tparam CellIteratorType The type of the cell iterator
+ * @tparam DataType The type of the data stored at each quadrature
+ * point
  */
 template <typename CellIteratorType, typename DataType>
 class InterfaceDataStorage : public dealii::Subscriptor
@@ -419,7 +980,7 @@ public:
   /*!
    * @brief Default constructor
    */
-  InterfaceDataStorage() = default;
+  InterfaceDataStorage();
 
   /*!
    * @brief Default destructor
@@ -427,42 +988,87 @@ public:
   ~InterfaceDataStorage() override = default;
 
   /*!
-   * @brief
+   * @brief Assigns an identifier to each face at a grain boundary of
+   * the cells in [@p cell_start, @p cell_end) and allocates the data
+   * of its quadrature points
    *
-   * @param cell_start
-   * @param cell_end
-   * @param n_q_points_per_face
-   * @todo Docu
+   * @param cell_start The first cell of the range
+   * @param cell_end The cell past the last cell of the range
+   * @param n_q_points_per_face The number of quadrature points per
+   * face
+   * @param n_committed_values The number of committed values per
+   * quadrature point
+   * @param precision The format of the committed values
+   * @param fixed_point_resolution The resolution of the fixed-point
+   * format
    */
   void initialize(
     const CellIteratorType  &cell_start,
     const CellIteratorType  &cell_end,
-    const unsigned int      n_q_points_per_face);
+    const unsigned int      n_q_points_per_face,
+    const unsigned int      n_committed_values = 0,
+    const RunTimeParameters::HistoryStoragePrecision precision =
+      RunTimeParameters::HistoryStoragePrecision::Double,
+    const double            fixed_point_resolution = 1e-6);
 
   /*!
-   * @brief Get the data object
-   *
-   * @param current_cell_id
-   * @param neighbor_cell_id
-   * @return std::vector<std::shared_ptr<DataType>>
-   * @todo Docu
+   * @brief Returns the number of faces
    */
-  std::vector<std::shared_ptr<DataType>>
-    get_data(const dealii::CellId current_cell_id,
-             const dealii::CellId neighbor_cell_id);
+  unsigned int n_faces() const;
 
   /*!
-   * @brief Get the data object
+   * @brief Returns the identifier of the face shared by the two cells.
+   * The order of the cells is irrelevant.
    *
-   * @param current_cell_id
-   * @param neighbor_cell_id
-   * @return std::vector<std::shared_ptr<const DataType>>
-   * @warning Compilation error when used
-   * @todo Docu
+   * @details This method involves a lookup in a std::map and is to be
+   * called only during the set up.
+   */
+  unsigned int get_face_id(const dealii::CellId current_cell_id,
+                           const dealii::CellId neighbor_cell_id) const;
+
+  /*!
+   * @brief Returns a view to the data at the quadrature points of the
+   * face with the identifier @p face_id
+   */
+  dealii::ArrayView<DataType> get_data(const unsigned int face_id);
+
+  /*!
+   * @brief Returns a view to the data at the quadrature points of the
+   * face with the identifier @p face_id
+   */
+  dealii::ArrayView<const DataType> get_data(
+    const unsigned int face_id) const;
+
+  /*!
+   * @brief Returns a view to the data at the quadrature points of the
+   * face shared by the two cells. See @ref get_face_id
+   */
+  dealii::ArrayView<DataType> get_data(
+    const dealii::CellId current_cell_id,
+    const dealii::CellId neighbor_cell_id);
+
+  /*!
+   * @brief Returns the committed value @p value_id at the quadrature
+   * point @p q_point of the face with the identifier @p face_id
    */
-  std::vector<std::shared_ptr<const DataType>>
-    get_data(const dealii::CellId current_cell_id,
-             const dealii::CellId neighbor_cell_id) const;
+  double get_committed_value(const unsigned int face_id,
+                             const unsigned int q_point,
+                             const unsigned int value_id) const;
+
+  /*!
+   * @brief Sets the committed value @p value_id at the quadrature
+   * point @p q_point of the face with the identifier @p face_id
+   */
+  void set_committed_value(const unsigned int face_id,
+                           const unsigned int q_point,
+                           const unsigned int value_id,
+                           const double       value);
+
+  /*!
+   * @brief Returns the memory consumption of the data and of the
+   * committed values in bytes
+   */
+  std::size_t memory_consumption() const;
 
 private:
   /**
@@ -486,14 +1092,51 @@ private:
                InterfaceDataStorage<CellIteratorType, DataType>>
     tria;
 
+  /*!
+   * @brief The number of quadrature points per face
+   */
+  unsigned int                                              n_face_q_points;
+
   /**
-   * A map to store a vector of data on each cell.
-   * We need to use CellId as the key because it remains unique during
-   * adaptive refinement.
+   * A map from the pair of cells sharing a face to the identifier of
+   * the latter. We need to use CellId as the key because it remains
+   * unique during adaptive refinement.
+   */
+  std::map<std::pair<dealii::CellId, dealii::CellId>, unsigned int>
+                                                            face_ids;
+
+  /*!
+   * @brief The data of all quadrature points of all faces, stored face
+   * after face
    */
-  std::map<
-    std::pair<dealii::CellId, dealii::CellId>,
-    std::vector<std::shared_ptr<DataType>>> map;
+  std::vector<DataType>                                     data;
+
+  /*!
+   * @brief The number of committed values per quadrature point
+   */
+  unsigned int                                              n_committed_values;
+
+  /*!
+   * @brief The committed values of all quadrature points of all faces,
+   * stored face after face
+   */
+  HistoryBuffer                                             committed_values;
+
+  /*!
+   * @brief Returns the position of a committed value inside
+   * @ref committed_values
+   */
+  std::size_t get_committed_value_index(const unsigned int face_id,
+                                        const unsigned int q_point,
+                                        const unsigned int value_id) const;
+
+  /*!
+   * @brief Returns the key of @ref face_ids corresponding to the two
+   * cells
+   */
+  static std::pair<dealii::CellId, dealii::CellId> get_key(
+    const dealii::CellId current_cell_id,
+    const dealii::CellId neighbor_cell_id);
 
   DeclExceptionMsg(
     ExcTriangulationMismatch,
@@ -502,17 +1145,139 @@ private:
 
 
 
+template <typename CellIteratorType, typename DataType>
+InterfaceDataStorage<CellIteratorType, DataType>::InterfaceDataStorage()
+:
+n_face_q_points(0),
+n_committed_values(0)
+{}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline unsigned int
+InterfaceDataStorage<CellIteratorType, DataType>::n_faces() const
+{
+  return (face_ids.size());
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline dealii::ArrayView<DataType>
+InterfaceDataStorage<CellIteratorType, DataType>::get_data(
+  const unsigned int face_id)
+{
+  AssertIndexRange(face_id, n_faces());
+
+  return (dealii::ArrayView<DataType>(
+            data.data() + face_id * n_face_q_points,
+            n_face_q_points));
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline dealii::ArrayView<const DataType>
+InterfaceDataStorage<CellIteratorType, DataType>::get_data(
+  const unsigned int face_id) const
+{
+  AssertIndexRange(face_id, n_faces());
+
+  return (dealii::ArrayView<const DataType>(
+            data.data() + face_id * n_face_q_points,
+            n_face_q_points));
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline std::size_t
+InterfaceDataStorage<CellIteratorType, DataType>::get_committed_value_index(
+  const unsigned int face_id,
+  const unsigned int q_point,
+  const unsigned int value_id) const
+{
+  AssertIndexRange(face_id, n_faces());
+  AssertIndexRange(q_point, n_face_q_points);
+  AssertIndexRange(value_id, n_committed_values);
+
+  return ((static_cast<std::size_t>(face_id) * n_face_q_points + q_point) *
+          n_committed_values + value_id);
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline double
+InterfaceDataStorage<CellIteratorType, DataType>::get_committed_value(
+  const unsigned int face_id,
+  const unsigned int q_point,
+  const unsigned int value_id) const
+{
+  return (committed_values.get(
+            get_committed_value_index(face_id, q_point, value_id)));
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline void
+InterfaceDataStorage<CellIteratorType, DataType>::set_committed_value(
+  const unsigned int face_id,
+  const unsigned int q_point,
+  const unsigned int value_id,
+  const double       value)
+{
+  committed_values.set(
+    get_committed_value_index(face_id, q_point, value_id),
+    value);
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline std::size_t
+InterfaceDataStorage<CellIteratorType, DataType>::memory_consumption() const
+{
+  return (data.capacity() * sizeof(DataType) +
+          committed_values.memory_consumption());
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline std::pair<dealii::CellId, dealii::CellId>
+InterfaceDataStorage<CellIteratorType, DataType>::get_key(
+  const dealii::CellId current_cell_id,
+  const dealii::CellId neighbor_cell_id)
+{
+  if (current_cell_id < neighbor_cell_id)
+    return (std::make_pair(current_cell_id, neighbor_cell_id));
+  else
+    return (std::make_pair(neighbor_cell_id, current_cell_id));
+}
+
+
+
 template <typename CellIteratorType, typename DataType>
 void InterfaceDataStorage<CellIteratorType, DataType>::initialize(
   const CellIteratorType  &cell_start,
   const CellIteratorType  &cell_end,
-  const unsigned int      n_face_q_points)
+  const unsigned int      n_face_q_points,
+  const unsigned int      n_committed_values,
+  const RunTimeParameters::HistoryStoragePrecision precision,
+  const double            fixed_point_resolution)
 {
   Assert(n_face_q_points > 0,
          dealii::ExcMessage(
            "The number of quadrature points per face has to be bigger "
            "than zero."));
 
+  this->n_face_q_points = n_face_q_points;
+
+  face_ids.clear();
+
   for (CellIteratorType cell = cell_start; cell != cell_end; ++cell)
     if (cell->is_locally_owned())
       for (const auto &face_index : cell->face_indices())
@@ -527,28 +1292,24 @@ void InterfaceDataStorage<CellIteratorType, DataType>::initialize(
           Assert(&cell->get_triangulation() == tria,
                  ExcTriangulationMismatch());
 
-          std::pair<dealii::CellId, dealii::CellId> key;
+          const std::pair<dealii::CellId, dealii::CellId> key =
+            get_key(cell->id(), cell->neighbor(face_index)->id());
 
-          const dealii::CellId current_cell_id =
-            cell->id();
-          const dealii::CellId neighbor_cell_id =
-            cell->neighbor(face_index)->id();
+          // The identifiers are assigned in the order in which the
+          // faces are first visited
+          face_ids.emplace(key,
+                           static_cast<unsigned int>(face_ids.size()));
+        }
 
-          if (current_cell_id < neighbor_cell_id)
-            key = std::make_pair(current_cell_id, neighbor_cell_id);
-          else
-            key = std::make_pair(neighbor_cell_id, current_cell_id);
+  data.clear();
 
-          if (map.find(key) == map.end())
-          {
-            map[key] =
-              std::vector<std::shared_ptr<DataType>>(n_face_q_points);
+  data.resize(face_ids.size() * n_face_q_points);
 
-            for (unsigned int face_q_point = 0;
-                 face_q_point < n_face_q_points; ++face_q_point)
-              map[key][face_q_point] = std::make_shared<DataType>();
-          }
-        }
+  this->n_committed_values = n_committed_values;
+
+  committed_values.reinit(data.size() * n_committed_values,
+                          precision,
+                          fixed_point_resolution);
 }
 
 
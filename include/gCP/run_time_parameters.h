@@ -168,6 +168,33 @@ enum class BoundaryConditionsAtGrainBoundaries
 
 
 
+/*!
+ * @brief Enum listing the formats in which the committed history
+ * values are stored. See @ref QuadraturePointHistoryStorage and
+ * @ref InterfaceDataStorage
+ */
+enum class HistoryStoragePrecision
+{
+  /*!
+   * @brief Double precision, i.e., no compression
+   */
+  Double,
+
+  /*!
+   * @brief Single precision. The relative error of the stored values
+   * is bounded by \f$ 2^{-24} \f$
+   */
+  Single,
+
+  /*!
+   * @brief Signed 32-bit fixed-point format. The absolute error of the
+   * stored values is bounded by half the resolution
+   */
+  FixedPoint,
+};
+
+
+
 struct HookeLawParameters
 {
   /*
@@ -590,6 +617,18 @@ struct KrylovParameters
    * @todo Docu
    */
   unsigned int  n_max_iterations;
+
+  /*!
+   * @brief Flag indicating if the linearized system is to be solved
+   * without assembling the global Jacobian matrix.
+   *
+   * @details If true, the tangent moduli at the quadrature points are
+   * stored once per Jacobian refresh and the action of the Jacobian is
+   * computed cell-wise from them with sum-factorized kernels inside the
+   * Krylov solver. A Jacobi preconditioner is used. Only available for
+   * @ref SolverType::CG and @ref SolverType::GMRES.
+   */
+  bool          flag_matrix_free;
 };
 
 
@@ -640,6 +679,36 @@ struct NewtonRaphsonParameters
    * @todo Docu
    */
   unsigned int  n_max_iterations;
+
+  /*!
+   * @brief Flag indicating if the Jacobian and its preconditioner are
+   * kept across Newton iterations, i.e., if a modified Newton-Raphson
+   * method is used.
+   *
+   * @details The Jacobian is reassembled once the contraction factor
+   * of the residual exceeds @ref jacobian_refresh_threshold, the
+   * residual grows or the line search had to backtrack.
+   */
+  bool          flag_reuse_jacobian;
+
+  /*!
+   * @brief Contraction factor of the residual, i.e.,
+   * \f$ \| R_k \| / \| R_{k-1} \| \f$, above which the Jacobian is
+   * reassembled. It has to lie in \f$ (0,1) \f$. Only relevant if
+   * @ref flag_reuse_jacobian is set.
+   *
+   * @details A value of 0.5 requests a new Jacobian once a Newton
+   * iteration does not halve the residual. The estimated order of
+   * convergence (C-Rate) is only logged.
+   */
+  double        jacobian_refresh_threshold;
+
+  /*!
+   * @brief Flag indicating if the Jacobian of the last Newton
+   * iteration of a time step is kept for the first iteration of the
+   * next one. Only relevant if @ref flag_reuse_jacobian is set.
+   */
+  bool          flag_reuse_jacobian_across_time_steps;
 };
 
 
@@ -676,6 +745,17 @@ struct LineSearchParameters
    * @todo Docu
    */
   unsigned int  n_max_iterations;
+
+  /*!
+   * @brief Flag indicating if the affine contributions to the residual
+   * are reused during the line search.
+   *
+   * @details They are obtained from the residuals at the start of the
+   * Newton iteration and after the full Newton step. Only the
+   * nonlinear contributions are assembled for the remaining
+   * relaxation parameters.
+   */
+  bool          flag_reuse_linear_contributions;
 };
 
 
@@ -763,6 +843,101 @@ struct SolverParameters
    */
   bool                          flag_zero_damage_during_loading_and_unloading;
 
+  /*!
+   * @brief Flag indicating if the residual and the Jacobian are
+   * assembled in a single sweep over the cells at the start of each
+   * Newton iteration.
+   *
+   * @details The line search always uses the residual-only assembly.
+   * Ignored in the matrix-free mode.
+   */
+  bool                          flag_fused_assembly;
+
+  /*!
+   * @brief Flag indicating if the slip resistances and the interface
+   * quadrature point history are updated by the residual assembly
+   * itself instead of in a preceding sweep over the cells and the
+   * grain boundary faces.
+   *
+   * @details The interface quadrature point history is shared by the
+   * two cells of a grain boundary face. Both of them compute it, but
+   * only one of them stores it.
+   */
+  bool                          flag_fused_history_update;
+
+  /*!
+   * @brief Flag indicating if the assemblies traverse the cells
+   * color by color.
+   *
+   * @details Cells of the same color share no degree of freedom, not
+   * even through the face coupling at the grain boundaries or through
+   * the constraints. Their local contributions are thus written into
+   * the global matrix and vectors directly from the worker threads
+   * instead of through a single serial copier thread. The assemblies
+   * are timed per traversal and number of threads in either case,
+   * such that the scaling of both can be compared.
+   */
+  bool                          flag_colored_assembly;
+
+  /*!
+   * @brief Flag indicating if the local Jacobians of the cells in the
+   * bulk of the grains are cached and reused.
+   *
+   * @details A cached local Jacobian is reused as long as the slip
+   * rates, the slip resistances and, for a nonlinear vectorial
+   * microstress law, the slip gradients at its quadrature points
+   * deviate less than @ref local_jacobian_cache_tolerance from the ones
+   * it was computed with. Cells at the grain boundaries are never
+   * cached. Requires the storage of a full local matrix per locally
+   * owned cell and can therefore not be combined with
+   * @ref KrylovParameters::flag_matrix_free.
+   */
+  bool                          flag_cache_local_jacobians;
+
+  /*!
+   * @brief Tolerance of the local Jacobian cache. See
+   * @ref flag_cache_local_jacobians.
+   *
+   * @details Absolute for the slip rates and the slip gradients and
+   * relative for the slip resistances.
+   */
+  double                        local_jacobian_cache_tolerance;
+
+  /*!
+   * @brief Flag indicating if the bulk integrals of the residual are
+   * evaluated with sum-factorized tensor-product kernels instead of
+   * FEValues.
+   *
+   * @details Applies to the displacement and slip components of the
+   * residual-only assemblies, i.e., the line search residuals and the
+   * Newton residuals outside the fused assembly. The action of the
+   * matrix-free Jacobian, see @ref KrylovParameters::flag_matrix_free,
+   * always uses the kernels. The face integrals at the grain boundaries
+   * and the Neumann boundaries as well as the assembled Jacobian keep
+   * using FEValues. The kernels evaluate the locally owned cells of a
+   * crystal in batches, one cell per lane of a
+   * dealii::VectorizedArray, while the constitutive laws are evaluated
+   * cell by cell. Requires a tensor-product quadrature.
+   */
+  bool                          flag_sum_factorization;
+
+  /*!
+   * @brief Format in which the committed slip resistances and the
+   * committed internal variables of the cohesive law are stored.
+   *
+   * @details All computations remain in double precision. Only the
+   * values of the last converged time step are compressed. The trial
+   * slip resistances are then not stored but recomputed from the
+   * committed ones whenever they are needed.
+   */
+  HistoryStoragePrecision       history_storage_precision;
+
+  /*!
+   * @brief Resolution of the fixed-point format. See
+   * @ref history_storage_precision.
+   */
+  double                        history_fixed_point_resolution;
+
   /*!
    * @brief
    *
@@ -915,6 +1090,31 @@ struct ProblemParameters
 
   unsigned int                      n_global_refinements;
 
+  /*!
+   * @brief The mesh is adaptively coarsened and refined every
+   * @ref refinement_frequency time steps. Zero disables the adaptive
+   * mesh refinement.
+   */
+  unsigned int                      refinement_frequency;
+
+  /*!
+   * @brief The maximum number of refinement levels on top of the
+   * @ref n_global_refinements global ones
+   */
+  unsigned int                      n_max_adaptive_refinements;
+
+  /*!
+   * @brief The fraction of cells with the largest error indicator
+   * which are refined
+   */
+  double                            refinement_fraction;
+
+  /*!
+   * @brief The fraction of cells with the smallest error indicator
+   * which are coarsened
+   */
+  double                            coarsening_fraction;
+
   unsigned int                      fe_degree_displacements;
 
   unsigned int                      fe_degree_slips;
@@ -947,6 +1147,26 @@ struct ProblemParameters
 
   bool                              flag_store_checkpoint;
 
+  /*!
+   * @brief A checkpoint is stored every @ref checkpoint_frequency
+   * time steps. Zero disables the criterion.
+   */
+  unsigned int                      checkpoint_frequency;
+
+  /*!
+   * @brief A checkpoint is stored once the wall-clock time elapsed
+   * since the last one, in seconds, exceeds
+   * @ref checkpoint_wall_time_interval. Zero disables the criterion.
+   */
+  double                            checkpoint_wall_time_interval;
+
+  /*!
+   * @brief Flag indicating if the simulation is restarted from the
+   * checkpoint stored in the checkpoints folder of
+   * @ref graphical_output_directory
+   */
+  bool                              flag_restart_from_checkpoint;
+
   bool                              verbose;
 };
 
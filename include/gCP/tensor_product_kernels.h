@@ -0,0 +1,172 @@
+#ifndef INCLUDE_TENSOR_PRODUCT_KERNELS_H_
+#define INCLUDE_TENSOR_PRODUCT_KERNELS_H_
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/fe/fe.h>
+
+#include <array>
+#include <vector>
+
+
+
+namespace gCP
+{
+
+
+
+/*!
+ * @brief Sum-factorized evaluation and integration of a scalar FE_Q
+ * field on a cell
+ *
+ * @details The shape functions of FE_Q and a tensor-product quadrature
+ * factorize into one-dimensional ones. The values and the reference
+ * gradients at the quadrature points are thus computed by applying the
+ * one-dimensional shape function matrices direction by direction, i.e.,
+ * with \f$ \mathcal{O}(d \, n^{d+1}) \f$ instead of
+ * \f$ \mathcal{O}(n^{2d}) \f$ operations, \f$ n \f$ being the number of
+ * one-dimensional degrees of freedom. The integration against the
+ * shape functions and their reference gradients applies the transposed
+ * matrices in reverse order.
+ *
+ * The degrees of freedom and the quadrature points are numbered
+ * lexicographically, i.e., the first coordinate runs fastest. See
+ * @ref get_lexicographic_numbering.
+ *
+ * The kernels process a single scalar field per call. With @p Number
+ * being dealii::VectorizedArray<double> each lane holds the field of
+ * another cell, i.e., a batch of cells sharing the reference element
+ * is evaluated with the operations of a single one. The
+ * one-dimensional matrices are the same for all lanes. The kernels are
+ * not used to assemble the Jacobian matrix.
+ */
+template <int dim, typename Number = double>
+class TensorProductKernels
+{
+public:
+  /*!
+   * @brief Buffers of the intermediate results. Each thread has to
+   * use its own instance.
+   */
+  struct Workspace
+  {
+    dealii::AlignedVector<Number> buffer_0;
+
+    dealii::AlignedVector<Number> buffer_1;
+
+    dealii::AlignedVector<Number> buffer_2;
+  };
+
+  TensorProductKernels(const dealii::FiniteElement<dim> &finite_element,
+                       const dealii::Quadrature<1>      &quadrature);
+
+  unsigned int n_dofs_per_cell() const;
+
+  unsigned int n_quadrature_points() const;
+
+  /*!
+   * @brief Returns the lexicographic index of each degree of freedom
+   * of the finite element
+   */
+  const std::vector<unsigned int> &get_lexicographic_numbering() const;
+
+  /*!
+   * @brief Computes the values and the gradients with respect to the
+   * reference coordinates at the quadrature points of the field with
+   * the degrees of freedom values @p dof_values
+   *
+   * @details Empty array views are skipped.
+   */
+  void evaluate(
+    const dealii::ArrayView<const Number>                   &dof_values,
+    const dealii::ArrayView<Number>                         &values,
+    const dealii::ArrayView<dealii::Tensor<1,dim,Number>>   &reference_gradients,
+    Workspace                                               &workspace) const;
+
+  /*!
+   * @brief Adds the integrals of @p values tested with the shape
+   * functions and of @p reference_gradients tested with their
+   * reference gradients to @p dof_values
+   *
+   * @details The quadrature weights and the mapping have to be
+   * included in the arguments. Empty array views are skipped.
+   */
+  void integrate(
+    const dealii::ArrayView<const Number>                         &values,
+    const dealii::ArrayView<const dealii::Tensor<1,dim,Number>>   &reference_gradients,
+    const dealii::ArrayView<Number>                               &dof_values,
+    Workspace                                                     &workspace) const;
+
+private:
+  const unsigned int        n_dofs_1d;
+
+  const unsigned int        n_q_points_1d;
+
+  /*!
+   * @brief Values of the one-dimensional shape functions at the
+   * one-dimensional quadrature points stored row-wise, i.e., the
+   * quadrature point index runs slowest
+   */
+  std::vector<double>       shape_values;
+
+  /*!
+   * @brief Derivatives of the one-dimensional shape functions. Same
+   * layout as @ref shape_values
+   */
+  std::vector<double>       shape_gradients;
+
+  std::vector<unsigned int> lexicographic_numbering;
+
+  /*!
+   * @brief Applies @p matrix, or its transpose, along @p direction of
+   * the tensor @p input with the extents @p extents and writes, or
+   * adds, the result into @p output. @p extents is updated to the
+   * ones of @p output.
+   */
+  void apply(const std::vector<double>     &matrix,
+             const bool                    transpose,
+             const unsigned int            direction,
+             std::array<unsigned int, dim> &extents,
+             const Number                  *input,
+             Number                        *output,
+             const bool                    add) const;
+};
+
+
+
+template <int dim, typename Number>
+inline unsigned int
+TensorProductKernels<dim, Number>::n_dofs_per_cell() const
+{
+  return (lexicographic_numbering.size());
+}
+
+
+
+template <int dim, typename Number>
+inline unsigned int
+TensorProductKernels<dim, Number>::n_quadrature_points() const
+{
+  return (dealii::Utilities::fixed_power<dim>(n_q_points_1d));
+}
+
+
+
+template <int dim, typename Number>
+inline const std::vector<unsigned int> &
+TensorProductKernels<dim, Number>::get_lexicographic_numbering() const
+{
+  return (lexicographic_numbering);
+}
+
+
+
+} // namespace gCP
+
+
+
+#endif /* INCLUDE_TENSOR_PRODUCT_KERNELS_H_ */
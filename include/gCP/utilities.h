@@ -4,17 +4,22 @@
 #include <deal.II/base/symmetric_tensor.h>
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/discrete_time.h>
 #include <deal.II/base/mpi.h>
 
+#include <deal.II/distributed/tria.h>
+
 #include <deal.II/dofs/dof_handler.h>
 
 #include <deal.II/grid/grid_tools.h>
 
 #include <deal.II/lac/full_matrix.h>
 
+#include <cstdint>
 #include <fstream>
 #include <map>
 #include <string>
+#include <type_traits>
 
 
 namespace gCP
@@ -57,6 +62,225 @@ void update_ghost_material_ids(dealii::DoFHandler<dim> &dof_handler)
 
 
 
+/*!
+ * @brief Makes the refinement and coarsening flags of the cells at
+ * both sides of each grain boundary consistent, such that the grain
+ * boundaries stay conforming
+ *
+ * @details A grain boundary is a face between two cells of different
+ * material identifiers. If one of its cells is flagged for refinement,
+ * so is the other one. A cell is only coarsened if the whole family of
+ * its parent is flagged for coarsening and so is the one of the
+ * neighbour cell. As a cell can only be flagged by its owner, the flags
+ * of the locally owned cells are exchanged with the ghost cells of the
+ * other processes. The mesh smoothing of
+ * dealii::Triangulation::prepare_coarsening_and_refinement() and the
+ * matching are repeated until no flag changes anymore. The material
+ * identifiers of the ghost cells have to be up to date, see
+ * @ref update_ghost_material_ids.
+ *
+ * Cells on the level @p max_level or finer are not refined. The cap is
+ * enforced in each sweep, i.e., neither the mesh smoothing nor the
+ * matching can flag such a cell, and a cell is not refined if its
+ * neighbour across a grain boundary can not be refined.
+ */
+template <int dim>
+void match_refinement_flags_at_grain_boundaries(
+  dealii::parallel::distributed::Triangulation<dim> &triangulation,
+  const unsigned int max_level = dealii::numbers::invalid_unsigned_int)
+{
+  using CellIterator =
+    typename dealii::Triangulation<dim>::active_cell_iterator;
+
+  // Bit flags describing the state of a cell
+  const std::uint8_t refine_flag = 1;
+
+  const std::uint8_t coarsen_family_flag = 2;
+
+  auto get_flags = [&](const CellIterator &cell)
+  {
+    std::uint8_t flags = 0;
+
+    if (cell->refine_flag_set())
+      flags |= refine_flag;
+
+    if (cell->coarsen_flag_set() && cell->level() > 0)
+    {
+      bool flag_family_is_flagged = true;
+
+      for (unsigned int child = 0;
+           child < cell->parent()->n_children();
+           ++child)
+        if (!cell->parent()->child(child)->is_active() ||
+            !cell->parent()->child(child)->coarsen_flag_set())
+        {
+          flag_family_is_flagged = false;
+
+          break;
+        }
+
+      if (flag_family_is_flagged)
+        flags |= coarsen_family_flag;
+    }
+
+    return (flags);
+  };
+
+  // The flags of the locally owned and of the ghost cells, indexed by
+  // the active cell index
+  std::vector<std::uint8_t> cell_flags(triangulation.n_active_cells(), 0);
+
+  bool flag_flags_changed = true;
+
+  auto exceeds_max_level = [&](const CellIterator &cell)
+  {
+    return (static_cast<unsigned int>(cell->level()) >= max_level);
+  };
+
+  while (flag_flags_changed)
+  {
+    triangulation.prepare_coarsening_and_refinement();
+
+    for (const auto &cell : triangulation.active_cell_iterators())
+      if (cell->is_locally_owned())
+      {
+        if (exceeds_max_level(cell))
+          cell->clear_refine_flag();
+
+        cell_flags[cell->active_cell_index()] = get_flags(cell);
+      }
+
+    dealii::GridTools::exchange_cell_data_to_ghosts<
+      std::uint8_t,
+      dealii::Triangulation<dim>>(
+        triangulation,
+        [&](const CellIterator &cell)
+        {
+          return (cell_flags[cell->active_cell_index()]);
+        },
+        [&](const CellIterator &cell, const std::uint8_t flags)
+        {
+          cell_flags[cell->active_cell_index()] = flags;
+        });
+
+    flag_flags_changed = false;
+
+    for (const auto &cell : triangulation.active_cell_iterators())
+      if (cell->is_locally_owned())
+        for (const auto &face_index : cell->face_indices())
+          if (!cell->face(face_index)->at_boundary() &&
+              cell->material_id() !=
+                cell->neighbor(face_index)->material_id())
+          {
+            AssertThrow(cell->neighbor(face_index)->is_active(),
+                        dealii::ExcMessage(
+                          "The grain boundaries have to be conforming."));
+
+            const std::uint8_t neighbour_flags =
+              cell_flags[cell->neighbor(face_index)->active_cell_index()];
+
+            if (cell->refine_flag_set() &&
+                exceeds_max_level(cell->neighbor(face_index)))
+            {
+              cell->clear_refine_flag();
+
+              flag_flags_changed = true;
+            }
+
+            if ((neighbour_flags & refine_flag) &&
+                !cell->refine_flag_set() &&
+                !exceeds_max_level(cell))
+            {
+              cell->clear_coarsen_flag();
+
+              cell->set_refine_flag();
+
+              flag_flags_changed = true;
+            }
+
+            if (cell->coarsen_flag_set() &&
+                !((neighbour_flags & coarsen_family_flag) &&
+                  (cell_flags[cell->active_cell_index()] &
+                     coarsen_family_flag)))
+            {
+              cell->clear_coarsen_flag();
+
+              flag_flags_changed = true;
+            }
+          }
+
+    flag_flags_changed =
+      dealii::Utilities::MPI::max(
+        static_cast<unsigned int>(flag_flags_changed),
+        triangulation.get_communicator()) > 0;
+  }
+}
+
+
+
+/*!
+ * @brief Returns the prefix of the files of the checkpoint to be
+ * written next at @p filepath
+ *
+ * @details Checkpoints alternate between the prefixes
+ * <tt>filepath-A</tt> and <tt>filepath-B</tt> such that the one
+ * referenced by the pointer file <tt>filepath.latest</tt> is never
+ * overwritten. See @ref commit_checkpoint.
+ */
+std::string get_next_checkpoint_prefix(const std::string &filepath);
+
+
+
+/*!
+ * @brief Returns the prefix of the files of the last complete
+ * checkpoint written at @p filepath, i.e., the one referenced by the
+ * pointer file <tt>filepath.latest</tt>
+ */
+std::string get_latest_checkpoint_prefix(const std::string &filepath);
+
+
+
+/*!
+ * @brief Marks the checkpoint written with @p prefix as the latest one
+ * of @p filepath
+ *
+ * @details Once all processes wrote their part, the root process
+ * writes the pointer file to a temporary file which is then renamed
+ * to <tt>filepath.latest</tt>. An interrupted checkpoint therefore
+ * leaves the previous one untouched and referenced.
+ */
+void commit_checkpoint(const std::string &filepath,
+                       const std::string &prefix);
+
+
+
+/*!
+ * @brief Writes the state of @p discrete_time to the file @p filepath,
+ * e.g., for checkpointing.
+ */
+void save_discrete_time(const dealii::DiscreteTime  &discrete_time,
+                        const std::string           &filepath);
+
+
+
+/*!
+ * @brief Restores the state written by @ref save_discrete_time into
+ * @p discrete_time.
+ *
+ * @details dealii::DiscreteTime does not expose setters for its state.
+ * It is therefore rebuilt from its start and end time and advanced to
+ * the saved step number, the last step having the saved previous step
+ * size. The replay only consists of scalar updates, i.e., its cost is
+ * negligible compared to the one of loading the triangulation. The
+ * saved step number is restored exactly and the current time and the
+ * previous step size up to round-off errors, otherwise an exception
+ * is thrown.
+ */
+void load_discrete_time(dealii::DiscreteTime  &discrete_time,
+                        const std::string     &filepath);
+
+
+
 class Logger
 {
 public:
@@ -78,9 +302,24 @@ public:
 
   void add_break(const std::string message);
 
+  /*!
+   * @brief Copies the contents logged so far to the file @p filepath,
+   * e.g., for checkpointing.
+   */
+  void save(const std::string &filepath);
+
+  /*!
+   * @brief Replaces the contents of the log file with those of the
+   * file @p filepath written by @ref save. Subsequent entries are
+   * appended to them.
+   */
+  void load(const std::string &filepath);
+
 private:
   dealii::ConditionalOStream                      pcout;
 
+  const std::string                               output_filename;
+
   std::ofstream                                   output_filepath;
 
   std::map<std::string, std::pair<double, bool>>  data_map;
@@ -230,6 +469,42 @@ std::string print_tetrad(
 
 
 
+/*!
+ * @brief Calls @p function with the number of slip systems @p n_slips
+ * as a compile-time constant, i.e., as a
+ * std::integral_constant<unsigned int, n_slips>.
+ *
+ * @details The numbers of slip systems of the crystal classes in use
+ * are specialized: 1 to 3 (two-dimensional crystals), 12 (FCC and
+ * BCC), 24 and 48 (BCC). Any other number is passed as zero, which
+ * has to select the path sized at run time. It allows kernels to use
+ * std::array storage and fully unrolled loops over the slip systems.
+ */
+template <typename Function>
+decltype(auto) dispatch_n_slips(const unsigned int  n_slips,
+                                Function            &&function)
+{
+  switch (n_slips)
+  {
+    case 1:
+      return function(std::integral_constant<unsigned int, 1>());
+    case 2:
+      return function(std::integral_constant<unsigned int, 2>());
+    case 3:
+      return function(std::integral_constant<unsigned int, 3>());
+    case 12:
+      return function(std::integral_constant<unsigned int, 12>());
+    case 24:
+      return function(std::integral_constant<unsigned int, 24>());
+    case 48:
+      return function(std::integral_constant<unsigned int, 48>());
+    default:
+      return function(std::integral_constant<unsigned int, 0>());
+  }
+}
+
+
+
 std::string get_fullmatrix_as_string(
   const dealii::FullMatrix<double>  fullmatrix,
   const unsigned int                offset = 0,
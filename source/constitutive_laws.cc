@@ -1,8 +1,13 @@
 #include <gCP/constitutive_laws.h>
+#include <gCP/utilities.h>
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/symmetric_tensor.h>
 
+#include <algorithm>
+#include <array>
 #include <iomanip>
+#include <type_traits>
 
 namespace gCP
 {
@@ -29,7 +34,7 @@ ElasticStrain<dim>::get_elastic_strain_tensor(
   const unsigned int                      crystal_id,
   const unsigned int                      q_point,
   const dealii::SymmetricTensor<2,dim>    strain_tensor_value,
-  const std::vector<std::vector<double>>  slip_values) const
+  const std::vector<std::vector<double>>  &slip_values) const
 {
   AssertThrow(crystals_data->is_initialized(),
               dealii::ExcMessage("The underlying CrystalsData<dim>"
@@ -58,7 +63,7 @@ const dealii::SymmetricTensor<2,dim>
 ElasticStrain<dim>::get_plastic_strain_tensor(
   const unsigned int                      crystal_id,
   const unsigned int                      q_point,
-  const std::vector<std::vector<double>>  slip_values) const
+  const std::vector<std::vector<double>>  &slip_values) const
 {
   AssertThrow(crystals_data->is_initialized(),
               dealii::ExcMessage("The underlying CrystalsData<dim>"
@@ -164,64 +169,83 @@ void HookeLaw<dim>::init()
                                      " instance has not been "
                                      " initialized."));
 
-      for (unsigned int crystal_id = 0;
-           crystal_id < crystals_data->get_n_crystals();
-           crystal_id++)
+      const unsigned int n_crystals = crystals_data->get_n_crystals();
+
+      const unsigned int n_slips = crystals_data->get_n_slips();
+
+      stiffness_tetrads.resize(n_crystals);
+
+      stiffness_tetrads_3d.resize(n_crystals);
+
+      stiffness_schmid_contractions.resize(
+        n_crystals,
+        std::vector<dealii::SymmetricTensor<2,dim>>(n_slips));
+
+      schmid_stiffness_contractions.resize(
+        n_crystals,
+        std::vector<dealii::SymmetricTensor<2,dim>>(n_slips));
+
+      schmid_stiffness_schmid_contractions.resize(
+        n_crystals,
+        dealii::FullMatrix<double>(n_slips));
+
+      // The crystals are independent of each other and are therefore
+      // processed in parallel
+      dealii::parallel::apply_to_subranges(
+        0U,
+        n_crystals,
+        [this, n_slips](const unsigned int begin, const unsigned int end)
         {
-          dealii::SymmetricTensor<4,dim>  stiffness_tetrad;
-
-          dealii::Tensor<2,dim> rotation_tensor =
-            crystals_data->get_rotation_tensor(crystal_id);
-
-          dealii::SymmetricTensor<4,3>    stiffness_tetrad_3d;
-
-          // The indices j and l do not start at zero due to the
-          // nature of the dealii::SymmetricTensor<4,dim> class, where
-          // for example [0][1][2][1] points to the same memory location
-          // as [1][0][2][1]
-          for (unsigned int i = 0; i < dim; i++)
-            for (unsigned int j = i; j < dim; j++)
-              for (unsigned int k = 0; k < dim; k++)
-                for (unsigned int l = k; l < dim; l++)
-                  for (unsigned int o = 0; o < dim; o++)
-                    for (unsigned int p = 0; p < dim; p++)
-                      for (unsigned int q = 0; q < dim; q++)
-                        for (unsigned int r = 0; r < dim; r++)
-                          stiffness_tetrad[i][j][k][l] +=
-                            rotation_tensor[i][o] *
-                            rotation_tensor[j][p] *
-                            rotation_tensor[k][q] *
-                            rotation_tensor[l][r] *
-                            reference_stiffness_tetrad[o][p][q][r];
-
-          if constexpr(dim == 3)
-            stiffness_tetrad_3d = stiffness_tetrad;
-          else if constexpr(dim == 2)
+          for (unsigned int crystal_id = begin; crystal_id < end; ++crystal_id)
           {
-            dealii::Tensor<2,3>   rotation_tensor_3d =
-              crystals_data->get_3d_rotation_tensor(crystal_id);
-
-            for (unsigned int i = 0; i < 3; i++)
-              for (unsigned int j = i; j < 3; j++)
-                for (unsigned int k = 0; k < 3; k++)
-                  for (unsigned int l = k; l < 3; l++)
-                    for (unsigned int o = 0; o < 3; o++)
-                      for (unsigned int p = 0; p < 3; p++)
-                        for (unsigned int q = 0; q < 3; q++)
-                          for (unsigned int r = 0; r < 3; r++)
-                            stiffness_tetrad_3d[i][j][k][l] +=
-                              rotation_tensor_3d[i][o] *
-                              rotation_tensor_3d[j][p] *
-                              rotation_tensor_3d[k][q] *
-                              rotation_tensor_3d[l][r] *
-                              reference_stiffness_tetrad_3d[o][p][q][r];
+            stiffness_tetrads[crystal_id] =
+              get_rotated_stiffness_tetrad(
+                reference_stiffness_tetrad,
+                crystals_data->get_rotation_tensor(crystal_id));
+
+            if constexpr(dim == 3)
+              stiffness_tetrads_3d[crystal_id] =
+                stiffness_tetrads[crystal_id];
+            else if constexpr(dim == 2)
+              stiffness_tetrads_3d[crystal_id] =
+                get_rotated_stiffness_tetrad(
+                  reference_stiffness_tetrad_3d,
+                  crystals_data->get_3d_rotation_tensor(crystal_id));
+            else
+              Assert(false, dealii::ExcNotImplemented());
+
+            // Contractions of the stiffness tetrads with the
+            // symmetrized Schmid tensors. They only depend on the
+            // crystal and are therefore computed once instead of at
+            // each quadrature point
+            const std::vector<dealii::SymmetricTensor<2,dim>>
+              &symmetrized_schmid_tensors =
+                crystals_data->get_symmetrized_schmid_tensors(crystal_id);
+
+            for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+            {
+              stiffness_schmid_contractions[crystal_id][slip_id] =
+                stiffness_tetrads[crystal_id] *
+                symmetrized_schmid_tensors[slip_id];
+
+              schmid_stiffness_contractions[crystal_id][slip_id] =
+                symmetrized_schmid_tensors[slip_id] *
+                stiffness_tetrads[crystal_id];
+            }
+
+            for (unsigned int slip_id_alpha = 0;
+                 slip_id_alpha < n_slips;
+                 ++slip_id_alpha)
+              for (unsigned int slip_id_beta = 0;
+                   slip_id_beta < n_slips;
+                   ++slip_id_beta)
+                schmid_stiffness_schmid_contractions[crystal_id](
+                  slip_id_alpha, slip_id_beta) =
+                    schmid_stiffness_contractions[crystal_id][slip_id_alpha] *
+                    symmetrized_schmid_tensors[slip_id_beta];
           }
-          else
-            Assert(false, dealii::ExcNotImplemented());
-
-          stiffness_tetrads.push_back(stiffness_tetrad);
-          stiffness_tetrads_3d.push_back(stiffness_tetrad_3d);
-        }
+        },
+        /* grainsize */ 64);
     }
     break;
 
@@ -234,6 +258,70 @@ void HookeLaw<dim>::init()
 }
 
 
+
+template<int dim>
+template <int spacedim>
+dealii::SymmetricTensor<4,spacedim> HookeLaw<dim>::get_rotated_stiffness_tetrad(
+  const dealii::SymmetricTensor<4,spacedim> &stiffness_tetrad,
+  const dealii::Tensor<2,spacedim>          &rotation_tensor)
+{
+  constexpr unsigned int n_voigt_components =
+    dealii::SymmetricTensor<2,spacedim>::n_independent_components;
+
+  // Index pairs of the Voigt components
+  std::array<dealii::TableIndices<2>, n_voigt_components> voigt_indices;
+
+  for (unsigned int I = 0; I < n_voigt_components; ++I)
+    voigt_indices[I] =
+      dealii::SymmetricTensor<2,spacedim>::unrolled_to_component_indices(I);
+
+  // Bond matrix, which maps the stress vector in Voigt notation to the
+  // rotated one
+  dealii::Tensor<2,n_voigt_components> bond_matrix;
+
+  for (unsigned int I = 0; I < n_voigt_components; ++I)
+  {
+    const unsigned int i = voigt_indices[I][0];
+    const unsigned int j = voigt_indices[I][1];
+
+    for (unsigned int J = 0; J < n_voigt_components; ++J)
+    {
+      const unsigned int k = voigt_indices[J][0];
+      const unsigned int l = voigt_indices[J][1];
+
+      bond_matrix[I][J] =
+        rotation_tensor[i][k] * rotation_tensor[j][l] +
+        ((k != l) ? rotation_tensor[i][l] * rotation_tensor[j][k] : 0.0);
+    }
+  }
+
+  // The stiffness matrix in Voigt notation. Its entries coincide with
+  // those of the tetrad, as the strain vector holds the engineering
+  // shear strains
+  dealii::Tensor<2,n_voigt_components> stiffness_matrix;
+
+  for (unsigned int I = 0; I < n_voigt_components; ++I)
+    for (unsigned int J = 0; J < n_voigt_components; ++J)
+      stiffness_matrix[I][J] =
+        stiffness_tetrad[voigt_indices[I][0]][voigt_indices[I][1]]
+                        [voigt_indices[J][0]][voigt_indices[J][1]];
+
+  const dealii::Tensor<2,n_voigt_components> rotated_stiffness_matrix =
+    bond_matrix * stiffness_matrix * dealii::transpose(bond_matrix);
+
+  dealii::SymmetricTensor<4,spacedim> rotated_stiffness_tetrad;
+
+  for (unsigned int I = 0; I < n_voigt_components; ++I)
+    for (unsigned int J = 0; J < n_voigt_components; ++J)
+      rotated_stiffness_tetrad[voigt_indices[I][0]][voigt_indices[I][1]]
+                              [voigt_indices[J][0]][voigt_indices[J][1]] =
+        rotated_stiffness_matrix[I][J];
+
+  return (rotated_stiffness_tetrad);
+}
+
+
+
 template<int dim>
 const dealii::SymmetricTensor<2,dim> HookeLaw<dim>::
 get_stress_tensor(
@@ -342,57 +430,237 @@ double ScalarMicrostressLaw<dim>::get_scalar_microstress(
 
 
 template<int dim>
-dealii::FullMatrix<double> ScalarMicrostressLaw<dim>::
-  get_jacobian(
-    const unsigned int                      q_point,
-    const std::vector<std::vector<double>>  slip_values,
-    const std::vector<std::vector<double>>  old_slip_values,
-    const std::vector<double>               slip_resistances,
-    const double                            time_step_size)
+void ScalarMicrostressLaw<dim>::get_scalar_microstresses(
+  const std::vector<std::vector<double>>  &slip_values,
+  const std::vector<std::vector<double>>  &old_slip_values,
+  const dealii::ArrayView<const double>   slip_resistances,
+  const double                            time_step_size,
+  std::vector<std::vector<double>>        &scalar_microstresses) const
+{
+  AssertThrow(crystals_data->is_initialized(),
+              dealii::ExcMessage("The underlying CrystalsData<dim>"
+                                  " instance has not been "
+                                  " initialized."));
+
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  AssertDimension(slip_values.size(), n_slips);
+  AssertDimension(old_slip_values.size(), n_slips);
+  AssertDimension(scalar_microstresses.size(), n_slips);
+  AssertIsFinite(time_step_size);
+
+  const unsigned int n_q_points = slip_values[0].size();
+
+  AssertDimension(slip_resistances.size(), n_q_points * n_slips);
+
+  const double inverse_time_step_size = 1.0 / time_step_size;
+
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+  {
+    AssertDimension(slip_values[slip_id].size(), n_q_points);
+    AssertDimension(old_slip_values[slip_id].size(), n_q_points);
+    Assert(scalar_microstresses[slip_id].size() >= n_q_points,
+           dealii::ExcLowerRange(scalar_microstresses[slip_id].size(),
+                                 n_q_points));
+
+    const double *const slip_value     = slip_values[slip_id].data();
+
+    const double *const old_slip_value = old_slip_values[slip_id].data();
+
+    double *const scalar_microstress   =
+      scalar_microstresses[slip_id].data();
+
+    // The slip rates are computed in place of the scalar microstresses
+    for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+      scalar_microstress[q_point] =
+        (slip_value[q_point] - old_slip_value[q_point]) *
+        inverse_time_step_size;
+
+    get_regularization_function_values(
+      dealii::ArrayView<const double>(scalar_microstress, n_q_points),
+      dealii::ArrayView<double>(scalar_microstress, n_q_points));
+
+    for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+      scalar_microstress[q_point] *=
+        initial_slip_resistance +
+        slip_resistances[q_point * n_slips + slip_id];
+  }
+}
+
+
+
+template<int dim>
+void ScalarMicrostressLaw<dim>::get_jacobian(
+  const unsigned int                      q_point,
+  const std::vector<std::vector<double>>  &slip_values,
+  const std::vector<std::vector<double>>  &old_slip_values,
+  const dealii::ArrayView<const double>   slip_resistances,
+  const double                            time_step_size,
+  dealii::FullMatrix<double>              &jacobian) const
 {
   AssertThrow(crystals_data->is_initialized(),
               dealii::ExcMessage("The underlying CrystalsData<dim>"
                                   " instance has not been "
                                   " initialized."));
 
-  dealii::FullMatrix<double> jacobian(crystals_data->get_n_slips());
+  Utilities::dispatch_n_slips(
+    crystals_data->get_n_slips(),
+    [&](const auto n_slips_at_compile_time)
+    {
+      this->template compute_jacobian<
+        decltype(n_slips_at_compile_time)::value>(
+          q_point,
+          slip_values,
+          old_slip_values,
+          slip_resistances,
+          time_step_size,
+          jacobian);
+    });
+}
+
+
+
+template<int dim>
+template <unsigned int n_slips_at_compile_time>
+void ScalarMicrostressLaw<dim>::compute_jacobian(
+  const unsigned int                      q_point,
+  const std::vector<std::vector<double>>  &slip_values,
+  const std::vector<std::vector<double>>  &old_slip_values,
+  const dealii::ArrayView<const double>   slip_resistances,
+  const double                            time_step_size,
+  dealii::FullMatrix<double>              &jacobian) const
+{
+  const unsigned int n_slips =
+    (n_slips_at_compile_time > 0) ? n_slips_at_compile_time
+                                  : crystals_data->get_n_slips();
+
+  AssertDimension(crystals_data->get_n_slips(), n_slips);
+  AssertDimension(jacobian.m(), n_slips);
+  AssertDimension(jacobian.n(), n_slips);
+  AssertDimension(slip_resistances.size(), n_slips);
+
+  const double latent_hardening_modulus =
+    get_hardening_matrix_entry(false);
+
+  const double self_hardening_modulus = get_hardening_matrix_entry(true);
+
+  if constexpr (n_slips_at_compile_time > 0)
+  {
+    std::array<double, n_slips_at_compile_time> slip_rates;
+
+    std::array<double, n_slips_at_compile_time>
+      regularization_function_values;
+
+    std::array<double, n_slips_at_compile_time>
+      regularization_function_derivative_values;
+
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    {
+      slip_rates[slip_id] = (slip_values[slip_id][q_point] -
+              old_slip_values[slip_id][q_point]) / time_step_size;
+
+      AssertIsFinite(slip_rates[slip_id]);
+    }
+
+    get_regularization_function_values(
+      dealii::ArrayView<const double>(slip_rates.data(), n_slips),
+      dealii::ArrayView<double>(regularization_function_values.data(),
+                                n_slips));
+
+    get_regularization_function_derivative_values(
+      dealii::ArrayView<const double>(slip_rates.data(), n_slips),
+      dealii::ArrayView<double>(
+        regularization_function_derivative_values.data(), n_slips));
+
+    for (unsigned int slip_id_alpha = 0;
+        slip_id_alpha < n_slips;
+        ++slip_id_alpha)
+    {
+      const double scaled_regularization_function_value =
+        latent_hardening_modulus *
+        regularization_function_values[slip_id_alpha];
+
+      for (unsigned int slip_id_beta = 0;
+          slip_id_beta < n_slips;
+          ++slip_id_beta)
+        jacobian(slip_id_alpha, slip_id_beta) =
+          scaled_regularization_function_value *
+          regularization_function_values[slip_id_beta];
+
+      jacobian(slip_id_alpha, slip_id_alpha) =
+        self_hardening_modulus *
+          regularization_function_values[slip_id_alpha] *
+          regularization_function_values[slip_id_alpha] +
+        (initial_slip_resistance + slip_resistances[slip_id_alpha]) /
+          time_step_size *
+          regularization_function_derivative_values[slip_id_alpha];
+    }
 
-  auto compute_slip_rate =
-    [&slip_values, &old_slip_values, &time_step_size](
-      const unsigned int  q_point,
-      const unsigned int  slip_id)
+#ifdef DEBUG
+    for (unsigned int slip_id_alpha = 0;
+        slip_id_alpha < n_slips;
+        ++slip_id_alpha)
+      for (unsigned int slip_id_beta = 0;
+          slip_id_beta < n_slips;
+          ++slip_id_beta)
+        AssertIsFinite(jacobian(slip_id_alpha, slip_id_beta));
+#endif
+  }
+  else
   {
-    const double slip_rate = (slip_values[slip_id][q_point] -
-            old_slip_values[slip_id][q_point]) / time_step_size;
+    // The diagonal entries temporarily hold the values of the
+    // regularization function, which are needed by the rank-one term
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    {
+      const double slip_rate = (slip_values[slip_id][q_point] -
+              old_slip_values[slip_id][q_point]) / time_step_size;
 
-    AssertIsFinite(slip_rate);
+      AssertIsFinite(slip_rate);
 
-    return slip_rate;
-  };
+      jacobian(slip_id, slip_id) =
+        get_regularization_function_value(slip_rate);
+    }
 
-  for (unsigned int slip_id_alpha = 0;
-      slip_id_alpha < crystals_data->get_n_slips();
-      ++slip_id_alpha)
-    for (unsigned int slip_id_beta = 0;
-        slip_id_beta < crystals_data->get_n_slips();
-        ++slip_id_beta)
+    // Rank-one term of the off-diagonal entries
+    for (unsigned int slip_id_alpha = 0;
+        slip_id_alpha < n_slips;
+        ++slip_id_alpha)
     {
-      jacobian[slip_id_alpha][slip_id_beta] =
-        (get_hardening_matrix_entry(slip_id_alpha == slip_id_beta) *
-          get_regularization_function_value(compute_slip_rate(q_point, slip_id_alpha)) *
-          get_regularization_function_value(compute_slip_rate(q_point, slip_id_beta)));
-
-      if (slip_id_alpha == slip_id_beta)
-        jacobian[slip_id_alpha][slip_id_beta] +=
-          ((initial_slip_resistance +
-            slip_resistances[slip_id_alpha]) / time_step_size *
-            get_regularization_function_derivative_value(
-              compute_slip_rate(q_point, slip_id_alpha)));
-
-      AssertIsFinite(jacobian[slip_id_alpha][slip_id_beta]);
+      const double scaled_regularization_function_value =
+        latent_hardening_modulus * jacobian(slip_id_alpha, slip_id_alpha);
+
+      for (unsigned int slip_id_beta = 0;
+          slip_id_beta < n_slips;
+          ++slip_id_beta)
+        if (slip_id_alpha != slip_id_beta)
+        {
+          jacobian(slip_id_alpha, slip_id_beta) =
+            scaled_regularization_function_value *
+            jacobian(slip_id_beta, slip_id_beta);
+
+          AssertIsFinite(jacobian(slip_id_alpha, slip_id_beta));
+        }
     }
 
-  return jacobian;
+    // Diagonal entries
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    {
+      const double slip_rate = (slip_values[slip_id][q_point] -
+              old_slip_values[slip_id][q_point]) / time_step_size;
+
+      const double regularization_function_value =
+        jacobian(slip_id, slip_id);
+
+      jacobian(slip_id, slip_id) =
+        self_hardening_modulus *
+          regularization_function_value * regularization_function_value +
+        (initial_slip_resistance + slip_resistances[slip_id]) /
+          time_step_size *
+          get_regularization_function_derivative_value(slip_rate);
+
+      AssertIsFinite(jacobian(slip_id, slip_id));
+    }
+  }
 }
 
 
@@ -401,48 +669,96 @@ template <int dim>
 double ScalarMicrostressLaw<dim>::
 get_regularization_function_value(const double slip_rate) const
 {
-  AssertIsFinite(slip_rate);
+  double regularization_function_value;
+
+  get_regularization_function_values(
+    dealii::ArrayView<const double>(&slip_rate, 1),
+    dealii::ArrayView<double>(&regularization_function_value, 1));
+
+  return regularization_function_value;
+}
 
-  double regularization_function_value = 0.0;
+
+
+template <int dim>
+double ScalarMicrostressLaw<dim>::
+get_regularization_function_derivative_value(const double slip_rate) const
+{
+  double regularization_function_derivative_value;
+
+  get_regularization_function_derivative_values(
+    dealii::ArrayView<const double>(&slip_rate, 1),
+    dealii::ArrayView<double>(&regularization_function_derivative_value, 1));
+
+  return regularization_function_derivative_value;
+}
+
+
+
+template <int dim>
+void ScalarMicrostressLaw<dim>::get_regularization_function_values(
+  const dealii::ArrayView<const double> &slip_rates,
+  const dealii::ArrayView<double>       &values) const
+{
+  AssertDimension(slip_rates.size(), values.size());
+
+  const unsigned int n_values = slip_rates.size();
+
+  const double *const x = slip_rates.data();
+
+  double *const y = values.data();
 
   const double effective_regularization_parameter =
     regularization_multiplier * regularization_parameter;
 
+  const double inverse_regularization_parameter =
+    1.0 / effective_regularization_parameter;
+
+  // The selection of the function is hoisted out of the loops, which
+  // only contain element-wise operations on contiguous arrays and can
+  // thus be vectorized by the compiler
   switch (regularization_function)
   {
   case RunTimeParameters::RegularizationFunction::Atan:
     {
-      regularization_function_value =
-        2.0 / M_PI * std::atan(
-          M_PI / 2.0 * slip_rate / effective_regularization_parameter);
+      const double scaling = M_PI / 2.0 * inverse_regularization_parameter;
+
+      for (unsigned int i = 0; i < n_values; ++i)
+        y[i] = 2.0 / M_PI * std::atan(scaling * x[i]);
     }
     break;
   case RunTimeParameters::RegularizationFunction::Sqrt:
     {
-      regularization_function_value =
-        slip_rate / std::sqrt(slip_rate * slip_rate +
-                              effective_regularization_parameter *
-                              effective_regularization_parameter);
+      const double squared_regularization_parameter =
+        effective_regularization_parameter *
+        effective_regularization_parameter;
+
+      for (unsigned int i = 0; i < n_values; ++i)
+        y[i] = x[i] / std::sqrt(x[i] * x[i] +
+                                squared_regularization_parameter);
     }
     break;
   case RunTimeParameters::RegularizationFunction::Gd:
     {
-      regularization_function_value =
-        2.0 / M_PI * std::atan(std::sinh(
-          M_PI / 2.0 * slip_rate / effective_regularization_parameter));
+      const double scaling = M_PI / 2.0 * inverse_regularization_parameter;
+
+      for (unsigned int i = 0; i < n_values; ++i)
+        y[i] = 2.0 / M_PI * std::atan(std::sinh(scaling * x[i]));
     }
     break;
   case RunTimeParameters::RegularizationFunction::Tanh:
     {
-      regularization_function_value =
-        std::tanh(slip_rate / effective_regularization_parameter);
+      for (unsigned int i = 0; i < n_values; ++i)
+        y[i] = std::tanh(inverse_regularization_parameter * x[i]);
     }
     break;
   case RunTimeParameters::RegularizationFunction::Erf:
     {
-      regularization_function_value =
-        std::erf(std::sqrt(M_PI) / 2.0 * slip_rate /
-         effective_regularization_parameter);
+      const double scaling =
+        std::sqrt(M_PI) / 2.0 * inverse_regularization_parameter;
+
+      for (unsigned int i = 0; i < n_values; ++i)
+        y[i] = std::erf(scaling * x[i]);
     }
     break;
   default:
@@ -454,68 +770,87 @@ get_regularization_function_value(const double slip_rate) const
     break;
   }
 
-  AssertIsFinite(regularization_function_value);
-
-  return regularization_function_value;
+#ifdef DEBUG
+  for (unsigned int i = 0; i < n_values; ++i)
+    AssertIsFinite(y[i]);
+#endif
 }
 
 
 
 template <int dim>
-double ScalarMicrostressLaw<dim>::
-get_regularization_function_derivative_value(const double slip_rate) const
+void ScalarMicrostressLaw<dim>::get_regularization_function_derivative_values(
+  const dealii::ArrayView<const double> &slip_rates,
+  const dealii::ArrayView<double>       &derivative_values) const
 {
-  AssertIsFinite(slip_rate);
+  AssertDimension(slip_rates.size(), derivative_values.size());
 
-  double regularization_function_derivative_value = 0.0;
+  const unsigned int n_values = slip_rates.size();
+
+  const double *const x = slip_rates.data();
+
+  double *const y = derivative_values.data();
 
   const double effective_regularization_parameter =
     regularization_multiplier * regularization_parameter;
 
+  const double inverse_regularization_parameter =
+    1.0 / effective_regularization_parameter;
+
+  const double squared_regularization_parameter =
+    effective_regularization_parameter *
+    effective_regularization_parameter;
+
   switch (regularization_function)
   {
   case RunTimeParameters::RegularizationFunction::Atan:
     {
-      regularization_function_derivative_value =
-        effective_regularization_parameter /
-        (effective_regularization_parameter *
-         effective_regularization_parameter +
-         M_PI * M_PI * slip_rate * slip_rate / 4.);
+      for (unsigned int i = 0; i < n_values; ++i)
+        y[i] = effective_regularization_parameter /
+               (squared_regularization_parameter +
+                M_PI * M_PI * x[i] * x[i] / 4.);
     }
     break;
   case RunTimeParameters::RegularizationFunction::Sqrt:
     {
-      regularization_function_derivative_value =
-        effective_regularization_parameter *
-        effective_regularization_parameter /
-        std::pow(slip_rate * slip_rate +
-                  effective_regularization_parameter *
-                  effective_regularization_parameter,
-                 1.5);
+      for (unsigned int i = 0; i < n_values; ++i)
+      {
+        const double inverse_norm =
+          1.0 / std::sqrt(x[i] * x[i] + squared_regularization_parameter);
+
+        y[i] = squared_regularization_parameter *
+               inverse_norm * inverse_norm * inverse_norm;
+      }
     }
     break;
   case RunTimeParameters::RegularizationFunction::Gd:
     {
-      regularization_function_derivative_value =
-        1.0 / std::cosh(M_PI / 2. * slip_rate /
-        effective_regularization_parameter) /
-        effective_regularization_parameter;
+      const double scaling = M_PI / 2.0 * inverse_regularization_parameter;
+
+      for (unsigned int i = 0; i < n_values; ++i)
+        y[i] = inverse_regularization_parameter /
+               std::cosh(scaling * x[i]);
     }
     break;
   case RunTimeParameters::RegularizationFunction::Tanh:
     {
-      regularization_function_derivative_value =
-        std::pow(1.0 / std::cosh(slip_rate / effective_regularization_parameter),
-                 2) / effective_regularization_parameter;
+      for (unsigned int i = 0; i < n_values; ++i)
+      {
+        const double sech =
+          1.0 / std::cosh(inverse_regularization_parameter * x[i]);
+
+        y[i] = sech * sech * inverse_regularization_parameter;
+      }
     }
     break;
   case RunTimeParameters::RegularizationFunction::Erf:
     {
-      regularization_function_derivative_value =
-        1. / effective_regularization_parameter *
-        std::exp(-M_PI * slip_rate * slip_rate /
-                 effective_regularization_parameter /
-                 effective_regularization_parameter / 4.);
+      const double scaling =
+        -M_PI / 4.0 / squared_regularization_parameter;
+
+      for (unsigned int i = 0; i < n_values; ++i)
+        y[i] = inverse_regularization_parameter *
+               std::exp(scaling * x[i] * x[i]);
     }
     break;
   default:
@@ -527,9 +862,10 @@ get_regularization_function_derivative_value(const double slip_rate) const
     break;
   }
 
-  AssertIsFinite(regularization_function_derivative_value);
-
-  return regularization_function_derivative_value;
+#ifdef DEBUG
+  for (unsigned int i = 0; i < n_values; ++i)
+    AssertIsFinite(y[i]);
+#endif
 }
 
 
@@ -543,6 +879,10 @@ crystals_data(crystals_data),
 energetic_length_scale(parameters.energetic_length_scale),
 initial_slip_resistance(parameters.initial_slip_resistance),
 defect_energy_index(parameters.defect_energy_index),
+prefactor(parameters.initial_slip_resistance *
+          std::pow(parameters.energetic_length_scale,
+                   parameters.defect_energy_index)),
+flag_quadratic(parameters.defect_energy_index == 2.0),
 flag_init_was_called(false)
 {}
 
@@ -556,6 +896,11 @@ void VectorialMicrostressLaw<dim>::init()
                                   " instance has not been "
                                   " initialized."));
 
+  // init() is called anew after each change of the mesh
+  slip_direction_dyads.clear();
+
+  slip_binormal_dyads.clear();
+
   for (unsigned int crystal_id = 0;
         crystal_id < crystals_data->get_n_crystals();
         crystal_id++)
@@ -616,6 +961,45 @@ void VectorialMicrostressLaw<dim>::init()
       crystals_data->get_n_crystals(),
     dealii::ExcNotImplemented());
 
+  // Store the slip directions and orthogonals contiguously so that
+  // the projections of the slip gradients do not go through the
+  // asserted accessors of CrystalsData<dim>
+  const unsigned int n_crystals = crystals_data->get_n_crystals();
+
+  const unsigned int n_slips    = crystals_data->get_n_slips();
+
+  slip_direction_components.reinit(n_crystals, dim, n_slips);
+
+  slip_orthogonal_components.reinit(n_crystals, dim, n_slips);
+
+  for (unsigned int crystal_id = 0; crystal_id < n_crystals; ++crystal_id)
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+      for (unsigned int i = 0; i < dim; ++i)
+      {
+        slip_direction_components(crystal_id, i, slip_id) =
+          crystals_data->get_slip_direction(crystal_id, slip_id)[i];
+
+        slip_orthogonal_components(crystal_id, i, slip_id) =
+          crystals_data->get_slip_orthogonal(crystal_id, slip_id)[i];
+      }
+
+  // In the quadratic case the Jacobians are constant
+  quadratic_jacobians.clear();
+
+  if (flag_quadratic)
+  {
+    quadratic_jacobians.resize(
+      n_crystals,
+      std::vector<dealii::SymmetricTensor<2,dim>>(n_slips));
+
+    for (unsigned int crystal_id = 0; crystal_id < n_crystals; ++crystal_id)
+      for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+        quadratic_jacobians[crystal_id][slip_id] =
+          prefactor *
+          (slip_direction_dyads[crystal_id][slip_id] +
+           slip_binormal_dyads[crystal_id][slip_id]);
+  }
+
   flag_init_was_called = true;
 }
 
@@ -635,20 +1019,19 @@ get_vectorial_microstress(
               dealii::ExcMessage("The VectorialMicrostressLaw<dim> "
                                  "instance has not been initialized."));
 
+  if (flag_quadratic)
+    return (quadratic_jacobians[crystal_id][slip_id] * slip_gradient);
+
+  const std::pair<double, double> projections =
+    get_projections(crystal_id, slip_id, slip_gradient);
+
   return (
-    initial_slip_resistance *
-    std::pow(energetic_length_scale, defect_energy_index) *
+    prefactor *
     (
-      std::pow(
-        std::abs(-crystals_data->get_slip_direction(crystal_id, slip_id) *
-                slip_gradient),
-        defect_energy_index - 2.) *
+      get_power(projections.first) *
       slip_direction_dyads[crystal_id][slip_id]
       +
-      std::pow(
-        std::abs(crystals_data->get_slip_orthogonal(crystal_id, slip_id) *
-                slip_gradient),
-        defect_energy_index - 2.) *
+      get_power(projections.second) *
       slip_binormal_dyads[crystal_id][slip_id]
     ) *
     slip_gradient);
@@ -670,262 +1053,431 @@ get_jacobian(
               dealii::ExcMessage("The VectorialMicrostressLaw<dim> "
                                  "instance has not been initialized."));
 
+  if (flag_quadratic)
+    return (quadratic_jacobians[crystal_id][slip_id]);
+
+  const std::pair<double, double> projections =
+    get_projections(crystal_id, slip_id, slip_gradient);
+
   return (
-    initial_slip_resistance *
-    std::pow(energetic_length_scale, defect_energy_index) *
+    prefactor *
     (defect_energy_index - 1.0) *
     (
-      std::pow(
-        std::abs(-crystals_data->get_slip_direction(crystal_id, slip_id) *
-                slip_gradient),
-        defect_energy_index - 2.) *
+      get_power(projections.first) *
       slip_direction_dyads[crystal_id][slip_id]
       +
-      std::pow(
-        std::abs(crystals_data->get_slip_orthogonal(crystal_id, slip_id) *
-                slip_gradient),
-        defect_energy_index - 2.) *
+      get_power(projections.second) *
       slip_binormal_dyads[crystal_id][slip_id]
     ));
 }
 
 
 
-template<int dim>
-MicroscopicTractionLaw<dim>::MicroscopicTractionLaw(
-  const std::shared_ptr<CrystalsData<dim>> &crystals_data,
-  const RunTimeParameters::MicroscopicTractionLawParameters parameters)
-:
-crystals_data(crystals_data),
-grain_boundary_modulus(parameters.grain_boundary_modulus)
-{}
+template <int dim>
+void VectorialMicrostressLaw<dim>::get_vectorial_microstresses(
+  const unsigned int                                    crystal_id,
+  const std::vector<std::vector<dealii::Tensor<1,dim>>> &slip_gradient_values,
+  std::vector<std::vector<dealii::Tensor<1,dim>>>       &vectorial_microstresses) const
+{
+  AssertIndexRange(crystal_id, crystals_data->get_n_crystals());
+  AssertDimension(slip_gradient_values.size(), crystals_data->get_n_slips());
+  AssertDimension(vectorial_microstresses.size(), slip_gradient_values.size());
+
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The VectorialMicrostressLaw<dim> "
+                                 "instance has not been initialized."));
+
+  Utilities::dispatch_n_slips(
+    crystals_data->get_n_slips(),
+    [&](const auto n_slips_at_compile_time)
+    {
+      this->template compute_vectorial_microstresses<
+        decltype(n_slips_at_compile_time)::value>(
+          crystal_id,
+          slip_gradient_values,
+          vectorial_microstresses);
+    });
+}
 
 
 
-template<>
-MicroscopicTractionLaw<2>::GrainInteractionModuli
-MicroscopicTractionLaw<2>::get_grain_interaction_moduli(
-  const unsigned int                crystal_id_current_cell,
-  const unsigned int                crystal_id_neighbour_cell,
-  std::vector<dealii::Tensor<1,2>>  normal_vector_values) const
+template <int dim>
+template <unsigned int n_slips_at_compile_time>
+void VectorialMicrostressLaw<dim>::compute_vectorial_microstresses(
+  const unsigned int                                    crystal_id,
+  const std::vector<std::vector<dealii::Tensor<1,dim>>> &slip_gradient_values,
+  std::vector<std::vector<dealii::Tensor<1,dim>>>       &vectorial_microstresses) const
 {
-  AssertThrow(crystal_id_current_cell != crystal_id_neighbour_cell,
-              dealii::ExcMessage(
-                "The crystal identifiers match. This method only "
-                "meant to be used at grain boundaries"));
+  const unsigned int n_slips =
+    (n_slips_at_compile_time > 0) ? n_slips_at_compile_time
+                                  : crystals_data->get_n_slips();
 
-  const unsigned int n_q_points = normal_vector_values.size();
+  AssertDimension(slip_gradient_values.size(), n_slips);
 
-  std::vector<dealii::FullMatrix<double>> intra_grain_interaction_moduli;
+  // Quadratic case: The microstress is linear in the slip gradient
+  if (flag_quadratic)
+  {
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    {
+      const dealii::SymmetricTensor<2,dim> &jacobian =
+        quadratic_jacobians[crystal_id][slip_id];
 
-  std::vector<dealii::FullMatrix<double>> inter_grain_interaction_moduli;
+      const std::vector<dealii::Tensor<1,dim>> &slip_gradients =
+        slip_gradient_values[slip_id];
 
-  intra_grain_interaction_moduli.reserve(n_q_points);
-  inter_grain_interaction_moduli.reserve(n_q_points);
+      std::vector<dealii::Tensor<1,dim>> &microstresses =
+        vectorial_microstresses[slip_id];
 
-  dealii::FullMatrix<double> intra_grain_interaction_moduli_per_q_point(
-    crystals_data->get_n_slips());
-  dealii::FullMatrix<double> inter_grain_interaction_moduli_per_q_point(
-    crystals_data->get_n_slips());
+      AssertDimension(microstresses.size(), slip_gradients.size());
 
-  // Get slip systems of the current cell
-  std::vector<dealii::Tensor<1,2>> slip_directions_current_cell =
-    crystals_data->get_slip_directions(crystal_id_current_cell);
-  std::vector<dealii::Tensor<1,2>> slip_normals_current_cell =
-    crystals_data->get_slip_normals(crystal_id_current_cell);
+      for (unsigned int q_point = 0; q_point < slip_gradients.size();
+           ++q_point)
+        microstresses[q_point] = jacobian * slip_gradients[q_point];
+    }
 
-  // Get slip systems of the neighbour cell
-  std::vector<dealii::Tensor<1,2>> slip_directions_neighbour_cell =
-    crystals_data->get_slip_directions(crystal_id_neighbour_cell);
-  std::vector<dealii::Tensor<1,2>> slip_normals_neighbour_cell =
-    crystals_data->get_slip_normals(crystal_id_neighbour_cell);
+    return;
+  }
 
-  for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+  // General case: The microstress is computed as
+  // S_0 l^p (|d.g|^(p-2) (d.g) d + |o.g|^(p-2) (o.g) o)
+  // The slip directions and orthogonals of the crystal are gathered
+  // once per call
+  std::conditional_t<(n_slips_at_compile_time > 0),
+                     std::array<dealii::Tensor<1,dim>,
+                                n_slips_at_compile_time>,
+                     std::vector<dealii::Tensor<1,dim>>>
+    slip_directions, slip_orthogonals;
+
+  if constexpr (n_slips_at_compile_time == 0)
   {
-    intra_grain_interaction_moduli_per_q_point = 0.0;
-    inter_grain_interaction_moduli_per_q_point = 0.0;
+    slip_directions.resize(n_slips);
+    slip_orthogonals.resize(n_slips);
+  }
 
-    for (unsigned int slip_id_alpha = 0;
-         slip_id_alpha < crystals_data->get_n_slips(); ++slip_id_alpha)
-      for (unsigned int slip_id_beta = 0;
-           slip_id_beta < crystals_data->get_n_slips(); ++slip_id_beta)
-      {
-        intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta] =
-          (slip_directions_current_cell[slip_id_alpha] *
-           slip_directions_current_cell[slip_id_beta]) *
-          (slip_normals_current_cell[slip_id_alpha][0] *
-           normal_vector_values[q_point][1] -
-           slip_normals_current_cell[slip_id_alpha][1] *
-           normal_vector_values[q_point][0]) *
-          (slip_normals_current_cell[slip_id_beta][0] *
-           normal_vector_values[q_point][1] -
-           slip_normals_current_cell[slip_id_beta][1] *
-           normal_vector_values[q_point][0]);
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    for (unsigned int i = 0; i < dim; ++i)
+    {
+      slip_directions[slip_id][i]   =
+        slip_direction_components(crystal_id, i, slip_id);
 
-        inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta] =
-          (slip_directions_current_cell[slip_id_alpha] *
-           slip_directions_neighbour_cell[slip_id_beta]) *
-          (slip_normals_current_cell[slip_id_alpha][0] *
-           normal_vector_values[q_point][1] -
-           slip_normals_current_cell[slip_id_alpha][1] *
-           normal_vector_values[q_point][0]) *
-          (slip_normals_neighbour_cell[slip_id_beta][0] *
-           normal_vector_values[q_point][1] -
-           slip_normals_neighbour_cell[slip_id_beta][1] *
-           normal_vector_values[q_point][0]);
+      slip_orthogonals[slip_id][i]  =
+        slip_orthogonal_components(crystal_id, i, slip_id);
+    }
 
-        AssertThrow(
-          std::fabs(intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]) >= 0.0 &&
-            std::fabs(intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]) <= (1.0 + 1e-14),
-          dealii::ExcMessage(
-            "The interaction moduli should be inside the "
-            "range [0,1]. Its value is " +
-            std::to_string(
-              std::fabs(
-                intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]))));
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+  {
+    const std::vector<dealii::Tensor<1,dim>> &slip_gradients =
+      slip_gradient_values[slip_id];
 
-        AssertThrow(
-          std::fabs(inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]) >= 0.0 &&
-            std::fabs(inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]) <= (1.0 + 1e-14),
-          dealii::ExcMessage(
-            "The interaction moduli should be inside the "
-            "range [0,1].  Its value is " +
-            std::to_string(
-              std::fabs(
-                inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]))));
+    std::vector<dealii::Tensor<1,dim>> &microstresses =
+      vectorial_microstresses[slip_id];
 
-        AssertIsFinite(
-          intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]);
-        AssertIsFinite(
-          inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]);
-      }
+    AssertDimension(microstresses.size(), slip_gradients.size());
 
-    intra_grain_interaction_moduli.push_back(intra_grain_interaction_moduli_per_q_point);
-    inter_grain_interaction_moduli.push_back(inter_grain_interaction_moduli_per_q_point);
+    for (unsigned int q_point = 0; q_point < slip_gradients.size();
+         ++q_point)
+    {
+      const double direction_projection =
+        slip_directions[slip_id] * slip_gradients[q_point];
+
+      const double orthogonal_projection =
+        slip_orthogonals[slip_id] * slip_gradients[q_point];
+
+      microstresses[q_point] =
+        prefactor *
+        (get_power(direction_projection) * direction_projection *
+           slip_directions[slip_id]
+         +
+         get_power(orthogonal_projection) * orthogonal_projection *
+           slip_orthogonals[slip_id]);
+    }
   }
+}
 
-  AssertThrow(normal_vector_values.size() ==
-              intra_grain_interaction_moduli.size(),
-              dealii::ExcDimensionMismatch(
-                normal_vector_values.size(),
-                intra_grain_interaction_moduli.size()));
-  AssertThrow(normal_vector_values.size() ==
-              inter_grain_interaction_moduli.size(),
-              dealii::ExcDimensionMismatch(
-                normal_vector_values.size(),
-                inter_grain_interaction_moduli.size()));
 
-  return (std::make_pair(intra_grain_interaction_moduli,
-                         inter_grain_interaction_moduli));
+
+template <int dim>
+void VectorialMicrostressLaw<dim>::get_jacobians(
+  const unsigned int                                        crystal_id,
+  const std::vector<std::vector<dealii::Tensor<1,dim>>>     &slip_gradient_values,
+  std::vector<std::vector<dealii::SymmetricTensor<2,dim>>>  &jacobians) const
+{
+  AssertIndexRange(crystal_id, crystals_data->get_n_crystals());
+  AssertDimension(slip_gradient_values.size(), crystals_data->get_n_slips());
+
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The VectorialMicrostressLaw<dim> "
+                                 "instance has not been initialized."));
+
+  Utilities::dispatch_n_slips(
+    crystals_data->get_n_slips(),
+    [&](const auto n_slips_at_compile_time)
+    {
+      this->template compute_jacobians<
+        decltype(n_slips_at_compile_time)::value>(
+          crystal_id,
+          slip_gradient_values,
+          jacobians);
+    });
+}
+
+
+
+template <int dim>
+template <unsigned int n_slips_at_compile_time>
+void VectorialMicrostressLaw<dim>::compute_jacobians(
+  const unsigned int                                        crystal_id,
+  const std::vector<std::vector<dealii::Tensor<1,dim>>>     &slip_gradient_values,
+  std::vector<std::vector<dealii::SymmetricTensor<2,dim>>>  &jacobians) const
+{
+  const unsigned int n_slips =
+    (n_slips_at_compile_time > 0) ? n_slips_at_compile_time
+                                  : crystals_data->get_n_slips();
+
+  AssertDimension(slip_gradient_values.size(), n_slips);
+
+  // Quadratic case: The Jacobians are constant
+  if (flag_quadratic)
+  {
+    for (unsigned int q_point = 0; q_point < jacobians.size(); ++q_point)
+    {
+      AssertDimension(jacobians[q_point].size(), n_slips);
+
+      std::copy(quadratic_jacobians[crystal_id].begin(),
+                quadratic_jacobians[crystal_id].end(),
+                jacobians[q_point].begin());
+    }
+
+    return;
+  }
+
+  std::conditional_t<(n_slips_at_compile_time > 0),
+                     std::array<dealii::Tensor<1,dim>,
+                                n_slips_at_compile_time>,
+                     std::vector<dealii::Tensor<1,dim>>>
+    slip_directions, slip_orthogonals;
+
+  if constexpr (n_slips_at_compile_time == 0)
+  {
+    slip_directions.resize(n_slips);
+    slip_orthogonals.resize(n_slips);
+  }
+
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    for (unsigned int i = 0; i < dim; ++i)
+    {
+      slip_directions[slip_id][i]   =
+        slip_direction_components(crystal_id, i, slip_id);
+
+      slip_orthogonals[slip_id][i]  =
+        slip_orthogonal_components(crystal_id, i, slip_id);
+    }
+
+  const double scaled_prefactor = prefactor * (defect_energy_index - 1.0);
+
+  for (unsigned int q_point = 0; q_point < jacobians.size(); ++q_point)
+  {
+    AssertDimension(jacobians[q_point].size(), n_slips);
+
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    {
+      const dealii::Tensor<1,dim> &slip_gradient =
+        slip_gradient_values[slip_id][q_point];
+
+      jacobians[q_point][slip_id] =
+        scaled_prefactor *
+        (get_power(slip_directions[slip_id] * slip_gradient) *
+           slip_direction_dyads[crystal_id][slip_id]
+         +
+         get_power(slip_orthogonals[slip_id] * slip_gradient) *
+           slip_binormal_dyads[crystal_id][slip_id]);
+    }
+  }
 }
 
 
 
-template<>
-MicroscopicTractionLaw<3>::GrainInteractionModuli
-MicroscopicTractionLaw<3>::get_grain_interaction_moduli(
-  const unsigned int                crystal_id_current_cell,
-  const unsigned int                crystal_id_neighbour_cell,
-  std::vector<dealii::Tensor<1,3>>  normal_vector_values) const
+template<int dim>
+MicroscopicTractionLaw<dim>::MicroscopicTractionLaw(
+  const std::shared_ptr<CrystalsData<dim>> &crystals_data,
+  const RunTimeParameters::MicroscopicTractionLawParameters parameters)
+:
+crystals_data(crystals_data),
+grain_boundary_modulus(parameters.grain_boundary_modulus)
+{}
+
+
+
+template<int dim>
+typename MicroscopicTractionLaw<dim>::GrainInteractionModuli
+MicroscopicTractionLaw<dim>::get_grain_interaction_moduli(
+  const unsigned int                        crystal_id_current_cell,
+  const unsigned int                        crystal_id_neighbour_cell,
+  const std::vector<dealii::Tensor<1,dim>>  &normal_vector_values) const
 {
   AssertThrow(crystal_id_current_cell != crystal_id_neighbour_cell,
               dealii::ExcMessage(
                 "The crystal identifiers match. This method only "
                 "meant to be used at grain boundaries"));
 
-  const unsigned int n_q_points = normal_vector_values.size();
+  GrainInteractionModuli grain_interaction_moduli;
+
+  Utilities::dispatch_n_slips(
+    crystals_data->get_n_slips(),
+    [&](const auto n_slips_at_compile_time)
+    {
+      grain_interaction_moduli =
+        this->template compute_grain_interaction_moduli<
+          decltype(n_slips_at_compile_time)::value>(
+            crystal_id_current_cell,
+            crystal_id_neighbour_cell,
+            normal_vector_values);
+    });
+
+  AssertThrow(normal_vector_values.size() ==
+              grain_interaction_moduli.first.size(),
+              dealii::ExcDimensionMismatch(
+                normal_vector_values.size(),
+                grain_interaction_moduli.first.size()));
+  AssertThrow(normal_vector_values.size() ==
+              grain_interaction_moduli.second.size(),
+              dealii::ExcDimensionMismatch(
+                normal_vector_values.size(),
+                grain_interaction_moduli.second.size()));
 
-  std::vector<dealii::FullMatrix<double>> intra_grain_interaction_moduli;
+  return (grain_interaction_moduli);
+}
 
-  std::vector<dealii::FullMatrix<double>> inter_grain_interaction_moduli;
 
-  intra_grain_interaction_moduli.reserve(n_q_points);
-  inter_grain_interaction_moduli.reserve(n_q_points);
 
-  dealii::FullMatrix<double> intra_grain_interaction_moduli_per_q_point(
-    crystals_data->get_n_slips());
-  dealii::FullMatrix<double> inter_grain_interaction_moduli_per_q_point(
-    crystals_data->get_n_slips());
+template<int dim>
+template <unsigned int n_slips_at_compile_time>
+typename MicroscopicTractionLaw<dim>::GrainInteractionModuli
+MicroscopicTractionLaw<dim>::compute_grain_interaction_moduli(
+  const unsigned int                        crystal_id_current_cell,
+  const unsigned int                        crystal_id_neighbour_cell,
+  const std::vector<dealii::Tensor<1,dim>>  &normal_vector_values) const
+{
+  const unsigned int n_slips =
+    (n_slips_at_compile_time > 0) ? n_slips_at_compile_time
+                                  : crystals_data->get_n_slips();
+
+  const unsigned int n_q_points = normal_vector_values.size();
 
   // Get slip systems of the current cell
-  std::vector<dealii::Tensor<1,3>> slip_directions_current_cell =
+  const std::vector<dealii::Tensor<1,dim>> &slip_directions_current_cell =
     crystals_data->get_slip_directions(crystal_id_current_cell);
-  std::vector<dealii::Tensor<1,3>> slip_normals_current_cell =
+  const std::vector<dealii::Tensor<1,dim>> &slip_normals_current_cell =
     crystals_data->get_slip_normals(crystal_id_current_cell);
 
   // Get slip systems of the neighbour cell
-  std::vector<dealii::Tensor<1,3>> slip_directions_neighbour_cell =
+  const std::vector<dealii::Tensor<1,dim>> &slip_directions_neighbour_cell =
     crystals_data->get_slip_directions(crystal_id_neighbour_cell);
-  std::vector<dealii::Tensor<1,3>> slip_normals_neighbour_cell =
+  const std::vector<dealii::Tensor<1,dim>> &slip_normals_neighbour_cell =
     crystals_data->get_slip_normals(crystal_id_neighbour_cell);
 
+  AssertDimension(slip_directions_current_cell.size(), n_slips);
+  AssertDimension(slip_directions_neighbour_cell.size(), n_slips);
+
+  // The products of the slip directions do not depend on the
+  // quadrature point
+  dealii::FullMatrix<double> intra_slip_direction_products(n_slips);
+  dealii::FullMatrix<double> inter_slip_direction_products(n_slips);
+
+  for (unsigned int slip_id_alpha = 0; slip_id_alpha < n_slips;
+       ++slip_id_alpha)
+    for (unsigned int slip_id_beta = 0; slip_id_beta < n_slips;
+         ++slip_id_beta)
+    {
+      intra_slip_direction_products[slip_id_alpha][slip_id_beta] =
+        slip_directions_current_cell[slip_id_alpha] *
+        slip_directions_current_cell[slip_id_beta];
+
+      inter_slip_direction_products[slip_id_alpha][slip_id_beta] =
+        slip_directions_current_cell[slip_id_alpha] *
+        slip_directions_neighbour_cell[slip_id_beta];
+    }
+
+  std::conditional_t<(n_slips_at_compile_time > 0),
+                     std::array<dealii::Tensor<1,3>,
+                                n_slips_at_compile_time>,
+                     std::vector<dealii::Tensor<1,3>>>
+    tangential_slip_normals_current_cell,
+    tangential_slip_normals_neighbour_cell;
+
+  if constexpr (n_slips_at_compile_time == 0)
+  {
+    tangential_slip_normals_current_cell.resize(n_slips);
+    tangential_slip_normals_neighbour_cell.resize(n_slips);
+  }
+
+  GrainInteractionModuli grain_interaction_moduli;
+
+  grain_interaction_moduli.first.resize(
+    n_q_points, dealii::FullMatrix<double>(n_slips));
+  grain_interaction_moduli.second.resize(
+    n_q_points, dealii::FullMatrix<double>(n_slips));
+
   for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
   {
-    intra_grain_interaction_moduli_per_q_point = 0.0;
-    inter_grain_interaction_moduli_per_q_point = 0.0;
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    {
+      tangential_slip_normals_current_cell[slip_id] =
+        get_tangential_slip_normal(slip_normals_current_cell[slip_id],
+                                   normal_vector_values[q_point]);
 
-    for (unsigned int slip_id_alpha = 0;
-         slip_id_alpha < crystals_data->get_n_slips(); ++slip_id_alpha)
-      for (unsigned int slip_id_beta = 0;
-           slip_id_beta < crystals_data->get_n_slips(); ++slip_id_beta)
+      tangential_slip_normals_neighbour_cell[slip_id] =
+        get_tangential_slip_normal(slip_normals_neighbour_cell[slip_id],
+                                   normal_vector_values[q_point]);
+    }
+
+    dealii::FullMatrix<double> &intra_grain_interaction_moduli_per_q_point =
+      grain_interaction_moduli.first[q_point];
+
+    dealii::FullMatrix<double> &inter_grain_interaction_moduli_per_q_point =
+      grain_interaction_moduli.second[q_point];
+
+    for (unsigned int slip_id_alpha = 0; slip_id_alpha < n_slips;
+         ++slip_id_alpha)
+      for (unsigned int slip_id_beta = 0; slip_id_beta < n_slips;
+           ++slip_id_beta)
       {
         intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta] =
-          (slip_directions_current_cell[slip_id_alpha] *
-           slip_directions_current_cell[slip_id_beta]) *
-          (dealii::cross_product_3d(
-            slip_normals_current_cell[slip_id_alpha],
-            normal_vector_values[q_point]) *
-           dealii::cross_product_3d(
-            slip_normals_current_cell[slip_id_beta],
-            normal_vector_values[q_point]));
+          intra_slip_direction_products[slip_id_alpha][slip_id_beta] *
+          (tangential_slip_normals_current_cell[slip_id_alpha] *
+           tangential_slip_normals_current_cell[slip_id_beta]);
 
         inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta] =
-          (slip_directions_current_cell[slip_id_alpha] *
-           slip_directions_neighbour_cell[slip_id_beta]) *
-          (dealii::cross_product_3d(
-            slip_normals_current_cell[slip_id_alpha],
-            normal_vector_values[q_point]) *
-           dealii::cross_product_3d(
-            slip_normals_neighbour_cell[slip_id_beta],
-            normal_vector_values[q_point]));
+          inter_slip_direction_products[slip_id_alpha][slip_id_beta] *
+          (tangential_slip_normals_current_cell[slip_id_alpha] *
+           tangential_slip_normals_neighbour_cell[slip_id_beta]);
 
         AssertThrow(
-          std::fabs(intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]) >= 0.0 &&
-            std::fabs(intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]) <= 1.0,
+          std::fabs(intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]) <= (1.0 + 1e-14),
           dealii::ExcMessage(
             "The interaction moduli should be inside the "
-            "range [0,1]."));
+            "range [0,1]. Its value is " +
+            std::to_string(
+              std::fabs(
+                intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]))));
 
         AssertThrow(
-          std::fabs(inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]) >= 0.0 &&
-            std::fabs(inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]) <= 1.0,
+          std::fabs(inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]) <= (1.0 + 1e-14),
           dealii::ExcMessage(
             "The interaction moduli should be inside the "
-            "range [0,1]."));
+            "range [0,1]. Its value is " +
+            std::to_string(
+              std::fabs(
+                inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]))));
 
         AssertIsFinite(
           intra_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]);
         AssertIsFinite(
           inter_grain_interaction_moduli_per_q_point[slip_id_alpha][slip_id_beta]);
       }
-
-    intra_grain_interaction_moduli.push_back(intra_grain_interaction_moduli_per_q_point);
-    inter_grain_interaction_moduli.push_back(inter_grain_interaction_moduli_per_q_point);
   }
 
-  AssertThrow(normal_vector_values.size() ==
-              intra_grain_interaction_moduli.size(),
-              dealii::ExcDimensionMismatch(
-                normal_vector_values.size(),
-                intra_grain_interaction_moduli.size()));
-  AssertThrow(normal_vector_values.size() ==
-              inter_grain_interaction_moduli.size(),
-              dealii::ExcDimensionMismatch(
-                normal_vector_values.size(),
-                inter_grain_interaction_moduli.size()));
-
-  return (std::make_pair(intra_grain_interaction_moduli,
-                         inter_grain_interaction_moduli));
+  return (grain_interaction_moduli);
 }
 
 
@@ -934,9 +1486,9 @@ template <int dim>
 double MicroscopicTractionLaw<dim>::get_microscopic_traction(
   const unsigned int                      q_point,
   const unsigned int                      slip_id_alpha,
-  const GrainInteractionModuli            grain_interaction_moduli,
-  const std::vector<std::vector<double>>  slip_values_current_cell,
-  const std::vector<std::vector<double>>  slip_values_neighbour_cell) const
+  const GrainInteractionModuli            &grain_interaction_moduli,
+  const std::vector<std::vector<double>>  &slip_values_current_cell,
+  const std::vector<std::vector<double>>  &slip_values_neighbour_cell) const
 {
   double microscopic_traction = 0.0;
 
@@ -956,12 +1508,109 @@ double MicroscopicTractionLaw<dim>::get_microscopic_traction(
 
 
 
+
+template <int dim>
+void MicroscopicTractionLaw<dim>::get_microscopic_tractions(
+  const GrainInteractionModuli            &grain_interaction_moduli,
+  const std::vector<std::vector<double>>  &slip_values_current_cell,
+  const std::vector<std::vector<double>>  &slip_values_neighbour_cell,
+  std::vector<std::vector<double>>        &microscopic_tractions) const
+{
+  AssertDimension(slip_values_current_cell.size(),
+                  crystals_data->get_n_slips());
+  AssertDimension(slip_values_neighbour_cell.size(),
+                  crystals_data->get_n_slips());
+  AssertDimension(microscopic_tractions.size(),
+                  crystals_data->get_n_slips());
+
+  Utilities::dispatch_n_slips(
+    crystals_data->get_n_slips(),
+    [&](const auto n_slips_at_compile_time)
+    {
+      this->template compute_microscopic_tractions<
+        decltype(n_slips_at_compile_time)::value>(
+          grain_interaction_moduli,
+          slip_values_current_cell,
+          slip_values_neighbour_cell,
+          microscopic_tractions);
+    });
+}
+
+
+
+template <int dim>
+template <unsigned int n_slips_at_compile_time>
+void MicroscopicTractionLaw<dim>::compute_microscopic_tractions(
+  const GrainInteractionModuli            &grain_interaction_moduli,
+  const std::vector<std::vector<double>>  &slip_values_current_cell,
+  const std::vector<std::vector<double>>  &slip_values_neighbour_cell,
+  std::vector<std::vector<double>>        &microscopic_tractions) const
+{
+  const unsigned int n_slips =
+    (n_slips_at_compile_time > 0) ? n_slips_at_compile_time
+                                  : crystals_data->get_n_slips();
+
+  const unsigned int n_q_points = grain_interaction_moduli.first.size();
+
+  std::conditional_t<(n_slips_at_compile_time > 0),
+                     std::array<double, n_slips_at_compile_time>,
+                     std::vector<double>>
+    slip_values_current_cell_per_q_point,
+    slip_values_neighbour_cell_per_q_point;
+
+  if constexpr (n_slips_at_compile_time == 0)
+  {
+    slip_values_current_cell_per_q_point.resize(n_slips);
+    slip_values_neighbour_cell_per_q_point.resize(n_slips);
+  }
+
+  for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+  {
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    {
+      AssertDimension(microscopic_tractions[slip_id].size(), n_q_points);
+
+      slip_values_current_cell_per_q_point[slip_id] =
+        slip_values_current_cell[slip_id][q_point];
+
+      slip_values_neighbour_cell_per_q_point[slip_id] =
+        slip_values_neighbour_cell[slip_id][q_point];
+    }
+
+    const dealii::FullMatrix<double> &intra_grain_interaction_moduli =
+      grain_interaction_moduli.first[q_point];
+
+    const dealii::FullMatrix<double> &inter_grain_interaction_moduli =
+      grain_interaction_moduli.second[q_point];
+
+    for (unsigned int slip_id_alpha = 0; slip_id_alpha < n_slips;
+         ++slip_id_alpha)
+    {
+      double microscopic_traction = 0.0;
+
+      for (unsigned int slip_id_beta = 0; slip_id_beta < n_slips;
+           ++slip_id_beta)
+        microscopic_traction +=
+          intra_grain_interaction_moduli[slip_id_alpha][slip_id_beta] *
+          slip_values_current_cell_per_q_point[slip_id_beta]
+          -
+          inter_grain_interaction_moduli[slip_id_alpha][slip_id_beta] *
+          slip_values_neighbour_cell_per_q_point[slip_id_beta];
+
+      microscopic_tractions[slip_id_alpha][q_point] =
+        -grain_boundary_modulus * microscopic_traction;
+    }
+  }
+}
+
+
+
 template <int dim>
 const dealii::FullMatrix<double>
 MicroscopicTractionLaw<dim>::
   get_intra_gateaux_derivative(
     const unsigned int            q_point,
-    const GrainInteractionModuli  grain_interaction_moduli) const
+    const GrainInteractionModuli  &grain_interaction_moduli) const
 {
   dealii::FullMatrix<double> intra_gateaux_derivative =
     grain_interaction_moduli.first[q_point];
@@ -984,7 +1633,7 @@ const dealii::FullMatrix<double>
 MicroscopicTractionLaw<dim>::
   get_inter_gateaux_derivative(
     const unsigned int            q_point,
-    const GrainInteractionModuli  grain_interaction_moduli) const
+    const GrainInteractionModuli  &grain_interaction_moduli) const
 {
   dealii::FullMatrix<double> inter_gateaux_derivative =
     grain_interaction_moduli.second[q_point];
@@ -1128,7 +1777,12 @@ CohesiveLaw<dim>::CohesiveLaw(
 critical_cohesive_traction(parameters.critical_cohesive_traction),
 critical_opening_displacement(parameters.critical_opening_displacement),
 tangential_to_normal_stiffness_ratio(parameters.tangential_to_normal_stiffness_ratio),
-degradation_exponent(parameters.degradation_exponent)
+degradation_exponent(parameters.degradation_exponent),
+damage_accumulation_constant(parameters.damage_accumulation_constant),
+damage_decay_constant(parameters.damage_decay_constant),
+damage_decay_exponent(parameters.damage_decay_exponent),
+endurance_limit(parameters.endurance_limit),
+flag_set_damage_to_zero(parameters.flag_set_damage_to_zero)
 {}
 
 
@@ -1281,6 +1935,242 @@ CohesiveLaw<dim>::get_jacobian(
 
 
 
+template <int dim>
+void CohesiveLaw<dim>::get_cohesive_tractions(
+  const std::vector<dealii::Tensor<1,dim>>  &opening_displacements,
+  const std::vector<dealii::Tensor<1,dim>>  &normal_vectors,
+  const std::vector<double>                 &max_effective_opening_displacements,
+  std::vector<dealii::Tensor<1,dim>>        &cohesive_tractions) const
+{
+  const unsigned int n_points = opening_displacements.size();
+
+  AssertDimension(normal_vectors.size(), n_points);
+  AssertDimension(max_effective_opening_displacements.size(), n_points);
+  AssertDimension(cohesive_tractions.size(), n_points);
+
+  const double squared_stiffness_ratio =
+    tangential_to_normal_stiffness_ratio *
+    tangential_to_normal_stiffness_ratio;
+
+  const double initial_stiffness =
+    critical_cohesive_traction / critical_opening_displacement;
+
+  for (unsigned int q_point = 0; q_point < n_points; ++q_point)
+  {
+    const dealii::Tensor<1,dim> &opening_displacement =
+      opening_displacements[q_point];
+
+    const dealii::Tensor<1,dim> &normal_vector = normal_vectors[q_point];
+
+    const double normal_opening_displacement =
+      normal_vector * opening_displacement;
+
+    // Masked Macaulay brackets
+    const double positive_normal_opening_displacement =
+      (normal_opening_displacement > 0.0) ?
+        normal_opening_displacement : 0.0;
+
+    // Unnormalized effective direction, i.e., the effective direction
+    // scaled by the effective opening displacement
+    const dealii::Tensor<1,dim> scaled_effective_direction =
+      squared_stiffness_ratio * opening_displacement
+      +
+      (positive_normal_opening_displacement -
+       squared_stiffness_ratio * normal_opening_displacement) *
+      normal_vector;
+
+    Assert(
+      std::sqrt(positive_normal_opening_displacement *
+                positive_normal_opening_displacement
+                +
+                squared_stiffness_ratio *
+                (opening_displacement -
+                 normal_opening_displacement * normal_vector).norm_square())
+        <= (1.0 + 1e-12) * max_effective_opening_displacements[q_point],
+      dealii::ExcMessage(
+        "The effective opening displacement is not suppose to be "
+        "bigger than the maximum. An update_values() call ought to "
+        "be missing in code."));
+
+    cohesive_tractions[q_point] =
+      initial_stiffness *
+      std::exp(1.0 - max_effective_opening_displacements[q_point] /
+                     critical_opening_displacement) *
+      scaled_effective_direction;
+
+    for (unsigned int i = 0; i < dim; ++i)
+      AssertIsFinite(cohesive_tractions[q_point][i]);
+  }
+}
+
+
+
+template <int dim>
+void CohesiveLaw<dim>::get_jacobians(
+  const std::vector<dealii::Tensor<1,dim>>  &opening_displacements,
+  const std::vector<dealii::Tensor<1,dim>>  &normal_vectors,
+  const std::vector<double>                 &max_effective_opening_displacements,
+  const std::vector<double>                 &old_effective_opening_displacements,
+  const double                              time_step_size,
+  std::vector<dealii::SymmetricTensor<2,dim>> &jacobians) const
+{
+  const unsigned int n_points = opening_displacements.size();
+
+  AssertDimension(normal_vectors.size(), n_points);
+  AssertDimension(max_effective_opening_displacements.size(), n_points);
+  AssertDimension(old_effective_opening_displacements.size(), n_points);
+  AssertDimension(jacobians.size(), n_points);
+  AssertIsFinite(1.0 / time_step_size);
+
+  const double squared_stiffness_ratio =
+    tangential_to_normal_stiffness_ratio *
+    tangential_to_normal_stiffness_ratio;
+
+  const double initial_stiffness =
+    critical_cohesive_traction / critical_opening_displacement;
+
+  for (unsigned int q_point = 0; q_point < n_points; ++q_point)
+  {
+    const dealii::Tensor<1,dim> &opening_displacement =
+      opening_displacements[q_point];
+
+    const dealii::Tensor<1,dim> &normal_vector = normal_vectors[q_point];
+
+    const double normal_opening_displacement =
+      normal_vector * opening_displacement;
+
+    // Masked Macaulay brackets of the normal opening displacement and
+    // of its sign
+    const double normal_mask =
+      (normal_opening_displacement > 0.0) ? 1.0 : 0.0;
+
+    const double positive_normal_opening_displacement =
+      normal_mask * normal_opening_displacement;
+
+    // The tangential component and the effective opening displacement
+    // are computed in the same order of operations as in
+    // get_effective_opening_displacement(), from which the maximum
+    // effective opening displacement stems, so that the equality
+    // test of the loading criterion is not spoiled by round-off
+    dealii::Tensor<1,dim> tangential_opening_displacement;
+
+    for (unsigned int i = 0; i < dim; ++i)
+      for (unsigned int j = 0; j < dim; ++j)
+        tangential_opening_displacement[i] +=
+          ((i == j ? 1.0 : 0.0) - normal_vector[i] * normal_vector[j]) *
+          opening_displacement[j];
+
+    const double tangential_opening_displacement_norm =
+      tangential_opening_displacement.norm();
+
+    const double effective_opening_displacement =
+      std::sqrt(positive_normal_opening_displacement *
+                positive_normal_opening_displacement
+                +
+                squared_stiffness_ratio *
+                tangential_opening_displacement_norm *
+                tangential_opening_displacement_norm);
+
+    const double inverse_effective_opening_displacement =
+      (effective_opening_displacement != 0.0) ?
+        1.0 / effective_opening_displacement : 1.0;
+
+    const dealii::Tensor<1,dim> effective_direction =
+      inverse_effective_opening_displacement *
+      (positive_normal_opening_displacement * normal_vector
+       +
+       squared_stiffness_ratio * tangential_opening_displacement);
+
+    const double max_effective_opening_displacement =
+      max_effective_opening_displacements[q_point];
+
+    Assert(
+      effective_opening_displacement <=
+        (1.0 + 1e-12) * max_effective_opening_displacement,
+      dealii::ExcMessage(
+        "The effective opening displacement is not suppose to be "
+        "bigger than the maximum. An update_values() call ought to "
+        "be missing in code."));
+
+    // Loading mask. The time step size is positive, hence only the
+    // sign of the increment enters
+    const double loading_mask =
+      (effective_opening_displacement ==
+         max_effective_opening_displacement &&
+       (effective_opening_displacement -
+        old_effective_opening_displacements[q_point]) * time_step_size
+         >= 0.0) ? 1.0 : 0.0;
+
+    const double factor =
+      initial_stiffness *
+      std::exp(1.0 - max_effective_opening_displacement /
+                     critical_opening_displacement);
+
+    const double rank_one_factor =
+      loading_mask *
+      effective_opening_displacement / critical_opening_displacement;
+
+    dealii::SymmetricTensor<2,dim> &jacobian = jacobians[q_point];
+
+    for (unsigned int i = 0; i < dim; ++i)
+      for (unsigned int j = i; j < dim; ++j)
+        jacobian[i][j] =
+          factor *
+          ((normal_mask - squared_stiffness_ratio) *
+             normal_vector[i] * normal_vector[j]
+           +
+           (i == j ? squared_stiffness_ratio : 0.0)
+           -
+           rank_one_factor *
+             effective_direction[i] * effective_direction[j]);
+
+    for (unsigned int i = 0;
+         i < jacobian.n_independent_components; ++i)
+      AssertIsFinite(jacobian.access_raw_entry(i));
+  }
+}
+
+
+
+template <int dim>
+double CohesiveLaw<dim>::get_damage_variable(
+  const double max_effective_opening_displacement) const
+{
+  if (flag_set_damage_to_zero)
+    return (0.0);
+
+  const double displacement_ratio =
+     max_effective_opening_displacement / critical_opening_displacement;
+
+  return (1.0 - (1.0 + displacement_ratio) * std::exp(-displacement_ratio));
+}
+
+
+
+template <int dim>
+double CohesiveLaw<dim>::get_damage_variable(
+  const double committed_damage_variable,
+  const double effective_opening_displacement,
+  const double old_effective_opening_displacement,
+  const double thermodynamic_force) const
+{
+  if (flag_set_damage_to_zero)
+    return (0.0);
+
+  const double damage_variable =
+    committed_damage_variable +
+    damage_accumulation_constant *
+    macaulay_brackets(effective_opening_displacement -
+                      old_effective_opening_displacement) *
+    std::pow(1.0 - committed_damage_variable + damage_decay_constant,
+     damage_decay_exponent) *
+    (thermodynamic_force - endurance_limit);
+
+  return (std::min(damage_variable, 1.0));
+}
+
+
+
 template <int dim>
 double CohesiveLaw<dim>::get_free_energy_density(
   const double effective_opening_displacement) const
@@ -1467,6 +2357,68 @@ ContactLaw<dim>::get_jacobian(
 }
 
 
+
+template <int dim>
+void ContactLaw<dim>::get_contact_tractions(
+  const std::vector<dealii::Tensor<1,dim>>  &opening_displacements,
+  const std::vector<dealii::Tensor<1,dim>>  &normal_vectors,
+  std::vector<dealii::Tensor<1,dim>>        &contact_tractions) const
+{
+  const unsigned int n_points = opening_displacements.size();
+
+  AssertDimension(normal_vectors.size(), n_points);
+  AssertDimension(contact_tractions.size(), n_points);
+
+  for (unsigned int q_point = 0; q_point < n_points; ++q_point)
+  {
+    const double normal_opening_displacement =
+      opening_displacements[q_point] * normal_vectors[q_point];
+
+    // Masked Macaulay brackets of the negative normal opening
+    // displacement
+    const double penetration =
+      (normal_opening_displacement < 0.0) ?
+        -normal_opening_displacement : 0.0;
+
+    contact_tractions[q_point] =
+      -penalty_coefficient * penetration * normal_vectors[q_point];
+
+    for (unsigned int i = 0; i < dim; ++i)
+      AssertIsFinite(contact_tractions[q_point][i]);
+  }
+}
+
+
+
+template <int dim>
+void ContactLaw<dim>::get_jacobians(
+  const std::vector<dealii::Tensor<1,dim>>    &opening_displacements,
+  const std::vector<dealii::Tensor<1,dim>>    &normal_vectors,
+  std::vector<dealii::SymmetricTensor<2,dim>> &jacobians) const
+{
+  const unsigned int n_points = opening_displacements.size();
+
+  AssertDimension(normal_vectors.size(), n_points);
+  AssertDimension(jacobians.size(), n_points);
+
+  for (unsigned int q_point = 0; q_point < n_points; ++q_point)
+  {
+    const dealii::Tensor<1,dim> &normal_vector = normal_vectors[q_point];
+
+    // Masked Macaulay brackets of the sign of the negative normal
+    // opening displacement
+    const double factor =
+      (opening_displacements[q_point] * normal_vector < 0.0) ?
+        penalty_coefficient : 0.0;
+
+    for (unsigned int i = 0; i < dim; ++i)
+      for (unsigned int j = i; j < dim; ++j)
+        jacobians[q_point][i][j] =
+          factor * normal_vector[i] * normal_vector[j];
+  }
+}
+
+
 } // ConstitutiveLaws
 
 
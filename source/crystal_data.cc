@@ -1,5 +1,6 @@
 #include <gCP/crystal_data.h>
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/tensor.h>
 
 #include <fstream>
@@ -419,41 +420,57 @@ void CrystalsData<dim>::compute_3d_rotation_matrices()
 template<int dim>
 void CrystalsData<dim>::compute_slip_systems()
 {
-  for (unsigned int crystal_id = 0; crystal_id < n_crystals; crystal_id++)
-  {
-    std::vector<dealii::Tensor<1,dim>>  rotated_slip_directions(n_slips);
-    std::vector<dealii::Tensor<1,dim>>  rotated_slip_normals(n_slips);
-    std::vector<dealii::Tensor<1,dim>>  rotated_slip_orthogonals(n_slips);
-    std::vector<dealii::Tensor<2,dim>>  rotated_schmid_tensor(n_slips);
-    std::vector<dealii::SymmetricTensor<2,dim>>
-                                        rotated_symmetrized_schmid_tensor(n_slips);
-
-    for (unsigned int slip_id = 0; slip_id < n_slips; slip_id++)
+  slip_directions.resize(n_crystals);
+  slip_normals.resize(n_crystals);
+  slip_orthogonals.resize(n_crystals);
+  schmid_tensors.resize(n_crystals);
+  symmetrized_schmid_tensors.resize(n_crystals);
+
+  // The crystals are independent of each other and are therefore
+  // processed in parallel
+  dealii::parallel::apply_to_subranges(
+    0U,
+    n_crystals,
+    [this](const unsigned int begin, const unsigned int end)
     {
-      rotated_slip_directions[slip_id] =
-        rotation_tensors[crystal_id] *
-        reference_slip_directions[slip_id];
-      rotated_slip_normals[slip_id] =
-        rotation_tensors[crystal_id] *
-        reference_slip_normals[slip_id];
-      rotated_slip_orthogonals[slip_id] =
-        rotation_tensors[crystal_id] *
-        reference_slip_orthogonals[slip_id];
-
-      rotated_schmid_tensor[slip_id] =
-        dealii::outer_product(rotated_slip_directions[slip_id],
-                              rotated_slip_normals[slip_id]);
-
-      rotated_symmetrized_schmid_tensor[slip_id] =
-        dealii::symmetrize(rotated_schmid_tensor[slip_id]);
-    }
+      for (unsigned int crystal_id = begin; crystal_id < end; crystal_id++)
+      {
+        std::vector<dealii::Tensor<1,dim>>  rotated_slip_directions(n_slips);
+        std::vector<dealii::Tensor<1,dim>>  rotated_slip_normals(n_slips);
+        std::vector<dealii::Tensor<1,dim>>  rotated_slip_orthogonals(n_slips);
+        std::vector<dealii::Tensor<2,dim>>  rotated_schmid_tensor(n_slips);
+        std::vector<dealii::SymmetricTensor<2,dim>>
+                                            rotated_symmetrized_schmid_tensor(n_slips);
+
+        for (unsigned int slip_id = 0; slip_id < n_slips; slip_id++)
+        {
+          rotated_slip_directions[slip_id] =
+            rotation_tensors[crystal_id] *
+            reference_slip_directions[slip_id];
+          rotated_slip_normals[slip_id] =
+            rotation_tensors[crystal_id] *
+            reference_slip_normals[slip_id];
+          rotated_slip_orthogonals[slip_id] =
+            rotation_tensors[crystal_id] *
+            reference_slip_orthogonals[slip_id];
+
+          rotated_schmid_tensor[slip_id] =
+            dealii::outer_product(rotated_slip_directions[slip_id],
+                                  rotated_slip_normals[slip_id]);
+
+          rotated_symmetrized_schmid_tensor[slip_id] =
+            dealii::symmetrize(rotated_schmid_tensor[slip_id]);
+        }
 
-    slip_directions.push_back(rotated_slip_directions);
-    slip_normals.push_back(rotated_slip_normals);
-    slip_orthogonals.push_back(rotated_slip_orthogonals);
-    schmid_tensors.push_back(rotated_schmid_tensor);
-    symmetrized_schmid_tensors.push_back(rotated_symmetrized_schmid_tensor);
-  }
+        slip_directions[crystal_id]  = std::move(rotated_slip_directions);
+        slip_normals[crystal_id]     = std::move(rotated_slip_normals);
+        slip_orthogonals[crystal_id] = std::move(rotated_slip_orthogonals);
+        schmid_tensors[crystal_id]   = std::move(rotated_schmid_tensor);
+        symmetrized_schmid_tensors[crystal_id] =
+          std::move(rotated_symmetrized_schmid_tensor);
+      }
+    },
+    /* grainsize */ 64);
 }
 
 
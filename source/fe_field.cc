@@ -107,13 +107,17 @@ void FEField<dim>::setup_dofs()
               dealii::ExcMessage("The method setup_extractors() has to "
                                  "be called before setup_dofs()"));
 
+  // The FECollection is only built in the first call. Subsequent ones,
+  // e.g., after a refinement of the triangulation, only redistribute
+  // the degrees of freedom
+  //
   // The FESystem of the i-th crystal is divided into [ A | B ] with
   // dimensions [ dim x n_crystals | n_slips x n_crystals ] where
   //  A = FE_Nothing^dim     ... FE_Q^dim_i       ... FE_Nothing^dim
   //  B = FE_Nothing^n_slips ... FE_Q^{n_slips}_i ... FE_Nothing^n_slips
   // If the displacment is continuous across crystalls then [ A | B ] has
   // the dimensiones [ dim | n_slips x n_crystals ] where A = FE_Q^dim
-  for (dealii::types::material_id i = 0; i < n_crystals; ++i)
+  for (dealii::types::material_id i = fe_collection.size(); i < n_crystals; ++i)
   {
     std::vector<const dealii::FiniteElement<dim>*>  finite_elements;
 
@@ -239,8 +243,31 @@ void FEField<dim>::setup_dofs()
     }
   }
 
+  // Group the local degrees of freedom of each crystal by the
+  // displacement field and the slips they belong to
+  displacement_local_dofs.clear();
+  slips_local_dofs.clear();
+
+  displacement_local_dofs.resize(n_crystals);
+  slips_local_dofs.resize(n_crystals,
+                          std::vector<std::vector<unsigned int>>(n_slips));
+
+  for (dealii::types::material_id i = 0; i < n_crystals; ++i)
+    for (unsigned int j = 0; j < fe_collection[i].n_dofs_per_cell(); ++j)
+    {
+      const unsigned int global_component = get_global_component(i, j);
+
+      if (global_component < dim)
+        displacement_local_dofs[i].push_back(j);
+      else
+        slips_local_dofs[i][global_component - dim].push_back(j);
+    }
+
   // Store the local degrees of freedom indices related to the
   // displacement and the slips in two separate std::set
+  vector_dof_indices.clear();
+  scalar_dof_indices.clear();
+
   {
     std::vector<dealii::types::global_dof_index> local_dof_indices(
       fe_collection.max_dofs_per_cell());
@@ -376,6 +403,124 @@ void FEField<dim>::prepare_for_serialization_of_active_fe_indices()
 
 
 
+template<int dim>
+void FEField<dim>::prepare_for_serialization()
+{
+  AssertThrow(flag_setup_vectors_was_called,
+              dealii::ExcMessage("The setup_vectors() method has to be "
+                                 "called before the "
+                                 "prepare_for_serialization() method."))
+
+  solution_transfer =
+    std::make_unique<dealii::parallel::distributed::SolutionTransfer<
+      dim, dealii::LinearAlgebraTrilinos::MPI::Vector>>(dof_handler);
+
+  const std::vector<const dealii::LinearAlgebraTrilinos::MPI::Vector *>
+    solution_vectors = {&solution, &old_solution, &old_old_solution};
+
+  solution_transfer->prepare_for_serialization(solution_vectors);
+}
+
+
+
+template<int dim>
+void FEField<dim>::deserialize()
+{
+  AssertThrow(flag_setup_vectors_was_called,
+              dealii::ExcMessage("The setup_vectors() method has to be "
+                                 "called before the deserialize() "
+                                 "method."))
+
+  solution_transfer =
+    std::make_unique<dealii::parallel::distributed::SolutionTransfer<
+      dim, dealii::LinearAlgebraTrilinos::MPI::Vector>>(dof_handler);
+
+  // The deserialization requires vectors without ghost entries
+  std::vector<dealii::LinearAlgebraTrilinos::MPI::Vector>
+    distributed_vectors(3, distributed_vector);
+
+  std::vector<dealii::LinearAlgebraTrilinos::MPI::Vector *>
+    distributed_vectors_ptrs = {&distributed_vectors[0],
+                                &distributed_vectors[1],
+                                &distributed_vectors[2]};
+
+  solution_transfer->deserialize(distributed_vectors_ptrs);
+
+  for (auto &vector : distributed_vectors)
+    hanging_node_constraints.distribute(vector);
+
+  solution          = distributed_vectors[0];
+
+  old_solution      = distributed_vectors[1];
+
+  old_old_solution  = distributed_vectors[2];
+
+  solution_transfer.reset();
+}
+
+
+
+template<int dim>
+void FEField<dim>::prepare_for_coarsening_and_refinement()
+{
+  AssertThrow(flag_setup_vectors_was_called,
+              dealii::ExcMessage("The setup_vectors() method has to be "
+                                 "called before the "
+                                 "prepare_for_coarsening_and_refinement() "
+                                 "method."))
+
+  solution_transfer =
+    std::make_unique<dealii::parallel::distributed::SolutionTransfer<
+      dim, dealii::LinearAlgebraTrilinos::MPI::Vector>>(dof_handler);
+
+  const std::vector<const dealii::LinearAlgebraTrilinos::MPI::Vector *>
+    solution_vectors = {&solution, &old_solution, &old_old_solution};
+
+  solution_transfer->prepare_for_coarsening_and_refinement(
+    solution_vectors);
+}
+
+
+
+template<int dim>
+void FEField<dim>::interpolate_after_coarsening_and_refinement()
+{
+  AssertThrow(solution_transfer != nullptr,
+              dealii::ExcMessage("The prepare_for_coarsening_and_refinement()"
+                                 " method has to be called before the "
+                                 "refinement."))
+
+  AssertThrow(flag_setup_vectors_was_called,
+              dealii::ExcMessage("The setup_vectors() method has to be "
+                                 "called before the "
+                                 "interpolate_after_coarsening_and_refinement()"
+                                 " method."))
+
+  // The interpolation requires vectors without ghost entries
+  std::vector<dealii::LinearAlgebraTrilinos::MPI::Vector>
+    distributed_vectors(3, distributed_vector);
+
+  std::vector<dealii::LinearAlgebraTrilinos::MPI::Vector *>
+    distributed_vectors_ptrs = {&distributed_vectors[0],
+                                &distributed_vectors[1],
+                                &distributed_vectors[2]};
+
+  solution_transfer->interpolate(distributed_vectors_ptrs);
+
+  for (auto &vector : distributed_vectors)
+    hanging_node_constraints.distribute(vector);
+
+  solution          = distributed_vectors[0];
+
+  old_solution      = distributed_vectors[1];
+
+  old_old_solution  = distributed_vectors[2];
+
+  solution_transfer.reset();
+}
+
+
+
 template<int dim>
 void FEField<dim>::update_solution_vectors()
 {
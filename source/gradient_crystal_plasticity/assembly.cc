@@ -1,14 +1,424 @@
 #include <gCP/assembly_data.h>
 #include <gCP/gradient_crystal_plasticity.h>
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/work_stream.h>
 #include <deal.II/grid/filtered_iterator.h>
 
+#include <algorithm>
+
 namespace gCP
 {
 
 
 
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::evaluate_local_slips(
+  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+  const dealii::FEValues<dim>                                   &fe_values,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector              &vector,
+  dealii::Vector<double>                                        &local_dof_values,
+  std::vector<std::vector<double>>                              &slip_values,
+  std::vector<std::vector<dealii::Tensor<1,dim>>>               *slip_gradient_values) const
+{
+  const unsigned int crystal_id     = cell->material_id();
+
+  const unsigned int dofs_per_cell  = fe_values.dofs_per_cell;
+
+  const unsigned int n_q_points     = fe_values.n_quadrature_points;
+
+  // Gather the local degrees of freedom values
+  local_dof_values.reinit(dofs_per_cell);
+
+  cell->get_dof_values(vector, local_dof_values);
+
+  // Reset the quadrature point values
+  for (auto &values : slip_values)
+    std::fill(values.begin(), values.end(), 0.0);
+
+  if (slip_gradient_values != nullptr)
+    for (auto &gradient_values : *slip_gradient_values)
+      std::fill(gradient_values.begin(),
+                gradient_values.end(),
+                dealii::Tensor<1,dim>());
+
+  // All shape functions are primitive, i.e., each local degree of
+  // freedom only contributes to the slip it is associated with
+  const std::vector<std::vector<unsigned int>> &slips_local_dofs =
+    fe_field->get_slips_local_dofs(crystal_id);
+
+  for (unsigned int slip_id = 0; slip_id < slips_local_dofs.size(); ++slip_id)
+  {
+    std::vector<double> &values = slip_values[slip_id];
+
+    for (const unsigned int i : slips_local_dofs[slip_id])
+    {
+      const double local_dof_value = local_dof_values(i);
+
+      for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+        values[q_point] += local_dof_value * fe_values.shape_value(i, q_point);
+
+      if (slip_gradient_values != nullptr)
+      {
+        std::vector<dealii::Tensor<1,dim>> &gradient_values =
+          (*slip_gradient_values)[slip_id];
+
+        for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+          gradient_values[q_point] +=
+            local_dof_value * fe_values.shape_grad(i, q_point);
+      }
+    }
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::gather_batch_dof_values(
+  const CellBatch                                   &cell_batch,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector  &vector,
+  gCP::AssemblyData::SumFactorizationScratch<dim>   &scratch) const
+{
+  for (unsigned int lane = 0; lane < cell_batch.cells.size(); ++lane)
+  {
+    const typename dealii::DoFHandler<dim>::active_cell_iterator &cell =
+      cell_batch.cells[lane];
+
+    scratch.batch_local_dof_values[lane].reinit(
+      cell->get_fe().n_dofs_per_cell());
+
+    cell->get_dof_values(vector, scratch.batch_local_dof_values[lane]);
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::evaluate_batch_component(
+  const CellBatch                                         &cell_batch,
+  const TensorProductKernels<dim, VectorizedArrayType>    &kernels,
+  const unsigned int                                      component,
+  gCP::AssemblyData::SumFactorizationScratch<dim>         &scratch,
+  dealii::AlignedVector<VectorizedArrayType>              *values,
+  dealii::AlignedVector<
+    dealii::Tensor<1,dim,VectorizedArrayType>>            *reference_gradients) const
+{
+  // All cells of the batch belong to the same crystal
+  const std::vector<unsigned int> &local_dofs =
+    lexicographic_local_dofs[cell_batch.cells[0]->material_id()][component];
+
+  // Gather the values of the component in lexicographic order, one
+  // cell per lane. The unused lanes are set to zero
+  scratch.lexicographic_dof_values.resize(local_dofs.size());
+
+  for (unsigned int i = 0; i < local_dofs.size(); ++i)
+  {
+    VectorizedArrayType &dof_value = scratch.lexicographic_dof_values[i];
+
+    dof_value = 0.0;
+
+    for (unsigned int lane = 0; lane < cell_batch.cells.size(); ++lane)
+      dof_value[lane] = scratch.batch_local_dof_values[lane](local_dofs[i]);
+  }
+
+  kernels.evaluate(
+    dealii::make_array_view(scratch.lexicographic_dof_values),
+    values != nullptr ?
+      dealii::make_array_view(*values) :
+      dealii::ArrayView<VectorizedArrayType>(),
+    reference_gradients != nullptr ?
+      dealii::make_array_view(*reference_gradients) :
+      dealii::ArrayView<dealii::Tensor<1,dim,VectorizedArrayType>>(),
+    scratch.tensor_product_workspace);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::integrate_batch_component(
+  const CellBatch                                         &cell_batch,
+  const TensorProductKernels<dim, VectorizedArrayType>    &kernels,
+  const unsigned int                                      component,
+  gCP::AssemblyData::SumFactorizationScratch<dim>         &scratch,
+  const dealii::AlignedVector<VectorizedArrayType>        *value_fluxes,
+  const dealii::AlignedVector<
+    dealii::Tensor<1,dim,VectorizedArrayType>>            *reference_gradient_fluxes,
+  const BatchLocalVectors                                 &local_vectors) const
+{
+  const std::vector<unsigned int> &local_dofs =
+    lexicographic_local_dofs[cell_batch.cells[0]->material_id()][component];
+
+  scratch.lexicographic_dof_values.resize(local_dofs.size());
+
+  for (VectorizedArrayType &dof_value : scratch.lexicographic_dof_values)
+    dof_value = 0.0;
+
+  kernels.integrate(
+    value_fluxes != nullptr ?
+      dealii::make_array_view(*value_fluxes) :
+      dealii::ArrayView<const VectorizedArrayType>(),
+    reference_gradient_fluxes != nullptr ?
+      dealii::make_array_view(*reference_gradient_fluxes) :
+      dealii::ArrayView<const dealii::Tensor<1,dim,VectorizedArrayType>>(),
+    dealii::make_array_view(scratch.lexicographic_dof_values),
+    scratch.tensor_product_workspace);
+
+  // Scatter the values of the component to the local degrees of
+  // freedom of each cell
+  for (unsigned int lane = 0; lane < cell_batch.cells.size(); ++lane)
+  {
+    dealii::Vector<double> &local_vector = *local_vectors[lane];
+
+    for (unsigned int i = 0; i < local_dofs.size(); ++i)
+      local_vector(local_dofs[i]) +=
+        scratch.lexicographic_dof_values[i][lane];
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::get_lane_values(
+  const dealii::FEValues<dim>                             &fe_values,
+  const unsigned int                                      lane,
+  const dealii::AlignedVector<VectorizedArrayType>        *batch_values,
+  const dealii::AlignedVector<
+    dealii::Tensor<1,dim,VectorizedArrayType>>            *batch_reference_gradients,
+  std::vector<double>                                     *values,
+  std::vector<dealii::Tensor<1,dim>>                      *gradients) const
+{
+  const unsigned int n_q_points = fe_values.n_quadrature_points;
+
+  if (values != nullptr)
+    for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+      (*values)[q_point] = (*batch_values)[q_point][lane];
+
+  if (gradients == nullptr)
+    return;
+
+  // Push the gradients forward to the real cell, i.e.,
+  // grad = J^{-T} grad_ref
+  for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+  {
+    const dealii::DerivativeForm<1,dim,dim> &inverse_jacobian =
+      fe_values.inverse_jacobian(q_point);
+
+    const dealii::Tensor<1,dim,VectorizedArrayType> &reference_gradient =
+      (*batch_reference_gradients)[q_point];
+
+    dealii::Tensor<1,dim> &gradient = (*gradients)[q_point];
+
+    for (unsigned int i = 0; i < dim; ++i)
+    {
+      gradient[i] = 0.0;
+
+      for (unsigned int j = 0; j < dim; ++j)
+        gradient[i] += inverse_jacobian[j][i] * reference_gradient[j][lane];
+    }
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::set_lane_fluxes(
+  const dealii::FEValues<dim>                             &fe_values,
+  const unsigned int                                      lane,
+  const std::vector<double>                               *value_fluxes,
+  const std::vector<dealii::Tensor<1,dim>>                *gradient_fluxes,
+  dealii::AlignedVector<VectorizedArrayType>              *batch_value_fluxes,
+  dealii::AlignedVector<
+    dealii::Tensor<1,dim,VectorizedArrayType>>            *batch_reference_gradient_fluxes) const
+{
+  const unsigned int n_q_points = fe_values.n_quadrature_points;
+
+  if (value_fluxes != nullptr)
+    for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+      (*batch_value_fluxes)[q_point][lane] = (*value_fluxes)[q_point];
+
+  if (gradient_fluxes == nullptr)
+    return;
+
+  // Pull the gradient fluxes back to the reference cell, i.e.,
+  // flux_ref = J^{-1} flux, such that they can be tested with the
+  // reference gradients
+  for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+  {
+    const dealii::DerivativeForm<1,dim,dim> &inverse_jacobian =
+      fe_values.inverse_jacobian(q_point);
+
+    const dealii::Tensor<1,dim> &gradient_flux =
+      (*gradient_fluxes)[q_point];
+
+    dealii::Tensor<1,dim,VectorizedArrayType> &reference_gradient_flux =
+      (*batch_reference_gradient_fluxes)[q_point];
+
+    for (unsigned int i = 0; i < dim; ++i)
+    {
+      double value = 0.0;
+
+      for (unsigned int j = 0; j < dim; ++j)
+        value += inverse_jacobian[i][j] * gradient_flux[j];
+
+      reference_gradient_flux[i][lane] = value;
+    }
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::set_lane_bulk_residual_fluxes(
+  const dealii::FEValues<dim>                 &fe_values,
+  const unsigned int                          lane,
+  gCP::AssemblyData::Residual::Scratch<dim>   &scratch,
+  const bool flag_assemble_linear_contributions) const
+{
+  const bool flag_linear_vectorial_microstress =
+    vectorial_microstress_law_is_linear();
+
+  // Displacements, i.e., -(grad(v) : sigma - v * b)
+  if (flag_assemble_linear_contributions)
+    for (unsigned int component = 0; component < dim; ++component)
+    {
+      for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
+      {
+        scratch.value_flux_values[q_point] =
+          scratch.supply_term_values[q_point][component] *
+          scratch.JxW_values[q_point];
+
+        for (unsigned int d = 0; d < dim; ++d)
+          scratch.gradient_flux_values[q_point][d] =
+            -scratch.stress_tensor_values[q_point][component][d] *
+            scratch.JxW_values[q_point];
+      }
+
+      set_lane_fluxes(fe_values,
+                      lane,
+                      &scratch.value_flux_values,
+                      &scratch.gradient_flux_values,
+                      &scratch.component_value_fluxes[component],
+                      &scratch.component_reference_gradient_fluxes[component]);
+    }
+
+  // Slips. The affine contributions, i.e., the resolved stress and the
+  // vectorial microstress of a linear law, are kept apart from the
+  // remaining ones
+  for (unsigned int slip_id = 0;
+       slip_id < crystals_data->get_n_slips();
+       ++slip_id)
+  {
+    if (flag_assemble_linear_contributions)
+    {
+      for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
+      {
+        scratch.value_flux_values[q_point] =
+          scratch.resolved_stress_values[slip_id][q_point] *
+          scratch.JxW_values[q_point];
+
+        scratch.gradient_flux_values[q_point] =
+          -scratch.vectorial_microstress_values[slip_id][q_point] *
+          scratch.JxW_values[q_point];
+      }
+
+      set_lane_fluxes(fe_values,
+                      lane,
+                      &scratch.value_flux_values,
+                      flag_linear_vectorial_microstress ?
+                        &scratch.gradient_flux_values : nullptr,
+                      &scratch.component_value_fluxes[dim + slip_id],
+                      &scratch.component_reference_gradient_fluxes[dim + slip_id]);
+    }
+
+    for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
+    {
+      scratch.value_flux_values[q_point] =
+        -scratch.scalar_microstress_values[slip_id][q_point] *
+        scratch.JxW_values[q_point];
+
+      scratch.gradient_flux_values[q_point] =
+        -scratch.vectorial_microstress_values[slip_id][q_point] *
+        scratch.JxW_values[q_point];
+    }
+
+    set_lane_fluxes(fe_values,
+                    lane,
+                    &scratch.value_flux_values,
+                    flag_linear_vectorial_microstress ?
+                      nullptr : &scratch.gradient_flux_values,
+                    &scratch.nonlinear_value_fluxes[slip_id],
+                    &scratch.nonlinear_reference_gradient_fluxes[slip_id]);
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::integrate_batch_bulk_residual(
+  const CellBatch                                             &cell_batch,
+  gCP::AssemblyData::Residual::Scratch<dim>                   &scratch,
+  gCP::AssemblyData::CellBatchCopy<
+    gCP::AssemblyData::Residual::Copy>                        &data,
+  const bool flag_assemble_linear_contributions) const
+{
+  const bool flag_linear_vectorial_microstress =
+    vectorial_microstress_law_is_linear();
+
+  BatchLocalVectors local_rhs{};
+
+  BatchLocalVectors local_nonlinear_rhs{};
+
+  for (unsigned int lane = 0; lane < cell_batch.cells.size(); ++lane)
+  {
+    local_rhs[lane] = &data.cell_copies[lane].local_rhs;
+
+    local_nonlinear_rhs[lane] = &data.cell_copies[lane].local_nonlinear_rhs;
+  }
+
+  // Displacements
+  if (flag_assemble_linear_contributions)
+    for (unsigned int component = 0; component < dim; ++component)
+      integrate_batch_component(
+        cell_batch,
+        *displacement_kernels,
+        component,
+        scratch,
+        &scratch.component_value_fluxes[component],
+        &scratch.component_reference_gradient_fluxes[component],
+        local_rhs);
+
+  // Slips. The affine contributions are integrated into
+  // data.local_rhs and the remaining ones into data.local_nonlinear_rhs
+  for (unsigned int slip_id = 0;
+       slip_id < crystals_data->get_n_slips();
+       ++slip_id)
+  {
+    if (flag_assemble_linear_contributions)
+      integrate_batch_component(
+        cell_batch,
+        *slip_kernels,
+        dim + slip_id,
+        scratch,
+        &scratch.component_value_fluxes[dim + slip_id],
+        flag_linear_vectorial_microstress ?
+          &scratch.component_reference_gradient_fluxes[dim + slip_id] :
+          nullptr,
+        local_rhs);
+
+    integrate_batch_component(
+      cell_batch,
+      *slip_kernels,
+      dim + slip_id,
+      scratch,
+      &scratch.nonlinear_value_fluxes[slip_id],
+      flag_linear_vectorial_microstress ?
+        nullptr : &scratch.nonlinear_reference_gradient_fluxes[slip_id],
+      local_nonlinear_rhs);
+  }
+}
+
+
+
 template <int dim>
 void GradientCrystalPlasticitySolver<dim>::assemble_jacobian()
 {
@@ -23,10 +433,6 @@ void GradientCrystalPlasticitySolver<dim>::assemble_jacobian()
   using CellIterator =
     typename dealii::DoFHandler<dim>::active_cell_iterator;
 
-  using CellFilter =
-    dealii::FilteredIterator<
-      typename dealii::DoFHandler<dim>::active_cell_iterator>;
-
   // Reset data
   jacobian = 0.0;
 
@@ -59,11 +465,10 @@ void GradientCrystalPlasticitySolver<dim>::assemble_jacobian()
     dealii::update_quadrature_points;
 
   // Assemble using the WorkStream approach
-  dealii::WorkStream::run(
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               fe_field->get_dof_handler().begin_active()),
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               fe_field->get_dof_handler().end()),
+  run_work_stream(
+    fe_field->get_dof_handler(),
+    colored_cells,
+    "Jacobian assembly",
     worker,
     copier,
     gCP::AssemblyData::Jacobian::Scratch<dim>(
@@ -80,6 +485,9 @@ void GradientCrystalPlasticitySolver<dim>::assemble_jacobian()
   // Compress global data
   jacobian.compress(dealii::VectorOperation::add);
 
+  // The preconditioner has to be rebuilt from the new Jacobian
+  flag_refresh_preconditioner = true;
+
   if (parameters.verbose)
     *pcout << " done!" << std::endl;
 }
@@ -91,6 +499,40 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_jacobian(
   const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
   gCP::AssemblyData::Jacobian::Scratch<dim>                     &scratch,
   gCP::AssemblyData::Jacobian::Copy                             &data)
+{
+  // Update the hp::FEValues instance to the values of the current cell
+  scratch.hp_fe_values.reinit(cell);
+
+  const dealii::FEValues<dim> &fe_values =
+    scratch.hp_fe_values.get_present_fe_values();
+
+  // Get values of the slips at the quadrature points
+  evaluate_local_slips(cell,
+                       fe_values,
+                       trial_solution,
+                       scratch.local_dof_values,
+                       scratch.slip_values,
+                       &scratch.slip_gradient_values);
+
+  evaluate_local_slips(cell,
+                       fe_values,
+                       fe_field->old_solution,
+                       scratch.local_dof_values,
+                       scratch.old_slip_values);
+
+  assemble_local_jacobian(cell, fe_values, scratch, data);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::assemble_local_jacobian(
+  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+  const dealii::FEValues<dim>                                   &fe_values,
+  gCP::AssemblyData::Jacobian::Scratch<dim>                     &scratch,
+  gCP::AssemblyData::Jacobian::Copy                             &data,
+  const std::vector<std::vector<InterfaceQuadraturePointHistory<dim>>>
+    *trial_interface_quadrature_point_history)
 {
   // Reset local data
   data.local_matrix              = 0.0;
@@ -102,6 +544,27 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_jacobian(
   // Local to global indices mapping
   cell->get_dof_indices(data.local_dof_indices);
 
+  // Cells in the bulk of the grains reuse their cached local Jacobian
+  // if their state barely changed
+  const bool flag_cache_local_jacobian =
+    parameters.flag_cache_local_jacobians &&
+    !cell_is_at_grain_boundary(cell->active_cell_index());
+
+  // Get the trial slip resistances at all quadrature points
+  const dealii::ArrayView<const double> slip_resistances =
+    quadrature_point_history.get_slip_resistances(
+      cell->active_cell_index(),
+      scratch.slip_values,
+      scratch.old_slip_values,
+      scratch.slip_resistance_values);
+
+  if (flag_cache_local_jacobian &&
+      get_cached_local_jacobian(cell,
+                                scratch,
+                                slip_resistances,
+                                data.local_matrix))
+    return;
+
   // Get the crystal identifier for the current cell
   const unsigned int crystal_id = cell->material_id();
 
@@ -109,165 +572,177 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_jacobian(
   scratch.stiffness_tetrad =
     hooke_law->get_stiffness_tetrad(crystal_id);
 
-  // Get the slips' symmetrized Schmid tensors of the current crystal
-  scratch.symmetrized_schmid_tensors =
-    crystals_data->get_symmetrized_schmid_tensors(crystal_id);
+  // Get the contractions of the stiffness tetrad with the slips'
+  // symmetrized Schmid tensors of the current crystal
+  const std::vector<dealii::SymmetricTensor<2,dim>>
+    &stiffness_schmid_contractions =
+      hooke_law->get_stiffness_schmid_contractions(crystal_id);
 
-  // Update the hp::FEValues instance to the values of the current cell
-  scratch.hp_fe_values.reinit(cell);
+  const std::vector<dealii::SymmetricTensor<2,dim>>
+    &schmid_stiffness_contractions =
+      hooke_law->get_schmid_stiffness_contractions(crystal_id);
 
-  const dealii::FEValues<dim> &fe_values =
-    scratch.hp_fe_values.get_present_fe_values();
+  const dealii::FullMatrix<double> &schmid_stiffness_schmid_contractions =
+    hooke_law->get_schmid_stiffness_schmid_contractions(crystal_id);
 
   // Get JxW values at the quadrature points
   scratch.JxW_values = fe_values.get_JxW_values();
 
-  // Get values of the hardening variable at the quadrature points
-  const std::vector<std::shared_ptr<QuadraturePointHistory<dim>>>
-    local_quadrature_point_history =
-      quadrature_point_history.get_data(cell);
+  // Local degrees of freedom grouped by their global component
+  const std::vector<unsigned int> &displacement_local_dofs =
+    fe_field->get_displacement_local_dofs(crystal_id);
 
-  // Get values of the slips at the quadrature points
-  for (unsigned int slip_id = 0;
-      slip_id < crystals_data->get_n_slips();
-      ++slip_id)
-  {
-    fe_values[fe_field->get_slip_extractor(crystal_id, slip_id)].get_function_values(
-      trial_solution,
-      scratch.slip_values[slip_id]);
+  const std::vector<std::vector<unsigned int>> &slips_local_dofs =
+    fe_field->get_slips_local_dofs(crystal_id);
 
-    fe_values[fe_field->get_slip_extractor(crystal_id, slip_id)].get_function_values(
-      fe_field->old_solution,
-      scratch.old_slip_values[slip_id]);
+  const unsigned int n_slips = crystals_data->get_n_slips();
 
-    fe_values[fe_field->get_slip_extractor(crystal_id, slip_id)].get_function_gradients(
-      trial_solution,
-      scratch.slip_gradient_values[slip_id]);
-  }
+  // The jacobians of a linear vectorial microscopic stress law are
+  // constant per crystal and slip system and are used as they are.
+  // Otherwise they are computed at all quadrature points at once
+  const std::vector<dealii::SymmetricTensor<2,dim>> *quadratic_jacobians =
+    vectorial_microstress_law_is_linear() ?
+      &vectorial_microstress_law->get_quadratic_jacobians(crystal_id) :
+      nullptr;
+
+  if (quadratic_jacobians == nullptr)
+    vectorial_microstress_law->get_jacobians(
+      crystal_id,
+      scratch.slip_gradient_values,
+      scratch.vectorial_microstress_law_jacobian_values);
 
   // Loop over quadrature points
   for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
   {
+    const double JxW_value = scratch.JxW_values[q_point];
+
     // Compute the jacobian of the scalar microscopic
     // stress w.r.t. slip at the current quadrature point
-    scratch.scalar_microstress_law_jacobian_values[q_point] =
-      scalar_microstress_law->get_jacobian(
-        q_point,
-        scratch.slip_values,
-        scratch.old_slip_values,
-        local_quadrature_point_history[q_point]->get_slip_resistances(),
-        discrete_time.get_next_step_size());
-
-    // Extract test function values at the quadrature points (Displacement)
-    for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
+    scalar_microstress_law->get_jacobian(
+      q_point,
+      scratch.slip_values,
+      scratch.old_slip_values,
+      dealii::ArrayView<const double>(
+        slip_resistances.data() + q_point * n_slips, n_slips),
+      discrete_time.get_next_step_size(),
+      scratch.scalar_microstress_law_jacobian_values[q_point]);
+
+    // Extract test function values at the quadrature points
+    // (Displacement) and their contraction with the stiffness tetrad
+    for (const unsigned int i : displacement_local_dofs)
     {
       scratch.sym_grad_vector_phi[i] =
         fe_values[fe_field->get_displacement_extractor(crystal_id)].symmetric_gradient(i,q_point);
+
+      scratch.stiffness_sym_grad_vector_phi[i] =
+        scratch.stiffness_tetrad *
+        scratch.sym_grad_vector_phi[i];
     }
 
     // Extract test function values at the quadrature points (Slips)
-    for (unsigned int slip_id = 0;
-         slip_id < crystals_data->get_n_slips();
-         ++slip_id)
-    {
-      scratch.vectorial_microstress_law_jacobian_values[q_point][slip_id] =
-          vectorial_microstress_law->get_jacobian(
-            crystal_id,
-            slip_id,
-            scratch.slip_gradient_values[slip_id][q_point]);
-
-      for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+      for (const unsigned int i : slips_local_dofs[slip_id])
       {
         scratch.scalar_phi[slip_id][i] =
-          fe_values[fe_field->get_slip_extractor(crystal_id, slip_id)].value(i,q_point);
+          fe_values.shape_value(i, q_point);
 
         scratch.grad_scalar_phi[slip_id][i] =
-          fe_values[fe_field->get_slip_extractor(crystal_id, slip_id)].gradient(i,q_point);
+          fe_values.shape_grad(i, q_point);
       }
-    }
 
-    // Loop over local degrees of freedom
-    for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
-    {
-      for (unsigned int j = 0; j < scratch.dofs_per_cell; ++j)
+    // Displacement-displacement block
+    for (const unsigned int i : displacement_local_dofs)
+      for (const unsigned int j : displacement_local_dofs)
+        data.local_matrix(i,j) +=
+          scratch.sym_grad_vector_phi[i] *
+          scratch.stiffness_sym_grad_vector_phi[j] *
+          JxW_value;
+
+    // Displacement-slip and slip-displacement blocks
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+      for (const unsigned int i : displacement_local_dofs)
       {
-        if (fe_field->get_global_component(crystal_id, i) < dim)
-        {
-          if (fe_field->get_global_component(crystal_id, j) < dim)
-          {
-            data.local_matrix(i,j) +=
-              scratch.sym_grad_vector_phi[i] *
-              scratch.stiffness_tetrad *
-              scratch.sym_grad_vector_phi[j] *
-              scratch.JxW_values[q_point];
-
-            AssertIsFinite(data.local_matrix(i,j));
-          }
-          else
-          {
-            const unsigned int slip_id_beta =
-              fe_field->get_global_component(crystal_id, j) - dim;
+        const double displacement_slip_coupling =
+          scratch.sym_grad_vector_phi[i] *
+          stiffness_schmid_contractions[slip_id] *
+          JxW_value;
 
-            data.local_matrix(i,j) -=
-              scratch.sym_grad_vector_phi[i] *
-              scratch.stiffness_tetrad *
-              scratch.symmetrized_schmid_tensors[slip_id_beta] *
-              scratch.scalar_phi[slip_id_beta][j] *
-              scratch.JxW_values[q_point];
+        const double slip_displacement_coupling =
+          schmid_stiffness_contractions[slip_id] *
+          scratch.sym_grad_vector_phi[i] *
+          JxW_value;
 
-            AssertIsFinite(data.local_matrix(i,j));
-          }
-        }
-        else
+        for (const unsigned int j : slips_local_dofs[slip_id])
         {
-          const unsigned int slip_id_alpha =
-              fe_field->get_global_component(crystal_id, i) - dim;
+          data.local_matrix(i,j) -=
+            displacement_slip_coupling *
+            scratch.scalar_phi[slip_id][j];
 
-          if (fe_field->get_global_component(crystal_id, j) < dim)
-          {
-            data.local_matrix(i,j) -=
-              scratch.scalar_phi[slip_id_alpha][i] *
-              scratch.symmetrized_schmid_tensors[slip_id_alpha] *
-              scratch.stiffness_tetrad *
-              scratch.sym_grad_vector_phi[j] *
-              scratch.JxW_values[q_point];
-
-            AssertIsFinite(data.local_matrix(i,j));
-          }
-          else
-          {
-            const unsigned int slip_id_beta =
-                fe_field->get_global_component(crystal_id, j) - dim;
+          data.local_matrix(j,i) -=
+            scratch.scalar_phi[slip_id][j] *
+            slip_displacement_coupling;
+        }
+      }
 
-            if (slip_id_alpha == slip_id_beta)
-            {
-              data.local_matrix(i,j) +=
-                scratch.grad_scalar_phi[slip_id_alpha][i] *
-                scratch.vectorial_microstress_law_jacobian_values[q_point][slip_id_alpha] *
-                scratch.grad_scalar_phi[slip_id_beta][j] *
-                scratch.JxW_values[q_point];
-            }
+    // Slip-slip blocks
+    for (unsigned int slip_id_alpha = 0;
+         slip_id_alpha < n_slips;
+         ++slip_id_alpha)
+    {
+      const dealii::SymmetricTensor<2,dim> &vectorial_microstress_jacobian =
+        quadratic_jacobians != nullptr ?
+          (*quadratic_jacobians)[slip_id_alpha] :
+          scratch.vectorial_microstress_law_jacobian_values[q_point][slip_id_alpha];
 
-            AssertIsFinite(data.local_matrix(i,j));
+      // The gradient term only couples a slip with itself
+      for (const unsigned int i : slips_local_dofs[slip_id_alpha])
+      {
+        const dealii::Tensor<1,dim> vectorial_microstress_jacobian_grad_phi =
+          vectorial_microstress_jacobian *
+          scratch.grad_scalar_phi[slip_id_alpha][i] *
+          JxW_value;
+
+        for (const unsigned int j : slips_local_dofs[slip_id_alpha])
+          data.local_matrix(i,j) +=
+            vectorial_microstress_jacobian_grad_phi *
+            scratch.grad_scalar_phi[slip_id_alpha][j];
+      }
 
-            data.local_matrix(i,j) -=
-              scratch.scalar_phi[slip_id_alpha][i] *
-              (-1.0 *
-               scratch.symmetrized_schmid_tensors[slip_id_alpha] *
-               scratch.stiffness_tetrad *
-               scratch.symmetrized_schmid_tensors[slip_id_beta]
-               -
-               scratch.scalar_microstress_law_jacobian_values[q_point][slip_id_alpha][slip_id_beta]) *
-              scratch.scalar_phi[slip_id_beta][j]*
-              scratch.JxW_values[q_point];
+      for (unsigned int slip_id_beta = 0;
+           slip_id_beta < n_slips;
+           ++slip_id_beta)
+      {
+        const double slip_slip_coupling =
+          (schmid_stiffness_schmid_contractions(slip_id_alpha,
+                                                slip_id_beta)
+           +
+           scratch.scalar_microstress_law_jacobian_values[q_point][slip_id_alpha][slip_id_beta]) *
+          JxW_value;
+
+        for (const unsigned int i : slips_local_dofs[slip_id_alpha])
+        {
+          const double scaled_scalar_phi_i =
+            scratch.scalar_phi[slip_id_alpha][i] *
+            slip_slip_coupling;
 
-            AssertIsFinite(data.local_matrix(i,j));
-          }
+          for (const unsigned int j : slips_local_dofs[slip_id_beta])
+            data.local_matrix(i,j) +=
+              scaled_scalar_phi_i *
+              scratch.scalar_phi[slip_id_beta][j];
         }
       }
-    } // Loop over local degrees of freedom
+    }
   } // Loop over quadrature points
 
+#ifdef DEBUG
+  for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
+    for (unsigned int j = 0; j < scratch.dofs_per_cell; ++j)
+      AssertIsFinite(data.local_matrix(i,j));
+#endif
+
+  if (flag_cache_local_jacobian)
+    cache_local_jacobian(cell, scratch, slip_resistances, data.local_matrix);
+
   // Grain boundary integral
   if (cell_is_at_grain_boundary(cell->active_cell_index()) &&
       (fe_field->is_decohesion_allowed() ||
@@ -276,25 +751,29 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_jacobian(
   {
     data.cell_is_at_grain_boundary = true;
 
-    for (const auto &face_index : cell->face_indices())
-      if (!cell->face(face_index)->at_boundary() &&
-          cell->material_id() !=
-            cell->neighbor(face_index)->material_id())
+    const dealii::ArrayView<const GrainBoundaryFace> cell_grain_boundary_faces =
+      get_grain_boundary_faces(cell->active_cell_index());
+
+    for (unsigned int face_no = 0;
+         face_no < cell_grain_boundary_faces.size(); ++face_no)
       {
+        const GrainBoundaryFace &grain_boundary_face =
+          cell_grain_boundary_faces[face_no];
+
         // Reset local data
         data.local_coupling_matrix = 0.0;
 
         // Local to global indices mapping of the neighbour cell
-        cell->neighbor(face_index)->get_dof_indices(
+        grain_boundary_face.neighbour_cell->get_dof_indices(
           data.neighbour_cell_local_dof_indices);
 
         // Get the crystal identifier for the neighbour cell
         const unsigned int neighbour_crystal_id =
-          cell->neighbor(face_index)->active_fe_index();
+          grain_boundary_face.neighbour_crystal_id;
 
         // Update the hp::FEFaceValues instance to the values of the
         // current face
-        scratch.hp_fe_face_values.reinit(cell, face_index);
+        scratch.hp_fe_face_values.reinit(cell, grain_boundary_face.face_index);
 
         const dealii::FEFaceValues<dim> &fe_face_values =
           scratch.hp_fe_face_values.get_present_fe_values();
@@ -302,8 +781,8 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_jacobian(
         // Update the hp::FEFaceValues instance to the values of the
         // neighbour face
         scratch.neighbour_hp_fe_face_values.reinit(
-          cell->neighbor(face_index),
-          cell->neighbor_of_neighbor(face_index));
+          grain_boundary_face.neighbour_cell,
+          grain_boundary_face.neighbour_face_index);
 
         const dealii::FEFaceValues<dim> &neighbour_fe_face_values =
           scratch.neighbour_hp_fe_face_values.get_present_fe_values();
@@ -314,28 +793,18 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_jacobian(
         // Get normal vector values values at the face quadrature points
         scratch.normal_vector_values = fe_face_values.get_normal_vectors();
 
-        std::vector<std::shared_ptr<InterfaceQuadraturePointHistory<dim>>>
-          local_interface_quadrature_point_history;
-
-        // Get grain interactino moduli
-        if (parameters.boundary_conditions_at_grain_boundaries ==
-          RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction)
-        {
-          scratch.grain_interaction_moduli =
-            microscopic_traction_law->get_grain_interaction_moduli(
-              crystal_id,
-              neighbour_crystal_id,
-              scratch.normal_vector_values);
-        }
+        // Get the internal variable values at the quadrature points
+        const dealii::ArrayView<const InterfaceQuadraturePointHistory<dim>>
+          local_interface_quadrature_point_history =
+            (trial_interface_quadrature_point_history != nullptr) ?
+              dealii::make_array_view(
+                (*trial_interface_quadrature_point_history)[face_no]) :
+              dealii::ArrayView<const InterfaceQuadraturePointHistory<dim>>(
+                interface_quadrature_point_history.get_data(
+                  grain_boundary_face.interface_id));
 
         if (fe_field->is_decohesion_allowed())
         {
-          // Get the internal variable values at the quadrature points
-          local_interface_quadrature_point_history =
-              interface_quadrature_point_history.get_data(
-                cell->id(),
-                cell->neighbor(face_index)->id());
-
           // Get JxW values at the quadrature points
           scratch.face_neighbor_JxW_values =
             neighbour_fe_face_values.get_JxW_values();
@@ -359,156 +828,195 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_jacobian(
             fe_field->get_displacement_extractor(neighbour_crystal_id)].get_function_values(
             fe_field->old_solution,
             scratch.neighbor_cell_old_displacement_values);
+
+          // Gather the opening displacements and the history values of
+          // the face and evaluate the grain boundary laws at all its
+          // quadrature points at once
+          for (unsigned int face_q_point = 0;
+               face_q_point < scratch.n_face_q_points;
+               ++face_q_point)
+          {
+            scratch.opening_displacement_values[face_q_point] =
+              scratch.neighbor_cell_displacement_values[face_q_point] -
+              scratch.current_cell_displacement_values[face_q_point];
+
+            scratch.max_effective_opening_displacement_values[face_q_point] =
+              local_interface_quadrature_point_history[face_q_point].
+                get_max_effective_opening_displacement();
+
+            scratch.old_effective_opening_displacement_values[face_q_point] =
+              get_committed_interface_values(
+                grain_boundary_face.interface_id,
+                face_q_point).old_effective_opening_displacement;
+          }
+
+          cohesive_law->get_jacobians(
+            scratch.opening_displacement_values,
+            scratch.normal_vector_values,
+            scratch.max_effective_opening_displacement_values,
+            scratch.old_effective_opening_displacement_values,
+            discrete_time.get_next_step_size(),
+            scratch.cohesive_law_jacobian_values);
+
+          contact_law->get_jacobians(
+            scratch.opening_displacement_values,
+            scratch.normal_vector_values,
+            scratch.contact_law_jacobian_values);
         }
 
+        // Local degrees of freedom grouped by their global component
+        const std::vector<unsigned int> &displacement_local_dofs =
+          fe_field->get_displacement_local_dofs(crystal_id);
+
+        const std::vector<unsigned int> &neighbour_displacement_local_dofs =
+          fe_field->get_displacement_local_dofs(neighbour_crystal_id);
+
+        const std::vector<std::vector<unsigned int>> &slips_local_dofs =
+          fe_field->get_slips_local_dofs(crystal_id);
+
+        const std::vector<std::vector<unsigned int>> &neighbour_slips_local_dofs =
+          fe_field->get_slips_local_dofs(neighbour_crystal_id);
+
         // Loop over face quadrature points
         for (unsigned int face_q_point = 0;
              face_q_point < scratch.n_face_q_points;
              ++face_q_point)
         {
+          const double JxW_value = scratch.face_JxW_values[face_q_point];
+
           scratch.damage_variable_values[face_q_point] = 0.0;
 
           if (fe_field->is_decohesion_allowed())
           {
             scratch.damage_variable_values[face_q_point] =
-              local_interface_quadrature_point_history[face_q_point]->
+              local_interface_quadrature_point_history[face_q_point].
                 get_damage_variable();
 
-            const dealii::Tensor<1,dim> opening_displacement =
-              scratch.neighbor_cell_displacement_values[face_q_point] -
-              scratch.current_cell_displacement_values[face_q_point];
-
-            scratch.cohesive_law_jacobian_values[face_q_point] =
-              cohesive_law->get_jacobian(
-                opening_displacement,
-                scratch.normal_vector_values[face_q_point],
-                local_interface_quadrature_point_history[face_q_point]->
-                  get_max_effective_opening_displacement(),
-                local_interface_quadrature_point_history[face_q_point]->
-                      get_old_effective_opening_displacement(),
-                discrete_time.get_next_step_size());
-
-            scratch.contact_law_jacobian_values[face_q_point] =
-              contact_law->get_jacobian(
-                opening_displacement,
-                scratch.normal_vector_values[face_q_point]);
+            // The degradation function only depends on the quadrature
+            // point
+            const dealii::SymmetricTensor<2,dim> macroscopic_jacobian =
+              (cohesive_law->get_degradation_function_value(
+                scratch.damage_variable_values[face_q_point],
+                parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_macrotraction_to_damage) *
+               scratch.cohesive_law_jacobian_values[face_q_point]
+               +
+               scratch.contact_law_jacobian_values[face_q_point]) *
+              JxW_value;
 
             // Extract test function values at the quadrature points (Displacement)
-            for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
-            {
+            for (const unsigned int i : displacement_local_dofs)
               scratch.face_vector_phi[i] =
                 fe_face_values[fe_field->get_displacement_extractor(
                   crystal_id)].value(i, face_q_point);
 
-              scratch.neighbor_face_vector_phi[i] =
+            for (const unsigned int j : neighbour_displacement_local_dofs)
+              scratch.neighbor_face_vector_phi[j] =
                 neighbour_fe_face_values[fe_field->get_displacement_extractor(
-                  neighbour_crystal_id)].value(i, face_q_point);
-            }
-          }
+                  neighbour_crystal_id)].value(j, face_q_point);
 
-          if (parameters.boundary_conditions_at_grain_boundaries ==
+            // Displacement-displacement blocks
+            for (const unsigned int i : displacement_local_dofs)
+            {
+              const dealii::Tensor<1,dim> test_function_contribution =
+                scratch.face_vector_phi[i] * macroscopic_jacobian;
+
+              for (const unsigned int j : displacement_local_dofs)
+              {
+                data.local_matrix(i,j) +=
+                  test_function_contribution *
+                  scratch.face_vector_phi[j];
+
+                AssertIsFinite(data.local_matrix(i,j));
+              }
+
+              for (const unsigned int j : neighbour_displacement_local_dofs)
+              {
+                data.local_coupling_matrix(i,j) -=
+                  test_function_contribution *
+                  scratch.neighbor_face_vector_phi[j];
+
+                AssertIsFinite(data.local_coupling_matrix(i,j));
+              }
+            }
+          }
+
+          if (parameters.boundary_conditions_at_grain_boundaries ==
             RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction)
           {
             scratch.intra_gateaux_derivative_values[face_q_point] =
               microscopic_traction_law->get_intra_gateaux_derivative(
                 face_q_point,
-                scratch.grain_interaction_moduli);
+                grain_boundary_face.grain_interaction_moduli);
 
             scratch.inter_gateaux_derivative_values[face_q_point] =
               microscopic_traction_law->get_inter_gateaux_derivative(
                 face_q_point,
-                scratch.grain_interaction_moduli);
+                grain_boundary_face.grain_interaction_moduli);
+
+            // The degradation function only depends on the quadrature
+            // point
+            const double degradation_value =
+              cohesive_law->get_degradation_function_value(
+                scratch.damage_variable_values[face_q_point],
+                parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_microtraction_to_damage) *
+              JxW_value;
 
             // Extract test function values at the quadrature points (Slips)
             for (unsigned int slip_id = 0;
                 slip_id < crystals_data->get_n_slips();
                 ++slip_id)
-              for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
-              {
+            {
+              for (const unsigned int i : slips_local_dofs[slip_id])
                 scratch.face_scalar_phi[slip_id][i] =
-                  fe_face_values[fe_field->get_slip_extractor(
-                    crystal_id, slip_id)].value(i,face_q_point);
+                  fe_face_values.shape_value(i, face_q_point);
 
-                scratch.neighbour_face_scalar_phi[slip_id][i] =
-                  neighbour_fe_face_values[fe_field->get_slip_extractor(
-                    neighbour_crystal_id, slip_id)].value(i,face_q_point);
-              }
-          }
+              for (const unsigned int j : neighbour_slips_local_dofs[slip_id])
+                scratch.neighbour_face_scalar_phi[slip_id][j] =
+                  neighbour_fe_face_values.shape_value(j, face_q_point);
+            }
 
-          // Loop over degrees of freedom
-          for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
-            for (unsigned int j = 0; j < scratch.dofs_per_cell; ++j)
-              if (fe_field->get_global_component(crystal_id, i) < dim &&
-                  fe_field->get_global_component(crystal_id, j) < dim)
+            // Slip-slip blocks
+            for (unsigned int slip_id_alpha = 0;
+                slip_id_alpha < crystals_data->get_n_slips();
+                ++slip_id_alpha)
+              for (const unsigned int i : slips_local_dofs[slip_id_alpha])
               {
-                if (fe_field->is_decohesion_allowed())
-                {
-                  data.local_matrix(i,j) -=
-                    scratch.face_vector_phi[i] *
-                    (cohesive_law->get_degradation_function_value(
-                      scratch.damage_variable_values[face_q_point],
-                      parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_macrotraction_to_damage) *
-                     scratch.cohesive_law_jacobian_values[face_q_point]
-                     +
-                     scratch.contact_law_jacobian_values[face_q_point]) *
-                    - 1.0 *
-                    scratch.face_vector_phi[j] *
-                    scratch.face_JxW_values[face_q_point];
+                const double test_function_contribution =
+                  scratch.face_scalar_phi[slip_id_alpha][i] *
+                  degradation_value;
 
-                  data.local_coupling_matrix(i,j) -=
-                    scratch.face_vector_phi[i] *
-                    (cohesive_law->get_degradation_function_value(
-                      scratch.damage_variable_values[face_q_point],
-                      parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_macrotraction_to_damage) *
-                     scratch.cohesive_law_jacobian_values[face_q_point]
-                     +
-                     scratch.contact_law_jacobian_values[face_q_point]) *
-                    scratch.neighbor_face_vector_phi[j] *
-                    scratch.face_JxW_values[face_q_point];
-
-                  AssertIsFinite(data.local_matrix(i,j));
-                  AssertIsFinite(data.local_coupling_matrix(i,j));
-                }
-              }
-              else if (
-                fe_field->get_global_component(crystal_id, i) >= dim &&
-                fe_field->get_global_component(crystal_id, j) >= dim)
-              {
-                if (parameters.boundary_conditions_at_grain_boundaries ==
-                    RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction)
+                for (unsigned int slip_id_beta = 0;
+                    slip_id_beta < crystals_data->get_n_slips();
+                    ++slip_id_beta)
                 {
-                  const unsigned int slip_id_alpha =
-                    fe_field->get_global_component(crystal_id, i) - dim;
-
-                  const unsigned int slip_id_beta =
-                    fe_field->get_global_component(crystal_id, j) - dim;
-
-                  const unsigned int neighbour_slip_id_beta =
-                    fe_field->get_global_component(neighbour_crystal_id, j)
-                    - dim;
-
-                  data.local_matrix(i,j) -=
-                    scratch.face_scalar_phi[slip_id_alpha][i] *
-                    cohesive_law->get_degradation_function_value(
-                      scratch.damage_variable_values[face_q_point],
-                      parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_microtraction_to_damage) *
-                    scratch.intra_gateaux_derivative_values[face_q_point][slip_id_alpha][slip_id_beta] *
-                    scratch.face_scalar_phi[slip_id_beta][j] *
-                    scratch.face_JxW_values[face_q_point];
-
-                  data.local_coupling_matrix(i,j) -=
-                    scratch.face_scalar_phi[slip_id_alpha][i] *
-                    cohesive_law->get_degradation_function_value(
-                      scratch.damage_variable_values[face_q_point],
-                      parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_microtraction_to_damage) *
-                    scratch.inter_gateaux_derivative_values[face_q_point][slip_id_alpha][neighbour_slip_id_beta] *
-                    scratch.neighbour_face_scalar_phi[neighbour_slip_id_beta][j] *
-                    scratch.face_JxW_values[face_q_point];
-
-                  AssertIsFinite(data.local_matrix(i,j));
-                  AssertIsFinite(data.local_coupling_matrix(i,j));
+                  const double intra_gateaux_derivative =
+                    test_function_contribution *
+                    scratch.intra_gateaux_derivative_values[face_q_point][slip_id_alpha][slip_id_beta];
+
+                  const double inter_gateaux_derivative =
+                    test_function_contribution *
+                    scratch.inter_gateaux_derivative_values[face_q_point][slip_id_alpha][slip_id_beta];
+
+                  for (const unsigned int j : slips_local_dofs[slip_id_beta])
+                  {
+                    data.local_matrix(i,j) -=
+                      intra_gateaux_derivative *
+                      scratch.face_scalar_phi[slip_id_beta][j];
+
+                    AssertIsFinite(data.local_matrix(i,j));
+                  }
+
+                  for (const unsigned int j : neighbour_slips_local_dofs[slip_id_beta])
+                  {
+                    data.local_coupling_matrix(i,j) -=
+                      inter_gateaux_derivative *
+                      scratch.neighbour_face_scalar_phi[slip_id_beta][j];
+
+                    AssertIsFinite(data.local_coupling_matrix(i,j));
+                  }
                 }
-              } // Loop over degrees of freedom
+              }
+          }
         } // Loop over face quadrature points
 
         data.neighbour_cells_local_dof_indices.emplace_back(
@@ -556,9 +1064,131 @@ void GradientCrystalPlasticitySolver<dim>::copy_local_to_global_jacobian(
 
 
 
+template <int dim>
+bool GradientCrystalPlasticitySolver<dim>::get_cached_local_jacobian(
+  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+  const gCP::AssemblyData::Jacobian::Scratch<dim>               &scratch,
+  const dealii::ArrayView<const double>                         &slip_resistances,
+  dealii::FullMatrix<double>                                    &local_matrix)
+{
+  const unsigned int cell_index =
+    get_locally_owned_cell_index(cell->active_cell_index());
+
+  AssertIndexRange(cell_index, local_jacobian_cache.size());
+
+  const LocalJacobianCacheEntry &cache_entry =
+    local_jacobian_cache[cell_index];
+
+  const double step_size = discrete_time.get_next_step_size();
+
+  const double tolerance = parameters.local_jacobian_cache_tolerance;
+
+  // The slip gradients only enter the Jacobian if the vectorial
+  // microstress law is nonlinear
+  const bool flag_compare_slip_gradients =
+    !vectorial_microstress_law_is_linear();
+
+  bool flag_cache_hit =
+    cache_entry.is_valid &&
+    cache_entry.step_number == discrete_time.get_step_number() &&
+    cache_entry.step_size == step_size;
+
+  for (unsigned int slip_id = 0;
+       slip_id < crystals_data->get_n_slips() && flag_cache_hit;
+       ++slip_id)
+    for (unsigned int q_point = 0;
+         q_point < scratch.n_q_points && flag_cache_hit;
+         ++q_point)
+    {
+      const double slip_rate =
+        (scratch.slip_values[slip_id][q_point] -
+         scratch.old_slip_values[slip_id][q_point]) / step_size;
+
+      if (std::abs(slip_rate - cache_entry.slip_rates[slip_id][q_point]) >
+            tolerance)
+        flag_cache_hit = false;
+      else if (flag_compare_slip_gradients &&
+               (scratch.slip_gradient_values[slip_id][q_point] -
+                cache_entry.slip_gradients[slip_id][q_point]).norm() >
+                 tolerance)
+        flag_cache_hit = false;
+    }
+
+  // The slip resistances are compared relative to their magnitude
+  for (unsigned int i = 0;
+       i < slip_resistances.size() && flag_cache_hit;
+       ++i)
+    if (std::abs(slip_resistances[i] - cache_entry.slip_resistances[i]) >
+          tolerance * std::abs(cache_entry.slip_resistances[i]))
+      flag_cache_hit = false;
+
+  if (flag_cache_hit)
+  {
+    local_matrix = cache_entry.local_matrix;
+
+    ++n_local_jacobian_cache_hits;
+  }
+  else
+    ++n_local_jacobian_cache_misses;
+
+  return (flag_cache_hit);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::cache_local_jacobian(
+  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+  const gCP::AssemblyData::Jacobian::Scratch<dim>               &scratch,
+  const dealii::ArrayView<const double>                         &slip_resistances,
+  const dealii::FullMatrix<double>                              &local_matrix)
+{
+  const unsigned int cell_index =
+    get_locally_owned_cell_index(cell->active_cell_index());
+
+  AssertIndexRange(cell_index, local_jacobian_cache.size());
+
+  LocalJacobianCacheEntry &cache_entry =
+    local_jacobian_cache[cell_index];
+
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  cache_entry.is_valid      = true;
+
+  cache_entry.step_number   = discrete_time.get_step_number();
+
+  cache_entry.step_size     = discrete_time.get_next_step_size();
+
+  cache_entry.local_matrix  = local_matrix;
+
+  cache_entry.slip_resistances.assign(slip_resistances.begin(),
+                                      slip_resistances.end());
+
+  cache_entry.slip_rates.resize(n_slips);
+
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+  {
+    cache_entry.slip_rates[slip_id].resize(scratch.n_q_points);
+
+    for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
+      cache_entry.slip_rates[slip_id][q_point] =
+        (scratch.slip_values[slip_id][q_point] -
+         scratch.old_slip_values[slip_id][q_point]) /
+        cache_entry.step_size;
+  }
+
+  if (!vectorial_microstress_law_is_linear())
+    cache_entry.slip_gradients = scratch.slip_gradient_values;
+}
+
+
+
 template <int dim>
 double GradientCrystalPlasticitySolver<dim>::assemble_residual()
 {
+  if (parameters.flag_fused_history_update)
+    store_trial_interface_damage_variables();
+
   if (parameters.verbose)
     *pcout << std::setw(38) << std::left
            << "  Solver: Assembling residual...";
@@ -570,20 +1200,26 @@ double GradientCrystalPlasticitySolver<dim>::assemble_residual()
   using CellIterator =
     typename dealii::DoFHandler<dim>::active_cell_iterator;
 
-  using CellFilter =
-    dealii::FilteredIterator<
-      typename dealii::DoFHandler<dim>::active_cell_iterator>;
-
   // Reset data
   residual = 0.0;
 
+  if (parameters.line_search_parameters.flag_reuse_linear_contributions)
+    nonlinear_residual = 0.0;
+
+  const bool flag_update_quadrature_point_history =
+    parameters.flag_fused_history_update;
+
   // Set up the lambda function for the local assembly operation
-  auto worker = [this](
+  auto worker = [this, flag_update_quadrature_point_history](
     const CellIterator                         &cell,
     gCP::AssemblyData::Residual::Scratch<dim>  &scratch,
     gCP::AssemblyData::Residual::Copy          &data)
   {
-    this->assemble_local_residual(cell, scratch, data);
+    this->assemble_local_residual(cell,
+                                  scratch,
+                                  data,
+                                  false,
+                                  flag_update_quadrature_point_history);
   };
 
   // Set up the lambda function for the copy local to global operation
@@ -592,12 +1228,17 @@ double GradientCrystalPlasticitySolver<dim>::assemble_residual()
     this->copy_local_to_global_residual(data);
   };
 
-  // Define the update flags for the FEValues instances
+  // Define the update flags for the FEValues instances. The
+  // sum-factorized kernels only need the mapping data
   const dealii::UpdateFlags update_flags  =
-    dealii::update_JxW_values |
-    dealii::update_values |
-    dealii::update_gradients |
-    dealii::update_quadrature_points;
+    parameters.flag_sum_factorization ?
+      (dealii::update_JxW_values |
+       dealii::update_inverse_jacobians |
+       dealii::update_quadrature_points) :
+      (dealii::update_JxW_values |
+       dealii::update_values |
+       dealii::update_gradients |
+       dealii::update_quadrature_points);
 
   const dealii::UpdateFlags face_update_flags  =
     dealii::update_JxW_values |
@@ -605,28 +1246,71 @@ double GradientCrystalPlasticitySolver<dim>::assemble_residual()
     dealii::update_values |
     dealii::update_quadrature_points;
 
-  // Assemble using the WorkStream approach
-  dealii::WorkStream::run(
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               fe_field->get_dof_handler().begin_active()),
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               fe_field->get_dof_handler().end()),
-    worker,
-    copier,
-    gCP::AssemblyData::Residual::Scratch<dim>(
-      mapping_collection,
-      quadrature_collection,
-      face_quadrature_collection,
-      fe_field->get_fe_collection(),
-      update_flags,
-      face_update_flags,
-      crystals_data->get_n_slips()),
-    gCP::AssemblyData::Residual::Copy(
-      fe_field->get_fe_collection().max_dofs_per_cell()));
+  gCP::AssemblyData::Residual::Scratch<dim> scratch(
+    mapping_collection,
+    quadrature_collection,
+    face_quadrature_collection,
+    fe_field->get_fe_collection(),
+    update_flags,
+    face_update_flags,
+    crystals_data->get_n_slips());
+
+  scratch.flag_sum_factorization = parameters.flag_sum_factorization;
+
+  const gCP::AssemblyData::Residual::Copy copy(
+    fe_field->get_fe_collection().max_dofs_per_cell());
+
+  // Assemble using the WorkStream approach. The sum-factorized kernels
+  // run over cell batches
+  if (parameters.flag_sum_factorization)
+  {
+    auto batch_worker = [this, flag_update_quadrature_point_history](
+      const CellBatchIterator                                     &cell_batch,
+      gCP::AssemblyData::Residual::Scratch<dim>                   &scratch,
+      gCP::AssemblyData::CellBatchCopy<
+        gCP::AssemblyData::Residual::Copy>                        &data)
+    {
+      this->assemble_local_residual(*cell_batch,
+                                    scratch,
+                                    data,
+                                    false,
+                                    flag_update_quadrature_point_history);
+    };
+
+    auto batch_copier = [&copier](
+      const gCP::AssemblyData::CellBatchCopy<
+        gCP::AssemblyData::Residual::Copy>  &data)
+    {
+      for (unsigned int lane = 0; lane < data.n_cells; ++lane)
+        copier(data.cell_copies[lane]);
+    };
+
+    run_work_stream(
+      cell_batches,
+      colored_cell_batches,
+      "residual assembly",
+      batch_worker,
+      batch_copier,
+      scratch,
+      gCP::AssemblyData::CellBatchCopy<
+        gCP::AssemblyData::Residual::Copy>(copy));
+  }
+  else
+    run_work_stream(
+      fe_field->get_dof_handler(),
+      colored_cells,
+      "residual assembly",
+      worker,
+      copier,
+      scratch,
+      copy);
 
   // Compress global data
   residual.compress(dealii::VectorOperation::add);
 
+  if (parameters.line_search_parameters.flag_reuse_linear_contributions)
+    nonlinear_residual.compress(dealii::VectorOperation::add);
+
   residual_norm = residual.l2_norm();
 
   ghost_residual = residual;
@@ -643,178 +1327,421 @@ template <int dim>
 void GradientCrystalPlasticitySolver<dim>::assemble_local_residual(
   const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
   gCP::AssemblyData::Residual::Scratch<dim>                     &scratch,
-  gCP::AssemblyData::Residual::Copy                             &data)
+  gCP::AssemblyData::Residual::Copy                             &data,
+  const bool flag_nonlinear_contributions_only,
+  const bool flag_update_quadrature_point_history)
+{
+  // Update the hp::FEValues instance to the values of the current cell
+  scratch.hp_fe_values.reinit(cell);
+
+  const dealii::FEValues<dim> &fe_values =
+    scratch.hp_fe_values.get_present_fe_values();
+
+  // The sum-factorized path runs over cell batches, see the overload
+  // for a CellBatch
+  Assert(!scratch.flag_sum_factorization,
+         dealii::ExcMessage("The sum-factorized residual is assembled "
+                            "cell batch by cell batch."));
+
+  // Get the slips and their gradients values at the quadrature points
+  evaluate_local_slips(cell,
+                       fe_values,
+                       trial_solution,
+                       scratch.local_dof_values,
+                       scratch.slip_values,
+                       &scratch.slip_gradient_values);
+
+  evaluate_local_slips(cell,
+                       fe_values,
+                       fe_field->old_solution,
+                       scratch.local_dof_values,
+                       scratch.old_slip_values);
+
+  // Update the slip resistances at the quadrature points. The residual
+  // of the cell only depends on its own values
+  if (flag_update_quadrature_point_history)
+    for (const unsigned int q_point : fe_values.quadrature_point_indices())
+      quadrature_point_history.update_values(
+        cell->active_cell_index(),
+        q_point,
+        scratch.slip_values,
+        scratch.old_slip_values);
+
+  assemble_local_residual(cell,
+                          fe_values,
+                          scratch,
+                          data,
+                          flag_nonlinear_contributions_only,
+                          flag_update_quadrature_point_history);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::assemble_local_residual(
+  const CellBatch                                             &cell_batch,
+  gCP::AssemblyData::Residual::Scratch<dim>                   &scratch,
+  gCP::AssemblyData::CellBatchCopy<
+    gCP::AssemblyData::Residual::Copy>                        &data,
+  const bool flag_nonlinear_contributions_only,
+  const bool flag_update_quadrature_point_history)
+{
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  const bool flag_assemble_linear_contributions =
+    !flag_nonlinear_contributions_only;
+
+  data.n_cells = cell_batch.cells.size();
+
+  // Evaluate the slips of the old solution and the slips and the
+  // displacement gradients of the trial solution at the quadrature
+  // points of all cells at once
+  gather_batch_dof_values(cell_batch, fe_field->old_solution, scratch);
+
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    evaluate_batch_component(cell_batch,
+                             *slip_kernels,
+                             dim + slip_id,
+                             scratch,
+                             &scratch.batch_old_slip_values[slip_id],
+                             nullptr);
+
+  gather_batch_dof_values(cell_batch, trial_solution, scratch);
+
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    evaluate_batch_component(
+      cell_batch,
+      *slip_kernels,
+      dim + slip_id,
+      scratch,
+      &scratch.component_values[dim + slip_id],
+      &scratch.component_reference_gradients[dim + slip_id]);
+
+  if (flag_assemble_linear_contributions)
+    for (unsigned int component = 0; component < dim; ++component)
+      evaluate_batch_component(
+        cell_batch,
+        *displacement_kernels,
+        component,
+        scratch,
+        nullptr,
+        &scratch.component_reference_gradients[component]);
+
+  // The constitutive laws and the grain boundary integrals are
+  // evaluated cell by cell
+  for (unsigned int lane = 0; lane < cell_batch.cells.size(); ++lane)
+  {
+    const typename dealii::DoFHandler<dim>::active_cell_iterator &cell =
+      cell_batch.cells[lane];
+
+    // Update the hp::FEValues instance to the mapping data of the
+    // current cell
+    scratch.hp_fe_values.reinit(cell);
+
+    const dealii::FEValues<dim> &fe_values =
+      scratch.hp_fe_values.get_present_fe_values();
+
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    {
+      get_lane_values(fe_values,
+                      lane,
+                      &scratch.batch_old_slip_values[slip_id],
+                      nullptr,
+                      &scratch.old_slip_values[slip_id],
+                      nullptr);
+
+      get_lane_values(fe_values,
+                      lane,
+                      &scratch.component_values[dim + slip_id],
+                      &scratch.component_reference_gradients[dim + slip_id],
+                      &scratch.slip_values[slip_id],
+                      &scratch.slip_gradient_values[slip_id]);
+    }
+
+    if (flag_assemble_linear_contributions)
+      for (unsigned int component = 0; component < dim; ++component)
+        get_lane_values(fe_values,
+                        lane,
+                        nullptr,
+                        &scratch.component_reference_gradients[component],
+                        nullptr,
+                        &scratch.displacement_gradient_values[component]);
+
+    // Update the slip resistances at the quadrature points. The
+    // residual of the cell only depends on its own values
+    if (flag_update_quadrature_point_history)
+      for (const unsigned int q_point : fe_values.quadrature_point_indices())
+        quadrature_point_history.update_values(
+          cell->active_cell_index(),
+          q_point,
+          scratch.slip_values,
+          scratch.old_slip_values);
+
+    assemble_local_residual(cell,
+                            fe_values,
+                            scratch,
+                            data.cell_copies[lane],
+                            flag_nonlinear_contributions_only,
+                            flag_update_quadrature_point_history);
+
+    set_lane_bulk_residual_fluxes(fe_values,
+                                  lane,
+                                  scratch,
+                                  flag_assemble_linear_contributions);
+  }
+
+  // Integrate the bulk contributions of all cells at once
+  integrate_batch_bulk_residual(cell_batch,
+                                scratch,
+                                data,
+                                flag_assemble_linear_contributions);
+
+  for (unsigned int lane = 0; lane < cell_batch.cells.size(); ++lane)
+    data.cell_copies[lane].local_rhs +=
+      data.cell_copies[lane].local_nonlinear_rhs;
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::assemble_local_residual(
+  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+  const dealii::FEValues<dim>                                   &fe_values,
+  gCP::AssemblyData::Residual::Scratch<dim>                     &scratch,
+  gCP::AssemblyData::Residual::Copy                             &data,
+  const bool flag_nonlinear_contributions_only,
+  const bool flag_update_interface_quadrature_point_history)
 {
   // Reset local data
   data.local_rhs                          = 0.0;
+  data.local_nonlinear_rhs                = 0.0;
   data.local_matrix_for_inhomogeneous_bcs = 0.0;
 
+  // The affine contributions are added to data.local_rhs and the
+  // remaining ones to data.local_nonlinear_rhs. The latter are added
+  // to the former at the end
+  const bool flag_linear_vectorial_microstress =
+    vectorial_microstress_law_is_linear();
+
+  const bool flag_linear_microscopic_traction =
+    microscopic_traction_law_is_linear();
+
+  const bool flag_assemble_linear_contributions =
+    !flag_nonlinear_contributions_only;
+
   // Local to global mapping of the indices of the degrees of freedom
   cell->get_dof_indices(data.local_dof_indices);
 
   // Get the crystal identifier for the current cell
   const unsigned int crystal_id = cell->material_id();
 
-  // Update the hp::FEValues instance to the values of the current cell
-  scratch.hp_fe_values.reinit(cell);
-
-  const dealii::FEValues<dim> &fe_values =
-    scratch.hp_fe_values.get_present_fe_values();
-
   // Get JxW values at the quadrature points
   scratch.JxW_values = fe_values.get_JxW_values();
 
-  // Get the hardening variable values at the quadrature points
-  const std::vector<std::shared_ptr<QuadraturePointHistory<dim>>>
-    local_quadrature_point_history =
-      quadrature_point_history.get_data(cell);
+  // Get the linear strain tensor values at the quadrature points. In
+  // the sum-factorized path the displacement gradients were evaluated
+  // for the whole cell batch
+  if (flag_assemble_linear_contributions && scratch.flag_sum_factorization)
+  {
+    for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
+    {
+      dealii::Tensor<2,dim> displacement_gradient;
 
-  // Get the linear strain tensor values at the quadrature points
-  fe_values[fe_field->get_displacement_extractor(crystal_id)].get_function_symmetric_gradients(
-    trial_solution,
-    scratch.strain_tensor_values);
+      for (unsigned int component = 0; component < dim; ++component)
+        displacement_gradient[component] =
+          scratch.displacement_gradient_values[component][q_point];
+
+      scratch.strain_tensor_values[q_point] =
+        dealii::symmetrize(displacement_gradient);
+    }
+  }
+  else if (flag_assemble_linear_contributions)
+    fe_values[fe_field->get_displacement_extractor(crystal_id)].get_function_symmetric_gradients(
+      trial_solution,
+      scratch.strain_tensor_values);
 
   // Get the supply term values at the quadrature points
-  if (supply_term.get() != nullptr)
+  if (supply_term.get() != nullptr && flag_assemble_linear_contributions)
     supply_term->value_list(
       fe_values.get_quadrature_points(),
       scratch.supply_term_values);
 
-  // Get the slips and their gradients values at the quadrature points
-  for (unsigned int slip_id = 0;
-      slip_id < crystals_data->get_n_slips();
-      ++slip_id)
-  {
-    fe_values[fe_field->get_slip_extractor(crystal_id, slip_id)].get_function_values(
-      trial_solution,
-      scratch.slip_values[slip_id]);
-
-    fe_values[fe_field->get_slip_extractor(crystal_id, slip_id)].get_function_values(
-      fe_field->old_solution,
-      scratch.old_slip_values[slip_id]);
-
-    fe_values[fe_field->get_slip_extractor(crystal_id, slip_id)].get_function_gradients(
-      trial_solution,
-      scratch.slip_gradient_values[slip_id]);
-  }
+  // Local degrees of freedom grouped by their global component
+  const std::vector<unsigned int> &displacement_local_dofs =
+    fe_field->get_displacement_local_dofs(crystal_id);
+
+  const std::vector<std::vector<unsigned int>> &slips_local_dofs =
+    fe_field->get_slips_local_dofs(crystal_id);
+
+  // Compute the scalar microscopic stress values at all quadrature
+  // points at once
+  scalar_microstress_law->get_scalar_microstresses(
+    scratch.slip_values,
+    scratch.old_slip_values,
+    quadrature_point_history.get_slip_resistances(
+      cell->active_cell_index(),
+      scratch.slip_values,
+      scratch.old_slip_values,
+      scratch.slip_resistance_values),
+    discrete_time.get_next_step_size(),
+    scratch.scalar_microstress_values);
+
+  // Compute the vectorial microscopic stress values at all quadrature
+  // points at once
+  if (flag_assemble_linear_contributions ||
+      !flag_linear_vectorial_microstress)
+    vectorial_microstress_law->get_vectorial_microstresses(
+      crystal_id,
+      scratch.slip_gradient_values,
+      scratch.vectorial_microstress_values);
 
   // Loop over quadrature points
   for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
   {
-    // Compute the elastic strain tensor at the quadrature point
-    scratch.elastic_strain_tensor_values[q_point] =
-      macroscopic_strain +
-      elastic_strain->get_elastic_strain_tensor(
-        crystal_id,
-        q_point,
-        scratch.strain_tensor_values[q_point],
-        scratch.slip_values);
-
-    // Compute the stress tensor at the quadrature point
-    scratch.stress_tensor_values[q_point] =
-      hooke_law->get_stress_tensor(
-        crystal_id,
-        scratch.elastic_strain_tensor_values[q_point]);
-
-    // Compute the resolved stress, scalar microscopic stress and
-    // vector microscopic stress values at the quadrature point
-    for (unsigned int slip_id = 0;
-         slip_id < crystals_data->get_n_slips();
-         ++slip_id)
+    if (flag_assemble_linear_contributions)
     {
-      scratch.vectorial_microstress_values[slip_id][q_point] =
-        vectorial_microstress_law->get_vectorial_microstress(
+      // Compute the elastic strain tensor at the quadrature point
+      scratch.elastic_strain_tensor_values[q_point] =
+        macroscopic_strain +
+        elastic_strain->get_elastic_strain_tensor(
           crystal_id,
-          slip_id,
-          scratch.slip_gradient_values[slip_id][q_point]);
+          q_point,
+          scratch.strain_tensor_values[q_point],
+          scratch.slip_values);
 
-      scratch.resolved_stress_values[slip_id][q_point] =
-        resolved_shear_stress_law->get_resolved_shear_stress(
+      // Compute the stress tensor at the quadrature point
+      scratch.stress_tensor_values[q_point] =
+        hooke_law->get_stress_tensor(
           crystal_id,
-          slip_id,
-          scratch.stress_tensor_values[q_point]);
-
-      scratch.scalar_microstress_values[slip_id][q_point] =
-        scalar_microstress_law->get_scalar_microstress(
-          scratch.slip_values[slip_id][q_point],
-          scratch.old_slip_values[slip_id][q_point],
-          local_quadrature_point_history[q_point]->get_slip_resistance(slip_id),
-          discrete_time.get_next_step_size());
-    }
-
-    // Extract test function values at the quadrature points (Displacements)
-    for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
-    {
-      scratch.vector_phi[i] =
-        fe_values[fe_field->get_displacement_extractor(crystal_id)].value(i,q_point);
-
-      scratch.sym_grad_vector_phi[i] =
-        fe_values[fe_field->get_displacement_extractor(crystal_id)].symmetric_gradient(i,q_point);
+          scratch.elastic_strain_tensor_values[q_point]);
     }
 
-    // Extract test function values at the quadrature points (Slips)
+    // Compute the resolved stress values at the quadrature point
     for (unsigned int slip_id = 0;
          slip_id < crystals_data->get_n_slips();
          ++slip_id)
     {
-      for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
-      {
-        scratch.scalar_phi[slip_id][i] =
-          fe_values[fe_field->get_slip_extractor(crystal_id, slip_id)].value(i,q_point);
-
-        scratch.grad_scalar_phi[slip_id][i] =
-          fe_values[fe_field->get_slip_extractor(crystal_id, slip_id)].gradient(i,q_point);
-      }
+      if (flag_assemble_linear_contributions)
+        scratch.resolved_stress_values[slip_id][q_point] =
+          resolved_shear_stress_law->get_resolved_shear_stress(
+            crystal_id,
+            slip_id,
+            scratch.stress_tensor_values[q_point]);
     }
 
-    // Loop over the degrees of freedom
-    for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
-    {
-      if (fe_field->get_global_component(crystal_id, i) < dim)
+    // The sum-factorized path integrates all quadrature points at once
+    // after the loop
+    if (scratch.flag_sum_factorization)
+      continue;
+
+    const double JxW_value = scratch.JxW_values[q_point];
+
+    // Displacement block
+    if (flag_assemble_linear_contributions)
+      for (const unsigned int i : displacement_local_dofs)
       {
+        scratch.vector_phi[i] =
+          fe_values[fe_field->get_displacement_extractor(crystal_id)].value(i,q_point);
+
+        scratch.sym_grad_vector_phi[i] =
+          fe_values[fe_field->get_displacement_extractor(crystal_id)].symmetric_gradient(i,q_point);
+
         data.local_rhs(i) -=
           (scratch.sym_grad_vector_phi[i] *
            scratch.stress_tensor_values[q_point]
            -
            scratch.vector_phi[i] *
            scratch.supply_term_values[q_point]) *
-          scratch.JxW_values[q_point];
+          JxW_value;
       }
-      else
+
+    // Slip blocks
+    for (unsigned int slip_id = 0;
+         slip_id < crystals_data->get_n_slips();
+         ++slip_id)
+    {
+      const double resolved_stress_value =
+        scratch.resolved_stress_values[slip_id][q_point] * JxW_value;
+
+      const double scalar_microstress_value =
+        scratch.scalar_microstress_values[slip_id][q_point] * JxW_value;
+
+      const dealii::Tensor<1,dim> vectorial_microstress_value =
+        scratch.vectorial_microstress_values[slip_id][q_point] * JxW_value;
+
+      for (const unsigned int i : slips_local_dofs[slip_id])
       {
-        const unsigned int slip_id =
-                fe_field->get_global_component(crystal_id, i) - dim;
+        scratch.scalar_phi[slip_id][i] =
+          fe_values.shape_value(i, q_point);
 
-        data.local_rhs(i) -=
-          (scratch.grad_scalar_phi[slip_id][i] *
-           scratch.vectorial_microstress_values[slip_id][q_point]
-           -
-           scratch.scalar_phi[slip_id][i] *
-           (scratch.resolved_stress_values[slip_id][q_point]
-            -
-            scratch.scalar_microstress_values[slip_id][q_point])) *
-          scratch.JxW_values[q_point];
+        scratch.grad_scalar_phi[slip_id][i] =
+          fe_values.shape_grad(i, q_point);
+
+        const double vectorial_microstress_contribution =
+          scratch.grad_scalar_phi[slip_id][i] *
+          vectorial_microstress_value;
+
+        if (flag_assemble_linear_contributions)
+          data.local_rhs(i) +=
+            scratch.scalar_phi[slip_id][i] *
+            resolved_stress_value;
+
+        if (flag_linear_vectorial_microstress)
+        {
+          if (flag_assemble_linear_contributions)
+            data.local_rhs(i) -= vectorial_microstress_contribution;
+        }
+        else
+          data.local_nonlinear_rhs(i) -= vectorial_microstress_contribution;
+
+        data.local_nonlinear_rhs(i) -=
+          scratch.scalar_phi[slip_id][i] *
+          scalar_microstress_value;
       }
-    } // Loop over the degrees of freedom
+    } // Loop over the slips
   } // Loop over quadrature points
 
+  // Only the nonlinear microscopic tractions are needed if the
+  // affine contributions are skipped
+  const bool flag_microtraction_at_grain_boundaries =
+    parameters.boundary_conditions_at_grain_boundaries ==
+      RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction &&
+    (flag_assemble_linear_contributions ||
+     !flag_linear_microscopic_traction);
+
+  // The interface quadrature point history only exists if decohesion
+  // is allowed. Under cyclic loading its update depends on the slips
+  const bool flag_update_interface_history =
+    flag_update_interface_quadrature_point_history &&
+    fe_field->is_decohesion_allowed();
+
+  const bool flag_face_slip_values =
+    flag_microtraction_at_grain_boundaries ||
+    (flag_update_interface_history &&
+     temporal_discretization_parameters.loading_type !=
+       RunTimeParameters::LoadingType::Monotonic);
+
   // Grain boundary integral
   if (cell_is_at_grain_boundary(cell->active_cell_index()) &&
       (fe_field->is_decohesion_allowed() ||
-       parameters.boundary_conditions_at_grain_boundaries ==
-        RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction))
-    for (const auto &face_index : cell->face_indices())
-      if (!cell->face(face_index)->at_boundary() &&
-          cell->material_id() !=
-            cell->neighbor(face_index)->material_id())
+       flag_microtraction_at_grain_boundaries))
+  {
+    const dealii::ArrayView<const GrainBoundaryFace> cell_grain_boundary_faces =
+      get_grain_boundary_faces(cell->active_cell_index());
+
+    for (unsigned int face_no = 0;
+         face_no < cell_grain_boundary_faces.size(); ++face_no)
       {
+        const GrainBoundaryFace &grain_boundary_face =
+          cell_grain_boundary_faces[face_no];
+
         // Get the crystal identifier for the neighbour cell
         const unsigned int neighbour_crystal_id =
-          cell->neighbor(face_index)->active_fe_index();
+          grain_boundary_face.neighbour_crystal_id;
 
         // Update the hp::FEFaceValues instance to the values of the
         // current face
-        scratch.hp_fe_face_values.reinit(cell, face_index);
+        scratch.hp_fe_face_values.reinit(cell, grain_boundary_face.face_index);
 
         const dealii::FEFaceValues<dim> &fe_face_values =
           scratch.hp_fe_face_values.get_present_fe_values();
@@ -822,8 +1749,8 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_residual(
         // Update the hp::FEFaceValues instance to the values of the
         // neighbour face
         scratch.neighbour_hp_fe_face_values.reinit(
-          cell->neighbor(face_index),
-          cell->neighbor_of_neighbor(face_index));
+          grain_boundary_face.neighbour_cell,
+          grain_boundary_face.neighbour_face_index);
 
         const dealii::FEFaceValues<dim> &neighbour_fe_face_values =
           scratch.neighbour_hp_fe_face_values.get_present_fe_values();
@@ -834,18 +1761,9 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_residual(
         // Get normal vector values values at the quadrature points
         scratch.normal_vector_values = fe_face_values.get_normal_vectors();
 
-        if (parameters.boundary_conditions_at_grain_boundaries ==
-          RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction)
-        {
-           // Get grain interactino moduli
-          scratch.grain_interaction_moduli =
-            microscopic_traction_law->get_grain_interaction_moduli(
-              crystal_id,
-              neighbour_crystal_id,
-              scratch.normal_vector_values);
-
-          // Get the values of the slips of the current and the neighbour
-          // cell at the face quadrature points
+        // Get the values of the slips of the current and the neighbour
+        // cell at the face quadrature points
+        if (flag_face_slip_values)
           for (unsigned int slip_id = 0;
               slip_id < crystals_data->get_n_slips(); ++slip_id)
           {
@@ -859,19 +1777,28 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_residual(
                   trial_solution,
                   scratch.neighbour_face_slip_values[slip_id]);
           }
-        }
-
-        std::vector<std::shared_ptr<InterfaceQuadraturePointHistory<dim>>>
-          local_interface_quadrature_point_history;
 
-        if (fe_field->is_decohesion_allowed())
-        {
-          // Get the internal variable values at the quadrature points
+        // Compute the microscopic traction values at all quadrature
+        // points of the face at once
+        if (flag_microtraction_at_grain_boundaries)
+          microscopic_traction_law->get_microscopic_tractions(
+            grain_boundary_face.grain_interaction_moduli,
+            scratch.face_slip_values,
+            scratch.neighbour_face_slip_values,
+            scratch.microscopic_traction_values);
+
+        // Get the internal variable values at the quadrature points. If
+        // they are updated, the ones of the face are computed locally
+        const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
           local_interface_quadrature_point_history =
+            flag_update_interface_history ?
+              dealii::make_array_view(
+                scratch.interface_quadrature_point_history[face_no]) :
               interface_quadrature_point_history.get_data(
-                cell->id(),
-                cell->neighbor(face_index)->id());
+                grain_boundary_face.interface_id);
 
+        if (fe_field->is_decohesion_allowed())
+        {
           // Get JxW values at the quadrature points
           scratch.face_neighbor_JxW_values =
             neighbour_fe_face_values.get_JxW_values();
@@ -895,110 +1822,154 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_residual(
             fe_field->get_displacement_extractor(neighbour_crystal_id)].get_function_values(
             fe_field->old_solution,
             scratch.neighbor_cell_old_displacement_values);
+
+          if (flag_update_interface_history)
+          {
+            // The previous trial damage variables, see
+            // store_trial_interface_damage_variables()
+            if (!trial_interface_damage_variables.empty())
+              for (unsigned int face_q_point = 0;
+                   face_q_point < scratch.n_face_q_points; ++face_q_point)
+                local_interface_quadrature_point_history[face_q_point].set(
+                  trial_interface_damage_variables[
+                    grain_boundary_face.interface_id * scratch.n_face_q_points +
+                    face_q_point]);
+
+            update_interface_quadrature_point_history(
+              grain_boundary_face,
+              scratch.current_cell_displacement_values,
+              scratch.neighbor_cell_displacement_values,
+              scratch.normal_vector_values,
+              scratch.face_slip_values,
+              scratch.neighbour_face_slip_values,
+              local_interface_quadrature_point_history);
+
+            // Only one of the two cells of the face writes the values
+            if (interface_grain_boundary_faces[grain_boundary_face.interface_id] ==
+                  grain_boundary_faces_offsets[cell->active_cell_index()] + face_no)
+              std::copy(local_interface_quadrature_point_history.begin(),
+                        local_interface_quadrature_point_history.end(),
+                        interface_quadrature_point_history.get_data(
+                          grain_boundary_face.interface_id).begin());
+          }
+
+          // Gather the opening displacements and the history values of
+          // the face and evaluate the grain boundary laws at all its
+          // quadrature points at once
+          for (unsigned int face_q_point = 0;
+               face_q_point < scratch.n_face_q_points; ++face_q_point)
+          {
+            scratch.opening_displacement_values[face_q_point] =
+              scratch.neighbor_cell_displacement_values[face_q_point] -
+              scratch.current_cell_displacement_values[face_q_point];
+
+            scratch.max_effective_opening_displacement_values[face_q_point] =
+              local_interface_quadrature_point_history[face_q_point].
+                get_max_effective_opening_displacement();
+          }
+
+          cohesive_law->get_cohesive_tractions(
+            scratch.opening_displacement_values,
+            scratch.normal_vector_values,
+            scratch.max_effective_opening_displacement_values,
+            scratch.cohesive_traction_values);
+
+          contact_law->get_contact_tractions(
+            scratch.opening_displacement_values,
+            scratch.normal_vector_values,
+            scratch.contact_traction_values);
         }
 
+        // Local degrees of freedom grouped by their global component
+        const std::vector<unsigned int> &displacement_local_dofs =
+          fe_field->get_displacement_local_dofs(crystal_id);
+
+        const std::vector<std::vector<unsigned int>> &slips_local_dofs =
+          fe_field->get_slips_local_dofs(crystal_id);
+
         // Loop over face quadrature points
         for (unsigned int face_q_point = 0;
              face_q_point < scratch.n_face_q_points; ++face_q_point)
         {
-          if (parameters.boundary_conditions_at_grain_boundaries ==
-            RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction)
-            for (unsigned int slip_id = 0;
-                slip_id < crystals_data->get_n_slips(); ++slip_id)
-            {
-              // Compute the microscopic traction values at the
-              // quadrature point
-              scratch.microscopic_traction_values[slip_id][face_q_point] =
-                microscopic_traction_law->get_microscopic_traction(
-                  face_q_point,
-                  slip_id,
-                  scratch.grain_interaction_moduli,
-                  scratch.face_slip_values,
-                  scratch.neighbour_face_slip_values);
-
-              // Extract test function values at the quadrature points (Slips)
-              for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
-                scratch.face_scalar_phi[slip_id][i] =
-                  fe_face_values[fe_field->get_slip_extractor(
-                    crystal_id, slip_id)].value(i,face_q_point);
-            }
+          const double JxW_value = scratch.face_JxW_values[face_q_point];
 
           scratch.damage_variable_values[face_q_point] = 0.0;
 
           if (fe_field->is_decohesion_allowed())
           {
             scratch.damage_variable_values[face_q_point] =
-              local_interface_quadrature_point_history[face_q_point]->
+              local_interface_quadrature_point_history[face_q_point].
                 get_damage_variable();
 
-            const dealii::Tensor<1,dim> opening_displacement =
-              scratch.neighbor_cell_displacement_values[face_q_point] -
-              scratch.current_cell_displacement_values[face_q_point];
-
-            scratch.cohesive_traction_values[face_q_point] =
-              cohesive_law->get_cohesive_traction(
-                opening_displacement,
-                scratch.normal_vector_values[face_q_point],
-                local_interface_quadrature_point_history[face_q_point]->
-                  get_max_effective_opening_displacement(),
-                local_interface_quadrature_point_history[face_q_point]->
-                  get_old_effective_opening_displacement(),
-                discrete_time.get_next_step_size());
-
-            scratch.contact_traction_values[face_q_point] =
-              contact_law->get_contact_traction(
-                opening_displacement,
-                scratch.normal_vector_values[face_q_point]);
-
-            // Extract test function values at the quadrature points (Slips)
-            for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
+            // The degradation function only depends on the quadrature
+            // point
+            const dealii::Tensor<1,dim> macroscopic_traction =
+              (cohesive_law->get_degradation_function_value(
+                scratch.damage_variable_values[face_q_point],
+                parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_macrotraction_to_damage) *
+               scratch.cohesive_traction_values[face_q_point]
+               +
+               scratch.contact_traction_values[face_q_point]) *
+              JxW_value;
+
+            // Displacement block
+            for (const unsigned int i : displacement_local_dofs)
+            {
               scratch.face_vector_phi[i] =
                 fe_face_values[fe_field->get_displacement_extractor(
                   crystal_id)].value(i, face_q_point);
-          }
 
-          // Loop over degrees of freedom
-          for (unsigned int i = 0; i < scratch.dofs_per_cell; ++i)
-            if (fe_field->get_global_component(crystal_id, i) < dim)
-            {
-              if (fe_field->is_decohesion_allowed())
-                data.local_rhs(i) +=
-                  scratch.face_vector_phi[i] *
-                  (cohesive_law->get_degradation_function_value(
-                    scratch.damage_variable_values[face_q_point],
-                    parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_macrotraction_to_damage) *
-                   scratch.cohesive_traction_values[face_q_point]
-                   +
-                   scratch.contact_traction_values[face_q_point])*
-                  scratch.face_JxW_values[face_q_point];
-
-              AssertIsFinite(data.local_rhs(i));
+              data.local_nonlinear_rhs(i) +=
+                scratch.face_vector_phi[i] * macroscopic_traction;
+
+              AssertIsFinite(data.local_nonlinear_rhs(i));
             }
-            else
+          }
+
+          if (flag_microtraction_at_grain_boundaries)
+          {
+            // The degradation function only depends on the quadrature
+            // point
+            const double degradation_value =
+              cohesive_law->get_degradation_function_value(
+                scratch.damage_variable_values[face_q_point],
+                parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_microtraction_to_damage) *
+              JxW_value;
+
+            // Slip blocks
+            for (unsigned int slip_id = 0;
+                slip_id < crystals_data->get_n_slips(); ++slip_id)
             {
-              if (parameters.boundary_conditions_at_grain_boundaries ==
-                  RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction)
+              const double microscopic_traction =
+                degradation_value *
+                scratch.microscopic_traction_values[slip_id][face_q_point];
+
+              for (const unsigned int i : slips_local_dofs[slip_id])
               {
-                const unsigned int slip_id =
-                  fe_field->get_global_component(crystal_id, i) - dim;
+                scratch.face_scalar_phi[slip_id][i] =
+                  fe_face_values.shape_value(i, face_q_point);
 
-                data.local_rhs(i) +=
+                const double microscopic_traction_contribution =
                   scratch.face_scalar_phi[slip_id][i] *
-                  cohesive_law->get_degradation_function_value(
-                    scratch.damage_variable_values[face_q_point],
-                    parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_microtraction_to_damage) *
-                  scratch.microscopic_traction_values[slip_id][face_q_point] *
-                  scratch.face_JxW_values[face_q_point];
-              }
+                  microscopic_traction;
 
-              AssertIsFinite(data.local_rhs(i));
-            } // Loop over degrees of freedom
+                if (flag_linear_microscopic_traction)
+                  data.local_rhs(i) += microscopic_traction_contribution;
+                else
+                  data.local_nonlinear_rhs(i) +=
+                    microscopic_traction_contribution;
+
+                AssertIsFinite(data.local_rhs(i));
+              }
+            }
+          }
         } // Loop over face quadrature points
       } // Loop over cell's faces
-
+  }
 
   // Boundary integral
-  if (!neumann_boundary_conditions.empty() && cell->at_boundary())
+  if (flag_assemble_linear_contributions &&
+      !neumann_boundary_conditions.empty() && cell->at_boundary())
     for (const auto &face : cell->face_iterators())
       if (face->at_boundary() &&
           neumann_boundary_conditions.find(face->boundary_id()) !=
@@ -1042,6 +2013,10 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_residual(
         } // Loop over face quadrature points
       } // if (face->at_boundary() && face->boundary_id() == 3)
 
+  // In the sum-factorized path the bulk integrals of the cell batch are
+  // still missing
+  if (!scratch.flag_sum_factorization)
+    data.local_rhs += data.local_nonlinear_rhs;
 }
 
 
@@ -1055,6 +2030,347 @@ void GradientCrystalPlasticitySolver<dim>::copy_local_to_global_residual(
     data.local_dof_indices,
     residual,
     data.local_matrix_for_inhomogeneous_bcs);
+
+  if (parameters.line_search_parameters.flag_reuse_linear_contributions)
+    fe_field->get_newton_method_constraints().distribute_local_to_global(
+      data.local_nonlinear_rhs,
+      data.local_dof_indices,
+      nonlinear_residual);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::store_linear_residual()
+{
+  linear_residual = residual;
+
+  linear_residual -= nonlinear_residual;
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::store_linear_residual_increment()
+{
+  linear_residual_increment = residual;
+
+  linear_residual_increment -= nonlinear_residual;
+
+  linear_residual_increment -= linear_residual;
+}
+
+
+
+template <int dim>
+double GradientCrystalPlasticitySolver<dim>::assemble_line_search_residual(
+  const double relaxation_parameter)
+{
+  if (parameters.flag_fused_history_update)
+    store_trial_interface_damage_variables();
+
+  if (parameters.verbose)
+    *pcout << std::setw(38) << std::left
+           << "  Solver: Assembling residual...";
+
+  dealii::TimerOutput::Scope  t(*timer_output,
+                                "Solver: Line search residual assembly");
+
+  // Set up local aliases
+  using CellIterator =
+    typename dealii::DoFHandler<dim>::active_cell_iterator;
+
+  const dealii::AffineConstraints<double> &newton_method_constraints =
+    fe_field->get_newton_method_constraints();
+
+  // Reset data
+  residual = 0.0;
+
+  const bool flag_update_quadrature_point_history =
+    parameters.flag_fused_history_update;
+
+  // Set up the lambda function for the local assembly operation
+  auto worker = [this, flag_update_quadrature_point_history](
+    const CellIterator                         &cell,
+    gCP::AssemblyData::Residual::Scratch<dim>  &scratch,
+    gCP::AssemblyData::Residual::Copy          &data)
+  {
+    this->assemble_local_residual(cell,
+                                  scratch,
+                                  data,
+                                  true,
+                                  flag_update_quadrature_point_history);
+  };
+
+  // Set up the lambda function for the copy local to global operation
+  auto copier = [this, &newton_method_constraints](
+    const gCP::AssemblyData::Residual::Copy  &data)
+  {
+    newton_method_constraints.distribute_local_to_global(
+      data.local_rhs,
+      data.local_dof_indices,
+      residual);
+  };
+
+  // Define the update flags for the FEValues instances. The
+  // sum-factorized kernels only need the mapping data
+  const dealii::UpdateFlags update_flags  =
+    parameters.flag_sum_factorization ?
+      (dealii::update_JxW_values |
+       dealii::update_inverse_jacobians |
+       dealii::update_quadrature_points) :
+      (dealii::update_JxW_values |
+       dealii::update_values |
+       dealii::update_gradients |
+       dealii::update_quadrature_points);
+
+  const dealii::UpdateFlags face_update_flags  =
+    dealii::update_JxW_values |
+    dealii::update_normal_vectors |
+    dealii::update_values |
+    dealii::update_quadrature_points;
+
+  gCP::AssemblyData::Residual::Scratch<dim> scratch(
+    mapping_collection,
+    quadrature_collection,
+    face_quadrature_collection,
+    fe_field->get_fe_collection(),
+    update_flags,
+    face_update_flags,
+    crystals_data->get_n_slips());
+
+  scratch.flag_sum_factorization = parameters.flag_sum_factorization;
+
+  const gCP::AssemblyData::Residual::Copy copy(
+    fe_field->get_fe_collection().max_dofs_per_cell());
+
+  // Assemble using the WorkStream approach. The sum-factorized kernels
+  // run over cell batches
+  if (parameters.flag_sum_factorization)
+  {
+    auto batch_worker = [this, flag_update_quadrature_point_history](
+      const CellBatchIterator                                     &cell_batch,
+      gCP::AssemblyData::Residual::Scratch<dim>                   &scratch,
+      gCP::AssemblyData::CellBatchCopy<
+        gCP::AssemblyData::Residual::Copy>                        &data)
+    {
+      this->assemble_local_residual(*cell_batch,
+                                    scratch,
+                                    data,
+                                    true,
+                                    flag_update_quadrature_point_history);
+    };
+
+    auto batch_copier = [&copier](
+      const gCP::AssemblyData::CellBatchCopy<
+        gCP::AssemblyData::Residual::Copy>  &data)
+    {
+      for (unsigned int lane = 0; lane < data.n_cells; ++lane)
+        copier(data.cell_copies[lane]);
+    };
+
+    run_work_stream(
+      cell_batches,
+      colored_cell_batches,
+      "line search residual assembly",
+      batch_worker,
+      batch_copier,
+      scratch,
+      gCP::AssemblyData::CellBatchCopy<
+        gCP::AssemblyData::Residual::Copy>(copy));
+  }
+  else
+    run_work_stream(
+      fe_field->get_dof_handler(),
+      colored_cells,
+      "line search residual assembly",
+      worker,
+      copier,
+      scratch,
+      copy);
+
+  // Compress global data
+  residual.compress(dealii::VectorOperation::add);
+
+  // Add the affine contributions
+  residual.add(1.0,
+               linear_residual,
+               relaxation_parameter,
+               linear_residual_increment);
+
+  residual_norm = residual.l2_norm();
+
+  ghost_residual = residual;
+
+  if (parameters.verbose)
+    *pcout << " done!" << std::endl;
+
+  return (0.5 * residual_norm * residual_norm);
+}
+
+
+
+template <int dim>
+double GradientCrystalPlasticitySolver<dim>::assemble_linear_system()
+{
+  store_trial_interface_damage_variables();
+
+  if (parameters.verbose)
+    *pcout << std::setw(38) << std::left
+           << "  Solver: Assembling linear system...";
+
+  dealii::TimerOutput::Scope  t(*timer_output,
+                                "Solver: Linear system assembly");
+
+  // Set up local aliases
+  using CellIterator =
+    typename dealii::DoFHandler<dim>::active_cell_iterator;
+
+  // Reset data
+  jacobian = 0.0;
+
+  residual = 0.0;
+
+  if (parameters.line_search_parameters.flag_reuse_linear_contributions)
+    nonlinear_residual = 0.0;
+
+  // Set up the lambda function for the local assembly operation
+  auto worker = [this](
+    const CellIterator                             &cell,
+    gCP::AssemblyData::LinearSystem::Scratch<dim>  &scratch,
+    gCP::AssemblyData::LinearSystem::Copy          &data)
+  {
+    this->assemble_local_linear_system(cell, scratch, data);
+  };
+
+  // Set up the lambda function for the copy local to global operation
+  auto copier = [this](const gCP::AssemblyData::LinearSystem::Copy &data)
+  {
+    this->copy_local_to_global_residual(data.residual_copy);
+
+    this->copy_local_to_global_jacobian(data.jacobian_copy);
+  };
+
+  // Define the update flags for the FEValues instances
+  const dealii::UpdateFlags update_flags =
+    dealii::update_JxW_values |
+    dealii::update_values |
+    dealii::update_gradients |
+    dealii::update_quadrature_points;
+
+  const dealii::UpdateFlags face_update_flags =
+    dealii::update_JxW_values |
+    dealii::update_normal_vectors |
+    dealii::update_values |
+    dealii::update_quadrature_points;
+
+  // Assemble using the WorkStream approach
+  run_work_stream(
+    fe_field->get_dof_handler(),
+    colored_cells,
+    "linear system assembly",
+    worker,
+    copier,
+    gCP::AssemblyData::LinearSystem::Scratch<dim>(
+      mapping_collection,
+      quadrature_collection,
+      face_quadrature_collection,
+      fe_field->get_fe_collection(),
+      update_flags,
+      face_update_flags,
+      crystals_data->get_n_slips()),
+    gCP::AssemblyData::LinearSystem::Copy(
+      fe_field->get_fe_collection().max_dofs_per_cell()));
+
+  // Compress global data
+  jacobian.compress(dealii::VectorOperation::add);
+
+  // The preconditioner has to be rebuilt from the new Jacobian
+  flag_refresh_preconditioner = true;
+
+  residual.compress(dealii::VectorOperation::add);
+
+  if (parameters.line_search_parameters.flag_reuse_linear_contributions)
+    nonlinear_residual.compress(dealii::VectorOperation::add);
+
+  residual_norm = residual.l2_norm();
+
+  ghost_residual = residual;
+
+  if (parameters.verbose)
+    *pcout << " done!" << std::endl;
+
+  return (0.5 * residual_norm * residual_norm);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::assemble_local_linear_system(
+  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+  gCP::AssemblyData::LinearSystem::Scratch<dim>                 &scratch,
+  gCP::AssemblyData::LinearSystem::Copy                         &data)
+{
+  gCP::AssemblyData::Residual::Scratch<dim> &residual_scratch =
+    scratch.residual_scratch;
+
+  gCP::AssemblyData::Jacobian::Scratch<dim> &jacobian_scratch =
+    scratch.jacobian_scratch;
+
+  // Update the hp::FEValues instance to the values of the current cell.
+  // It is shared by both local operations
+  residual_scratch.hp_fe_values.reinit(cell);
+
+  const dealii::FEValues<dim> &fe_values =
+    residual_scratch.hp_fe_values.get_present_fe_values();
+
+  // Get the slips and their gradients values at the quadrature points
+  evaluate_local_slips(cell,
+                       fe_values,
+                       trial_solution,
+                       residual_scratch.local_dof_values,
+                       residual_scratch.slip_values,
+                       &residual_scratch.slip_gradient_values);
+
+  evaluate_local_slips(cell,
+                       fe_values,
+                       fe_field->old_solution,
+                       residual_scratch.local_dof_values,
+                       residual_scratch.old_slip_values);
+
+  jacobian_scratch.slip_values          = residual_scratch.slip_values;
+
+  jacobian_scratch.old_slip_values      = residual_scratch.old_slip_values;
+
+  jacobian_scratch.slip_gradient_values = residual_scratch.slip_gradient_values;
+
+  // Update the slip resistances at the quadrature points. The residual
+  // and the Jacobian of the cell only depend on its own values
+  for (const unsigned int q_point : fe_values.quadrature_point_indices())
+    quadrature_point_history.update_values(
+      cell->active_cell_index(),
+      q_point,
+      residual_scratch.slip_values,
+      residual_scratch.old_slip_values);
+
+  // The residual also updates the interface quadrature point history,
+  // whose values computed for the grain boundary faces of the cell
+  // are passed on to the Jacobian
+  assemble_local_residual(cell,
+                          fe_values,
+                          residual_scratch,
+                          data.residual_copy,
+                          false,
+                          true);
+
+  assemble_local_jacobian(
+    cell,
+    fe_values,
+    jacobian_scratch,
+    data.jacobian_copy,
+    fe_field->is_decohesion_allowed() ?
+      &residual_scratch.interface_quadrature_point_history :
+      nullptr);
 }
 
 
@@ -1062,49 +2378,54 @@ void GradientCrystalPlasticitySolver<dim>::copy_local_to_global_residual(
 template <int dim>
 void GradientCrystalPlasticitySolver<dim>::prepare_quadrature_point_history()
 {
-  const unsigned int n_q_points =
-    quadrature_collection.max_n_quadrature_points();
+  dealii::TimerOutput::Scope  t(*timer_output,
+                                "Solver: Prepare quadrature point history");
+
+  quadrature_point_history.store_current_values();
+
+  if (!fe_field->is_decohesion_allowed())
+    return;
 
   const unsigned int n_face_q_points =
     face_quadrature_collection.max_n_quadrature_points();
 
-  for (const auto &cell : fe_field->get_triangulation().active_cell_iterators())
-    if (cell->is_locally_owned())
+  // Loop over the faces at the grain boundaries in parallel. Each face
+  // is visited once, even if it is shared by two locally owned cells
+  dealii::parallel::apply_to_subranges(
+    0U,
+    interface_quadrature_point_history.n_faces(),
+    [this, n_face_q_points](const unsigned int begin,
+                            const unsigned int end)
     {
-      const std::vector<std::shared_ptr<QuadraturePointHistory<dim>>>
-        local_quadrature_point_history =
-          quadrature_point_history.get_data(cell);
-
-      Assert(local_quadrature_point_history.size() == n_q_points,
-              dealii::ExcInternalError());
-
-      for (unsigned int q_point = 0;
-            q_point < n_q_points;
-            ++q_point)
-        local_quadrature_point_history[q_point]->store_current_values();
-
-      if (cell_is_at_grain_boundary(cell->active_cell_index()) &&
-          fe_field->is_decohesion_allowed())
-        for (const auto &face_index : cell->face_indices())
-          if (!cell->face(face_index)->at_boundary() &&
-              cell->material_id() !=
-                cell->neighbor(face_index)->material_id())
-          {
-            const std::vector<std::shared_ptr<InterfaceQuadraturePointHistory<dim>>>
-              local_interface_quadrature_point_history =
-                interface_quadrature_point_history.get_data(
-                  cell->id(),
-                  cell->neighbor(face_index)->id());
+      for (unsigned int face_id = begin; face_id < end; ++face_id)
+      {
+        const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+          local_interface_quadrature_point_history =
+            interface_quadrature_point_history.get_data(face_id);
 
-            Assert(local_interface_quadrature_point_history.size() ==
-                     n_face_q_points,
-                   dealii::ExcInternalError());
+        Assert(local_interface_quadrature_point_history.size() ==
+                 n_face_q_points,
+               dealii::ExcInternalError());
 
-            for (unsigned int face_q_point = 0;
-                  face_q_point < n_face_q_points; ++face_q_point)
-              local_interface_quadrature_point_history[face_q_point]->store_current_values();
-          }
-    }
+        for (unsigned int face_q_point = 0;
+              face_q_point < n_face_q_points; ++face_q_point)
+        {
+          set_committed_interface_values(
+            face_id,
+            face_q_point,
+            local_interface_quadrature_point_history[face_q_point].
+              get_values_to_commit(
+                get_committed_interface_values(face_id, face_q_point)));
+
+          // The trial values start from the stored, i.e., possibly
+          // rounded, committed values
+          local_interface_quadrature_point_history[face_q_point].
+            reset_values(
+              get_committed_interface_values(face_id, face_q_point));
+        }
+      }
+    },
+    /* grainsize */ 64);
 }
 
 
@@ -1112,74 +2433,56 @@ void GradientCrystalPlasticitySolver<dim>::prepare_quadrature_point_history()
 template <int dim>
 void GradientCrystalPlasticitySolver<dim>::reset_quadrature_point_history()
 {
-  const unsigned int n_quadrature_points =
-    quadrature_collection.max_n_quadrature_points();
+  dealii::TimerOutput::Scope  t(*timer_output,
+                                "Solver: Reset quadrature point history");
+
+  quadrature_point_history.reset_values();
+
+  if (!fe_field->is_decohesion_allowed())
+    return;
 
   const unsigned int n_face_quadrature_points =
     face_quadrature_collection.max_n_quadrature_points();
 
-  for (const auto &active_cell :
-       fe_field->get_triangulation().active_cell_iterators())
-  {
-    if (active_cell->is_locally_owned())
+  // Loop over the faces at the grain boundaries in parallel. Each face
+  // is visited once, even if it is shared by two locally owned cells
+  dealii::parallel::apply_to_subranges(
+    0U,
+    interface_quadrature_point_history.n_faces(),
+    [this, n_face_quadrature_points](const unsigned int begin,
+                                     const unsigned int end)
     {
-      const std::vector<std::shared_ptr<QuadraturePointHistory<dim>>>
-        local_quadrature_point_history =
-          quadrature_point_history.get_data(active_cell);
-
-      Assert(local_quadrature_point_history.size() ==
-              n_quadrature_points,
-             dealii::ExcInternalError());
-
-      for (unsigned int quadrature_point = 0;
-           quadrature_point < n_quadrature_points;
-           ++quadrature_point)
+      for (unsigned int face_id = begin; face_id < end; ++face_id)
       {
-        local_quadrature_point_history[quadrature_point]->
-          reset_values();
-      }
+        const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+          local_interface_quadrature_point_history =
+            interface_quadrature_point_history.get_data(face_id);
 
-      if (cell_is_at_grain_boundary(active_cell->active_cell_index()) &&
-          fe_field->is_decohesion_allowed())
-      {
-        for (const auto &face_index : active_cell->face_indices())
+        Assert(local_interface_quadrature_point_history.size() ==
+                 n_face_quadrature_points,
+               dealii::ExcInternalError());
+
+        for (unsigned int face_quadrature_point = 0;
+             face_quadrature_point < n_face_quadrature_points;
+             ++face_quadrature_point)
         {
-          if (!active_cell->face(face_index)->at_boundary() &&
-              active_cell->material_id() !=
-                active_cell->neighbor(face_index)->material_id())
-          {
-            const std::vector<std::shared_ptr<
-              InterfaceQuadraturePointHistory<dim>>>
-                local_interface_quadrature_point_history =
-                  interface_quadrature_point_history.get_data(
-                    active_cell->id(),
-                    active_cell->neighbor(face_index)->id());
-
-            Assert(local_interface_quadrature_point_history.size() ==
-                     n_face_quadrature_points,
-                   dealii::ExcInternalError());
-
-            for (unsigned int face_quadrature_point = 0;
-                 face_quadrature_point < n_face_quadrature_points;
-                 ++face_quadrature_point)
-            {
-              local_interface_quadrature_point_history[face_quadrature_point]->
-                reset_values();
-            }
-          }
+          local_interface_quadrature_point_history[face_quadrature_point].
+            reset_values(
+              get_committed_interface_values(face_id,
+                                             face_quadrature_point));
         }
       }
-    }
-  }
+    },
+    /* grainsize */ 64);
 }
 
 
 
 template <int dim>
-void GradientCrystalPlasticitySolver<dim>::reset_and_update_quadrature_point_history()
+void GradientCrystalPlasticitySolver<dim>::commit_quadrature_point_history()
 {
   dealii::TimerOutput::Scope  t(*timer_output,
-                                "Solver: Reset and update quadrature point history");
+                                "Solver: Commit quadrature point history");
 
   // Set up local aliases
   using CellIterator =
@@ -1189,13 +2492,42 @@ void GradientCrystalPlasticitySolver<dim>::reset_and_update_quadrature_point_his
     dealii::FilteredIterator<
       typename dealii::DoFHandler<dim>::active_cell_iterator>;
 
-  // Set up the lambda function for the local assembly operation
+  // Set up the lambda function for the local operation. Each cell
+  // writes only its own entries of the storage
   auto worker = [this](
     const CellIterator                                      &cell,
     gCP::AssemblyData::QuadraturePointHistory::Scratch<dim> &scratch,
-    gCP::AssemblyData::QuadraturePointHistory::Copy         &data)
+    gCP::AssemblyData::QuadraturePointHistory::Copy         &)
   {
-    this->update_local_quadrature_point_history(cell, scratch, data);
+    // Reset local data
+    scratch.reset();
+
+    // Update the hp::FEValues instance to the values of the current cell
+    scratch.hp_fe_values.reinit(cell);
+
+    const dealii::FEValues<dim> &fe_values =
+      scratch.hp_fe_values.get_present_fe_values();
+
+    // Get the slip values at the quadrature points
+    evaluate_local_slips(cell,
+                         fe_values,
+                         trial_solution,
+                         scratch.local_dof_values,
+                         scratch.slips_values);
+
+    evaluate_local_slips(cell,
+                         fe_values,
+                         fe_field->old_solution,
+                         scratch.local_dof_values,
+                         scratch.old_slips_values);
+
+    // Loop over quadrature points
+    for (const unsigned int q_point : fe_values.quadrature_point_indices())
+      quadrature_point_history.commit_values(
+        cell->active_cell_index(),
+        q_point,
+        scratch.slips_values,
+        scratch.old_slips_values);
   };
 
   // Set up the lambda function for the copy local to global operation
@@ -1209,10 +2541,9 @@ void GradientCrystalPlasticitySolver<dim>::reset_and_update_quadrature_point_his
     dealii::update_values;
 
   const dealii::UpdateFlags face_update_flags  =
-    dealii::update_values |
-    dealii::update_normal_vectors;
+    dealii::update_default;
 
-  // Assemble using the WorkStream approach
+  // Commit using the WorkStream approach
   dealii::WorkStream::run(
     CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
                fe_field->get_dof_handler().begin_active()),
@@ -1233,276 +2564,419 @@ void GradientCrystalPlasticitySolver<dim>::reset_and_update_quadrature_point_his
 
 
 
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::reset_and_update_quadrature_point_history()
+{
+  dealii::TimerOutput::Scope  t(*timer_output,
+                                "Solver: Reset and update quadrature point history");
+
+  // Set up local aliases
+  using CellIterator =
+    typename dealii::DoFHandler<dim>::active_cell_iterator;
+
+  using CellFilter =
+    dealii::FilteredIterator<
+      typename dealii::DoFHandler<dim>::active_cell_iterator>;
+
+  // Define the update flags for the FEValues instances
+  const dealii::UpdateFlags update_flags  =
+    dealii::update_values;
+
+  const dealii::UpdateFlags face_update_flags  =
+    dealii::update_values |
+    dealii::update_normal_vectors;
+
+  const gCP::AssemblyData::QuadraturePointHistory::Scratch<dim> sample_scratch(
+    mapping_collection,
+    quadrature_collection,
+    face_quadrature_collection,
+    fe_field->get_fe_collection(),
+    update_flags,
+    face_update_flags,
+    crystals_data->get_n_slips());
+
+  // Set up the lambda function for the local assembly operation
+  auto worker = [this](
+    const CellIterator                                      &cell,
+    gCP::AssemblyData::QuadraturePointHistory::Scratch<dim> &scratch,
+    gCP::AssemblyData::QuadraturePointHistory::Copy         &data)
+  {
+    this->update_local_quadrature_point_history(cell, scratch, data);
+  };
+
+  // Set up the lambda function for the copy local to global operation
+  auto copier = [this](const gCP::AssemblyData::QuadraturePointHistory::Copy  &data)
+  {
+    this->copy_local_to_global_quadrature_point_history(data);
+  };
+
+  // Assemble using the WorkStream approach
+  dealii::WorkStream::run(
+    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
+               fe_field->get_dof_handler().begin_active()),
+    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
+               fe_field->get_dof_handler().end()),
+    worker,
+    copier,
+    sample_scratch,
+    gCP::AssemblyData::QuadraturePointHistory::Copy());
+
+  if (!fe_field->is_decohesion_allowed())
+    return;
+
+  // The interface quadrature point history is updated once per
+  // grain boundary face, i.e., independently of whether one or both
+  // of its cells are locally owned. The faces are independent of each
+  // other and are therefore processed in parallel, each subrange with
+  // its own scratch data
+  dealii::parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(interface_grain_boundary_faces.size()),
+    [this, &sample_scratch](const unsigned int begin, const unsigned int end)
+    {
+      gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>
+        scratch(sample_scratch);
+
+      for (unsigned int interface_id = begin;
+           interface_id < end;
+           ++interface_id)
+        update_local_interface_quadrature_point_history(
+          grain_boundary_faces[interface_grain_boundary_faces[interface_id]],
+          scratch);
+    },
+    16);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::
+update_local_quadrature_point_history(
+  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+  gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>       &scratch,
+  gCP::AssemblyData::QuadraturePointHistory::Copy               &)
+{
+  // Reset local data
+  scratch.reset();
+
+  // Update the hp::FEValues instance to the values of the current cell
+  scratch.hp_fe_values.reinit(cell);
+
+  const dealii::FEValues<dim> &fe_values =
+    scratch.hp_fe_values.get_present_fe_values();
+
+  // Get the slip values at the quadrature points
+  evaluate_local_slips(cell,
+                       fe_values,
+                       trial_solution,
+                       scratch.local_dof_values,
+                       scratch.slips_values);
+
+  evaluate_local_slips(cell,
+                       fe_values,
+                       fe_field->old_solution,
+                       scratch.local_dof_values,
+                       scratch.old_slips_values);
+
+  // Loop over quadrature points
+  for (const unsigned int q_point : fe_values.quadrature_point_indices())
+  {
+    quadrature_point_history.update_values(
+      cell->active_cell_index(),
+      q_point,
+      scratch.slips_values,
+      scratch.old_slips_values);
+  } // Loop over quadrature points
+}
+
+
+
 template <int dim>
 void GradientCrystalPlasticitySolver<dim>::
-update_local_quadrature_point_history(
-  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
-  gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>       &scratch,
-  gCP::AssemblyData::QuadraturePointHistory::Copy               &)
+update_local_interface_quadrature_point_history(
+  const GrainBoundaryFace                                   &grain_boundary_face,
+  gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>   &scratch)
 {
+  const typename dealii::DoFHandler<dim>::active_cell_iterator &cell =
+    grain_boundary_face.cell;
+
   // Get the crystal identifier for the current cell
   const unsigned int crystal_id = cell->material_id();
 
+  // Reset local data
+  scratch.reset();
+
+  // Get the crystal identifier for the neighbor cell
+  const unsigned int neighbor_crystal_id =
+    grain_boundary_face.neighbour_crystal_id;
+
   // Get the local quadrature point history instance
-  const std::vector<std::shared_ptr<QuadraturePointHistory<dim>>>
-    local_quadrature_point_history =
-      quadrature_point_history.get_data(cell);
+  const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+    local_interface_quadrature_point_history =
+      interface_quadrature_point_history.get_data(
+        grain_boundary_face.interface_id);
 
-  Assert(local_quadrature_point_history.size() == scratch.n_q_points,
+  Assert(local_interface_quadrature_point_history.size() ==
+           scratch.n_face_q_points,
          dealii::ExcInternalError());
 
-  // Update the hp::FEValues instance to the values of the current cell
-  scratch.hp_fe_values.reinit(cell);
+  // Update the hp::FEFaceValues instance to the values of the
+  // current face
+  scratch.hp_fe_face_values.reinit(cell, grain_boundary_face.face_index);
 
-  const dealii::FEValues<dim> &fe_values =
-    scratch.hp_fe_values.get_present_fe_values();
+  const dealii::FEFaceValues<dim> &fe_face_values =
+    scratch.hp_fe_face_values.get_present_fe_values();
 
-  // Reset local data
-  scratch.reset();
+  // Update the hp::FEFaceValues instance to the values of the
+  // neighbor face
+  scratch.neighbor_hp_fe_face_values.reinit(
+    grain_boundary_face.neighbour_cell,
+    grain_boundary_face.neighbour_face_index);
 
-  // Get the slip values at the quadrature points
+  const dealii::FEFaceValues<dim> &neighbor_fe_face_values =
+    scratch.neighbor_hp_fe_face_values.get_present_fe_values();
+
+  // Get the displacement values
+  fe_face_values[
+    fe_field->get_displacement_extractor(crystal_id)].get_function_values(
+    trial_solution,
+    scratch.current_cell_displacement_values);
+
+  neighbor_fe_face_values[
+    fe_field->get_displacement_extractor(neighbor_crystal_id)].get_function_values(
+    trial_solution,
+    scratch.neighbor_cell_displacement_values);
+
+  // Get plastic slips
   for (unsigned int slip_id = 0;
-       slip_id < fe_field->get_n_slips();
-       ++slip_id)
+       slip_id < crystals_data->get_n_slips(); ++slip_id)
   {
-    fe_values[
-      fe_field->get_slip_extractor(crystal_id,
-                                   slip_id)].get_function_values(
-      trial_solution,
-      scratch.slips_values[slip_id]);
+    fe_face_values[fe_field->get_slip_extractor(
+        crystal_id, slip_id)].get_function_values(
+          trial_solution,
+          scratch.face_slip_values[slip_id]);
 
-    fe_values[
-      fe_field->get_slip_extractor(crystal_id,
-                                   slip_id)].get_function_values(
-      fe_field->old_solution,
-      scratch.old_slips_values[slip_id]);
+    neighbor_fe_face_values[fe_field->get_slip_extractor(
+        neighbor_crystal_id, slip_id)].get_function_values(
+          trial_solution,
+          scratch.neighbor_face_slip_values[slip_id]);
   }
 
-  // Loop over quadrature points
-  for (const unsigned int q_point : fe_values.quadrature_point_indices())
-  {
-    local_quadrature_point_history[q_point]->update_values(
-      q_point,
-      scratch.slips_values,
-      scratch.old_slips_values);
-  } // Loop over quadrature points
+  // Get normal vector values values at the quadrature points
+  scratch.normal_vector_values =
+    fe_face_values.get_normal_vectors();
+
+  update_interface_quadrature_point_history(
+    grain_boundary_face,
+    scratch.current_cell_displacement_values,
+    scratch.neighbor_cell_displacement_values,
+    scratch.normal_vector_values,
+    scratch.face_slip_values,
+    scratch.neighbor_face_slip_values,
+    local_interface_quadrature_point_history);
+}
 
-  if (cell_is_at_grain_boundary(cell->active_cell_index()) &&
-      fe_field->is_decohesion_allowed())
-    for (const auto &face_index : cell->face_indices())
-      if (!cell->face(face_index)->at_boundary() &&
-          cell->material_id() !=
-            cell->neighbor(face_index)->material_id())
-      {
-        // Get the crystal identifier for the neighbor cell
-        const unsigned int neighbor_crystal_id =
-          cell->neighbor(face_index)->material_id();
 
-        // Get the local quadrature point history instance
-        const std::vector<std::shared_ptr<InterfaceQuadraturePointHistory<dim>>>
-          local_interface_quadrature_point_history =
-            interface_quadrature_point_history.get_data(
-              cell->id(),
-              cell->neighbor(face_index)->id());
 
-        Assert(local_interface_quadrature_point_history.size() ==
-                 scratch.n_face_q_points,
-               dealii::ExcInternalError());
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::
+update_interface_quadrature_point_history(
+  const GrainBoundaryFace                   &grain_boundary_face,
+  const std::vector<dealii::Tensor<1,dim>>  &current_cell_displacement_values,
+  const std::vector<dealii::Tensor<1,dim>>  &neighbor_cell_displacement_values,
+  const std::vector<dealii::Tensor<1,dim>>  &normal_vector_values,
+  const std::vector<std::vector<double>>    &face_slip_values,
+  const std::vector<std::vector<double>>    &neighbor_face_slip_values,
+  const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+    &local_interface_quadrature_point_history) const
+{
+  // Get the crystal identifiers of the cells of the face
+  const unsigned int crystal_id = grain_boundary_face.cell->material_id();
 
-        // Update the hp::FEFaceValues instance to the values of the
-        // current face
-        scratch.hp_fe_face_values.reinit(cell, face_index);
+  const unsigned int neighbor_crystal_id =
+    grain_boundary_face.neighbour_crystal_id;
 
-        const dealii::FEFaceValues<dim> &fe_face_values =
-          scratch.hp_fe_face_values.get_present_fe_values();
+  for (unsigned int face_q_point = 0;
+       face_q_point < local_interface_quadrature_point_history.size();
+       ++face_q_point)
+  {
+    // The trial values are always evolved from the committed ones
+    const typename InterfaceQuadraturePointHistory<dim>::CommittedValues
+      committed_values =
+        get_committed_interface_values(
+          grain_boundary_face.interface_id, face_q_point);
 
-        // Update the hp::FEFaceValues instance to the values of the
-        // neighbor face
-        scratch.neighbor_hp_fe_face_values.reinit(
-          cell->neighbor(face_index),
-          cell->neighbor_of_neighbor(face_index));
+    switch (temporal_discretization_parameters.loading_type)
+    {
+      case RunTimeParameters::LoadingType::Monotonic:
+        {
+          local_interface_quadrature_point_history[face_q_point].update_values(
+            neighbor_cell_displacement_values[face_q_point],
+            current_cell_displacement_values[face_q_point],
+            committed_values,
+            *cohesive_law);
+        }
+        break;
 
-        const dealii::FEFaceValues<dim> &neighbor_fe_face_values =
-          scratch.neighbor_hp_fe_face_values.get_present_fe_values();
+      case RunTimeParameters::LoadingType::Cyclic:
+        {
+          const double effective_opening_displacement =
+            cohesive_law->get_effective_opening_displacement(
+              neighbor_cell_displacement_values[face_q_point] -
+              current_cell_displacement_values[face_q_point],
+              normal_vector_values[face_q_point]);
+
+          const double thermodynamic_force =
+            - cohesive_law->get_degradation_function_derivative_value(
+                local_interface_quadrature_point_history[face_q_point].get_damage_variable(), true) *
+            (cohesive_law->get_free_energy_density(
+              effective_opening_displacement)
+             +
+             microscopic_traction_law->get_free_energy_density(
+              neighbor_crystal_id,
+              crystal_id,
+              face_q_point,
+              normal_vector_values,
+              neighbor_face_slip_values,
+              face_slip_values));
 
-        // Get the displacement values
-        fe_face_values[
-          fe_field->get_displacement_extractor(crystal_id)].get_function_values(
-          trial_solution,
-          scratch.current_cell_displacement_values);
+          const bool flag_currently_in_the_preloading_phase =
+            discrete_time.get_next_time() <=
+              temporal_discretization_parameters.start_of_loading_phase;
 
-        neighbor_fe_face_values[
-          fe_field->get_displacement_extractor(neighbor_crystal_id)].get_function_values(
-          trial_solution,
-          scratch.neighbor_cell_displacement_values);
+          const bool flag_no_damage_evolution =
+            parameters.flag_zero_damage_during_loading_and_unloading &&
+              flag_currently_in_the_preloading_phase;
 
-        // Get plastic slips
-        for (unsigned int slip_id = 0;
-             slip_id < crystals_data->get_n_slips(); ++slip_id)
-        {
-          fe_face_values[fe_field->get_slip_extractor(
-              crystal_id, slip_id)].get_function_values(
-                trial_solution,
-                scratch.face_slip_values[slip_id]);
-
-          neighbor_fe_face_values[fe_field->get_slip_extractor(
-              neighbor_crystal_id, slip_id)].get_function_values(
-                trial_solution,
-                scratch.neighbor_face_slip_values[slip_id]);
+          if (!flag_no_damage_evolution)
+          {
+            local_interface_quadrature_point_history[face_q_point].update_values(
+              effective_opening_displacement,
+              thermodynamic_force,
+              committed_values,
+              *cohesive_law);
+          }
+          else
+          {
+            local_interface_quadrature_point_history[face_q_point].update_values(
+              effective_opening_displacement,
+              committed_values);
+          }
         }
+        break;
 
-        // Get normal vector values values at the quadrature points
-        scratch.normal_vector_values =
-          fe_face_values.get_normal_vectors();
-
-        for (unsigned int face_q_point = 0;
-             face_q_point < scratch.n_face_q_points; ++face_q_point)
+      case RunTimeParameters::LoadingType::CyclicWithUnloading:
         {
-          switch (temporal_discretization_parameters.loading_type)
-          {
-            case RunTimeParameters::LoadingType::Monotonic:
-              {
-                local_interface_quadrature_point_history[face_q_point]->update_values(
-                  scratch.neighbor_cell_displacement_values[face_q_point],
-                  scratch.current_cell_displacement_values[face_q_point]);
-              }
-              break;
+          const double effective_opening_displacement =
+            cohesive_law->get_effective_opening_displacement(
+              neighbor_cell_displacement_values[face_q_point] -
+              current_cell_displacement_values[face_q_point],
+              normal_vector_values[face_q_point]);
+
+          const double thermodynamic_force =
+            - cohesive_law->get_degradation_function_derivative_value(
+                local_interface_quadrature_point_history[face_q_point].get_damage_variable(), true) *
+            (cohesive_law->get_free_energy_density(
+              effective_opening_displacement)
+             +
+             microscopic_traction_law->get_free_energy_density(
+              neighbor_crystal_id,
+              crystal_id,
+              face_q_point,
+              normal_vector_values,
+              neighbor_face_slip_values,
+              face_slip_values));
 
-            case RunTimeParameters::LoadingType::Cyclic:
-              {
-                scratch.effective_opening_displacement[face_q_point] =
-                  cohesive_law->get_effective_opening_displacement(
-                    scratch.neighbor_cell_displacement_values[face_q_point] -
-                    scratch.current_cell_displacement_values[face_q_point],
-                    scratch.normal_vector_values[face_q_point]);
-
-                scratch.thermodynamic_force_values[face_q_point] =
-                  - cohesive_law->get_degradation_function_derivative_value(
-                      local_interface_quadrature_point_history[face_q_point]->get_damage_variable(), true) *
-                  (cohesive_law->get_free_energy_density(
-                    scratch.effective_opening_displacement[face_q_point])
-                   +
-                   microscopic_traction_law->get_free_energy_density(
-                    neighbor_crystal_id,
-                    crystal_id,
-                    face_q_point,
-                    scratch.normal_vector_values,
-                    scratch.neighbor_face_slip_values,
-                    scratch.face_slip_values));
-
-                const bool flag_currently_in_the_preloading_phase =
-                  discrete_time.get_next_time() <=
-                    temporal_discretization_parameters.start_of_loading_phase;
-
-                const bool flag_no_damage_evolution =
-                  parameters.flag_zero_damage_during_loading_and_unloading &&
-                    flag_currently_in_the_preloading_phase;
-
-                if (!flag_no_damage_evolution)
-                {
-                  local_interface_quadrature_point_history[face_q_point]->update_values(
-                    scratch.effective_opening_displacement[face_q_point],
-                    scratch.thermodynamic_force_values[face_q_point]);
-                }
-                else
-                {
-                  local_interface_quadrature_point_history[face_q_point]->update_values(
-                    scratch.effective_opening_displacement[face_q_point]);
-                }
-              }
-              break;
+          const bool flag_currently_in_the_preloading_phase =
+            discrete_time.get_next_time() <=
+              temporal_discretization_parameters.start_of_loading_phase;
 
-            case RunTimeParameters::LoadingType::CyclicWithUnloading:
-              {
-                scratch.effective_opening_displacement[face_q_point] =
-                  cohesive_law->get_effective_opening_displacement(
-                    scratch.neighbor_cell_displacement_values[face_q_point] -
-                    scratch.current_cell_displacement_values[face_q_point],
-                    scratch.normal_vector_values[face_q_point]);
-
-                scratch.thermodynamic_force_values[face_q_point] =
-                  - cohesive_law->get_degradation_function_derivative_value(
-                      local_interface_quadrature_point_history[face_q_point]->get_damage_variable(), true) *
-                  (cohesive_law->get_free_energy_density(
-                    scratch.effective_opening_displacement[face_q_point])
-                   +
-                   microscopic_traction_law->get_free_energy_density(
-                    neighbor_crystal_id,
-                    crystal_id,
-                    face_q_point,
-                    scratch.normal_vector_values,
-                    scratch.neighbor_face_slip_values,
-                    scratch.face_slip_values));
-
-                const bool flag_currently_in_the_preloading_phase =
-                  discrete_time.get_next_time() <=
-                    temporal_discretization_parameters.start_of_loading_phase;
-
-                const bool flag_currently_in_the_unloading_phase =
-                  discrete_time.get_next_time() >
-                    temporal_discretization_parameters.start_of_unloading_phase;
-
-                const bool contidion_A =
-                  parameters.flag_zero_damage_during_loading_and_unloading &&
-                  flag_currently_in_the_preloading_phase;
-
-                const bool condition_B =
-                  parameters.flag_zero_damage_during_loading_and_unloading &&
-                  flag_currently_in_the_unloading_phase;
-
-                if (contidion_A || condition_B)
-                {
-                  local_interface_quadrature_point_history[face_q_point]->update_values(
-                    scratch.effective_opening_displacement[face_q_point]);
-                }
-                else
-                {
-                  local_interface_quadrature_point_history[face_q_point]->update_values(
-                    scratch.effective_opening_displacement[face_q_point],
-                    scratch.thermodynamic_force_values[face_q_point]);
-                }
-              }
-              break;
+          const bool flag_currently_in_the_unloading_phase =
+            discrete_time.get_next_time() >
+              temporal_discretization_parameters.start_of_unloading_phase;
+
+          const bool contidion_A =
+            parameters.flag_zero_damage_during_loading_and_unloading &&
+            flag_currently_in_the_preloading_phase;
+
+          const bool condition_B =
+            parameters.flag_zero_damage_during_loading_and_unloading &&
+            flag_currently_in_the_unloading_phase;
 
-            default:
-              Assert(false, dealii::ExcNotImplemented());
-              break;
+          if (contidion_A || condition_B)
+          {
+            local_interface_quadrature_point_history[face_q_point].update_values(
+              effective_opening_displacement,
+              committed_values);
+          }
+          else
+          {
+            local_interface_quadrature_point_history[face_q_point].update_values(
+              effective_opening_displacement,
+              thermodynamic_force,
+              committed_values,
+              *cohesive_law);
           }
         }
-      }
+        break;
+
+      default:
+        Assert(false, dealii::ExcNotImplemented());
+        break;
+    }
+  }
 }
 
 
 
 template <int dim>
 void GradientCrystalPlasticitySolver<dim>::
-store_effective_opening_displacement_in_quadrature_history()
+store_trial_interface_damage_variables()
 {
-  dealii::TimerOutput::Scope
-    t(*timer_output, "Solver: Store effective opening displacement");
+  trial_interface_damage_variables.clear();
 
-  // Set up local aliases
-  using CellIterator =
-    typename dealii::DoFHandler<dim>::active_cell_iterator;
+  if (!fe_field->is_decohesion_allowed() ||
+      temporal_discretization_parameters.loading_type ==
+        RunTimeParameters::LoadingType::Monotonic)
+    return;
 
-  using CellFilter =
-    dealii::FilteredIterator<
-      typename dealii::DoFHandler<dim>::active_cell_iterator>;
+  const unsigned int n_face_q_points =
+    face_quadrature_collection.max_n_quadrature_points();
 
-  // Set up the lambda function for the local assembly operation
-  auto worker = [this](
-    const CellIterator                                      &cell,
-    gCP::AssemblyData::QuadraturePointHistory::Scratch<dim> &scratch,
-    gCP::AssemblyData::QuadraturePointHistory::Copy         &data)
-  {
-    this->store_local_effective_opening_displacement(cell, scratch, data);
-  };
+  trial_interface_damage_variables.resize(
+    interface_quadrature_point_history.n_faces() * n_face_q_points);
 
-  // Set up the lambda function for the copy local to global operation
-  auto copier = [this](const gCP::AssemblyData::QuadraturePointHistory::Copy  &data)
+  for (unsigned int interface_id = 0;
+       interface_id < interface_quadrature_point_history.n_faces();
+       ++interface_id)
   {
-    this->copy_local_to_global_quadrature_point_history(data);
-  };
+    const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+      local_interface_quadrature_point_history =
+        interface_quadrature_point_history.get_data(interface_id);
+
+    AssertDimension(local_interface_quadrature_point_history.size(),
+                    n_face_q_points);
+
+    for (unsigned int face_q_point = 0;
+         face_q_point < n_face_q_points; ++face_q_point)
+      trial_interface_damage_variables[
+        interface_id * n_face_q_points + face_q_point] =
+          local_interface_quadrature_point_history[face_q_point].
+            get_damage_variable();
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::
+store_effective_opening_displacement_in_quadrature_history()
+{
+  dealii::TimerOutput::Scope
+    t(*timer_output, "Solver: Store effective opening displacement");
+
+  if (!fe_field->is_decohesion_allowed())
+    return;
 
   // Define the update flags for the FEValues instances
   const dealii::UpdateFlags update_flags  =
@@ -1512,23 +2986,33 @@ store_effective_opening_displacement_in_quadrature_history()
     dealii::update_values |
     dealii::update_normal_vectors;
 
-  // Assemble using the WorkStream approach
-  dealii::WorkStream::run(
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               fe_field->get_dof_handler().begin_active()),
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               fe_field->get_dof_handler().end()),
-    worker,
-    copier,
-    gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>(
-      mapping_collection,
-      quadrature_collection,
-      face_quadrature_collection,
-      fe_field->get_fe_collection(),
-      update_flags,
-      face_update_flags,
-      crystals_data->get_n_slips()),
-    gCP::AssemblyData::QuadraturePointHistory::Copy());
+  const gCP::AssemblyData::QuadraturePointHistory::Scratch<dim> sample_scratch(
+    mapping_collection,
+    quadrature_collection,
+    face_quadrature_collection,
+    fe_field->get_fe_collection(),
+    update_flags,
+    face_update_flags,
+    crystals_data->get_n_slips());
+
+  // The values are stored once per grain boundary face, see
+  // reset_and_update_quadrature_point_history()
+  dealii::parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(interface_grain_boundary_faces.size()),
+    [this, &sample_scratch](const unsigned int begin, const unsigned int end)
+    {
+      gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>
+        scratch(sample_scratch);
+
+      for (unsigned int interface_id = begin;
+           interface_id < end;
+           ++interface_id)
+        store_local_effective_opening_displacement(
+          grain_boundary_faces[interface_grain_boundary_faces[interface_id]],
+          scratch);
+    },
+    16);
 }
 
 
@@ -1536,122 +3020,136 @@ store_effective_opening_displacement_in_quadrature_history()
 template <int dim>
 void GradientCrystalPlasticitySolver<dim>::
 store_local_effective_opening_displacement(
-  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
-  gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>       &scratch,
-  gCP::AssemblyData::QuadraturePointHistory::Copy               &)
+  const GrainBoundaryFace                                   &grain_boundary_face,
+  gCP::AssemblyData::QuadraturePointHistory::Scratch<dim>   &scratch)
 {
+  const typename dealii::DoFHandler<dim>::active_cell_iterator &cell =
+    grain_boundary_face.cell;
+
   // Get the crystal identifier for the current cell
   const unsigned int crystal_id = cell->material_id();
 
   // Reset local data
   scratch.reset();
 
-  if (cell_is_at_grain_boundary(cell->active_cell_index()) &&
-      fe_field->is_decohesion_allowed())
-    for (const auto &face_index : cell->face_indices())
-      if (!cell->face(face_index)->at_boundary() &&
-          cell->material_id() !=
-            cell->neighbor(face_index)->material_id())
-      {
-        // Get the crystal identifier for the neighbor cell
-        const unsigned int neighbor_crystal_id =
-          cell->neighbor(face_index)->material_id();
+  // Get the crystal identifier for the neighbor cell
+  const unsigned int neighbor_crystal_id =
+    grain_boundary_face.neighbour_crystal_id;
 
-        // Get the local quadrature point history instance
-        const std::vector<std::shared_ptr<InterfaceQuadraturePointHistory<dim>>>
-          local_interface_quadrature_point_history =
-            interface_quadrature_point_history.get_data(
-              cell->id(),
-              cell->neighbor(face_index)->id());
+  // Get the local quadrature point history instance
+  const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+    local_interface_quadrature_point_history =
+      interface_quadrature_point_history.get_data(
+        grain_boundary_face.interface_id);
 
-        Assert(local_interface_quadrature_point_history.size() ==
-                 scratch.n_face_q_points,
-               dealii::ExcInternalError());
+  Assert(local_interface_quadrature_point_history.size() ==
+           scratch.n_face_q_points,
+         dealii::ExcInternalError());
 
-        // Update the hp::FEFaceValues instance to the values of the
-        // current face
-        scratch.hp_fe_face_values.reinit(cell, face_index);
+  // Update the hp::FEFaceValues instance to the values of the
+  // current face
+  scratch.hp_fe_face_values.reinit(cell, grain_boundary_face.face_index);
 
-        const dealii::FEFaceValues<dim> &fe_face_values =
-          scratch.hp_fe_face_values.get_present_fe_values();
+  const dealii::FEFaceValues<dim> &fe_face_values =
+    scratch.hp_fe_face_values.get_present_fe_values();
 
-        // Update the hp::FEFaceValues instance to the values of the
-        // neighbor face
-        scratch.neighbor_hp_fe_face_values.reinit(
-          cell->neighbor(face_index),
-          cell->neighbor_of_neighbor(face_index));
+  // Update the hp::FEFaceValues instance to the values of the
+  // neighbor face
+  scratch.neighbor_hp_fe_face_values.reinit(
+    grain_boundary_face.neighbour_cell,
+    grain_boundary_face.neighbour_face_index);
 
-        const dealii::FEFaceValues<dim> &neighbor_fe_face_values =
-          scratch.neighbor_hp_fe_face_values.get_present_fe_values();
+  const dealii::FEFaceValues<dim> &neighbor_fe_face_values =
+    scratch.neighbor_hp_fe_face_values.get_present_fe_values();
 
-        // Get the displacement values
-        fe_face_values[
-          fe_field->get_displacement_extractor(crystal_id)].get_function_values(
-          trial_solution,
-          scratch.current_cell_displacement_values);
+  // Get the displacement values
+  fe_face_values[
+    fe_field->get_displacement_extractor(crystal_id)].get_function_values(
+    trial_solution,
+    scratch.current_cell_displacement_values);
 
-        fe_face_values[
-          fe_field->get_displacement_extractor(crystal_id)].get_function_values(
-          fe_field->old_solution,
-          scratch.current_cell_old_displacement_values);
+  fe_face_values[
+    fe_field->get_displacement_extractor(crystal_id)].get_function_values(
+    fe_field->old_solution,
+    scratch.current_cell_old_displacement_values);
 
-        neighbor_fe_face_values[
-          fe_field->get_displacement_extractor(neighbor_crystal_id)].get_function_values(
-          trial_solution,
-          scratch.neighbor_cell_displacement_values);
+  neighbor_fe_face_values[
+    fe_field->get_displacement_extractor(neighbor_crystal_id)].get_function_values(
+    trial_solution,
+    scratch.neighbor_cell_displacement_values);
 
-        neighbor_fe_face_values[
-          fe_field->get_displacement_extractor(neighbor_crystal_id)].get_function_values(
-          fe_field->old_solution,
-          scratch.neighbor_cell_old_displacement_values);
+  neighbor_fe_face_values[
+    fe_field->get_displacement_extractor(neighbor_crystal_id)].get_function_values(
+    fe_field->old_solution,
+    scratch.neighbor_cell_old_displacement_values);
 
-        // Get normal vector values values at the quadrature points
-        scratch.normal_vector_values =
-          fe_face_values.get_normal_vectors();
+  // Get normal vector values values at the quadrature points
+  scratch.normal_vector_values =
+    fe_face_values.get_normal_vectors();
 
-        for (unsigned int face_q_point = 0;
-             face_q_point < scratch.n_face_q_points; ++face_q_point)
-        {
-          scratch.cohesive_traction_values[face_q_point] =
-            cohesive_law->get_cohesive_traction(
-              scratch.neighbor_cell_displacement_values[face_q_point] -
-              scratch.current_cell_displacement_values[face_q_point],
-              scratch.normal_vector_values[face_q_point],
-              local_interface_quadrature_point_history[face_q_point]->
-                get_max_effective_opening_displacement(),
-              (scratch.neighbor_cell_old_displacement_values[face_q_point] -
-               scratch.current_cell_old_displacement_values[face_q_point]).norm(),
-              discrete_time.get_next_step_size());
-
-          local_interface_quadrature_point_history[face_q_point]->store_effective_opening_displacement(
-            scratch.neighbor_cell_displacement_values[face_q_point],
-            scratch.current_cell_displacement_values[face_q_point],
-            scratch.normal_vector_values[face_q_point],
-            (parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_macrotraction_to_damage ?
-              std::pow(1.0 - local_interface_quadrature_point_history[face_q_point]->get_damage_variable(),
-                        parameters.constitutive_laws_parameters.cohesive_law_parameters.degradation_exponent) :
-              1.0 ) *
-            scratch.cohesive_traction_values[face_q_point].norm());
-
-          if (false/*print_out*/)
-          {
-            table_handler.add_value(
-              "effective_opening_displacement",
-              local_interface_quadrature_point_history[face_q_point]->
-                get_effective_opening_displacement());
-            table_handler.add_value("effective_traction_vector",
-              local_interface_quadrature_point_history[face_q_point]->
-                get_effective_cohesive_traction());
-            table_handler.add_value("time",
-              discrete_time.get_next_time());
-            table_handler.add_value("damage_variable",
-              local_interface_quadrature_point_history[face_q_point]->
-                get_damage_variable());
-
-            print_out = false;
-          }
-        }
-      }
+  for (unsigned int face_q_point = 0;
+       face_q_point < scratch.n_face_q_points; ++face_q_point)
+  {
+    scratch.opening_displacement_values[face_q_point] =
+      scratch.neighbor_cell_displacement_values[face_q_point] -
+      scratch.current_cell_displacement_values[face_q_point];
+
+    scratch.max_effective_opening_displacement_values[face_q_point] =
+      local_interface_quadrature_point_history[face_q_point].
+        get_max_effective_opening_displacement();
+  }
+
+  cohesive_law->get_cohesive_tractions(
+    scratch.opening_displacement_values,
+    scratch.normal_vector_values,
+    scratch.max_effective_opening_displacement_values,
+    scratch.cohesive_traction_values);
+
+  for (unsigned int face_q_point = 0;
+       face_q_point < scratch.n_face_q_points; ++face_q_point)
+  {
+    const double old_effective_opening_displacement =
+      local_interface_quadrature_point_history[face_q_point].store_effective_opening_displacement(
+        scratch.neighbor_cell_displacement_values[face_q_point],
+        scratch.current_cell_displacement_values[face_q_point],
+        scratch.normal_vector_values[face_q_point],
+        (parameters.constitutive_laws_parameters.cohesive_law_parameters.flag_couple_macrotraction_to_damage ?
+          std::pow(1.0 - local_interface_quadrature_point_history[face_q_point].get_damage_variable(),
+                    parameters.constitutive_laws_parameters.cohesive_law_parameters.degradation_exponent) :
+          1.0 ) *
+        scratch.cohesive_traction_values[face_q_point].norm(),
+        *cohesive_law);
+
+    typename InterfaceQuadraturePointHistory<dim>::CommittedValues
+      committed_values =
+        get_committed_interface_values(
+          grain_boundary_face.interface_id, face_q_point);
+
+    committed_values.old_effective_opening_displacement =
+      old_effective_opening_displacement;
+
+    set_committed_interface_values(grain_boundary_face.interface_id,
+                                   face_q_point,
+                                   committed_values);
+
+    if (false/*print_out*/)
+    {
+      table_handler.add_value(
+        "effective_opening_displacement",
+        local_interface_quadrature_point_history[face_q_point].
+          get_effective_opening_displacement());
+      table_handler.add_value("effective_traction_vector",
+        local_interface_quadrature_point_history[face_q_point].
+          get_effective_cohesive_traction());
+      table_handler.add_value("time",
+        discrete_time.get_next_time());
+      table_handler.add_value("damage_variable",
+        local_interface_quadrature_point_history[face_q_point].
+          get_damage_variable());
+
+      print_out = false;
+    }
+  }
 }
 
 
@@ -1663,10 +3161,6 @@ void GradientCrystalPlasticitySolver<dim>::assemble_projection_matrix()
   using CellIterator =
     typename dealii::DoFHandler<dim>::active_cell_iterator;
 
-  using CellFilter =
-    dealii::FilteredIterator<
-      typename dealii::DoFHandler<dim>::active_cell_iterator>;
-
   // Reset data
   lumped_projection_matrix = 0.0;
 
@@ -1692,11 +3186,10 @@ void GradientCrystalPlasticitySolver<dim>::assemble_projection_matrix()
     dealii::update_values;
 
   // Assemble using the WorkStream approach
-  dealii::WorkStream::run(
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               projection_dof_handler.begin_active()),
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               projection_dof_handler.end()),
+  run_work_stream(
+    projection_dof_handler,
+    colored_projection_cells,
+    "projection matrix assembly",
     worker,
     copier,
     gCP::AssemblyData::Postprocessing::ProjectionMatrix::Scratch<dim>(
@@ -1740,14 +3233,12 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_projection_matrix(
     // Scalar extractor for the damage variable
     const dealii::FEValuesExtractors::Scalar  extractor(0);
 
-    for (const auto &face_index : cell->face_indices())
-      if (!cell->face(face_index)->at_boundary() &&
-          cell->material_id() !=
-            cell->neighbor(face_index)->material_id())
+    for (const auto &grain_boundary_face :
+         get_grain_boundary_faces(cell->active_cell_index()))
       {
         // Update the hp::FEFaceValues instance to the values of the
         // current face
-        scratch.hp_fe_face_values.reinit(cell, face_index);
+        scratch.hp_fe_face_values.reinit(cell, grain_boundary_face.face_index);
 
         const dealii::FEFaceValues<dim> &fe_face_values =
           scratch.hp_fe_face_values.get_present_fe_values();
@@ -1801,10 +3292,6 @@ void GradientCrystalPlasticitySolver<dim>::assemble_projection_rhs()
   using CellIterator =
     typename dealii::DoFHandler<dim>::active_cell_iterator;
 
-  using CellFilter =
-    dealii::FilteredIterator<
-      typename dealii::DoFHandler<dim>::active_cell_iterator>;
-
   // Reset data
   projection_rhs = 0.0;
 
@@ -1830,11 +3317,10 @@ void GradientCrystalPlasticitySolver<dim>::assemble_projection_rhs()
     dealii::update_JxW_values;
 
   // Assemble using the WorkStream approach
-  dealii::WorkStream::run(
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               projection_dof_handler.begin_active()),
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               projection_dof_handler.end()),
+  run_work_stream(
+    projection_dof_handler,
+    colored_projection_cells,
+    "projection right-hand side assembly",
     worker,
     copier,
     gCP::AssemblyData::Postprocessing::ProjectionRHS::Scratch<dim>(
@@ -1877,18 +3363,12 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_projection_rhs(
     // Scalar extractor for the damage variable
     const dealii::FEValuesExtractors::Scalar  extractor(0);
 
-    // Instance of the interface quadrature point history
-    std::vector<std::shared_ptr<InterfaceQuadraturePointHistory<dim>>>
-      local_interface_quadrature_point_history;
-
-    for (const auto &face_index : cell->face_indices())
-      if (!cell->face(face_index)->at_boundary() &&
-          cell->material_id() !=
-            cell->neighbor(face_index)->material_id())
+    for (const auto &grain_boundary_face :
+         get_grain_boundary_faces(cell->active_cell_index()))
       {
         // Update the hp::FEFaceValues instance to the values of the
         // current face
-        scratch.hp_fe_face_values.reinit(cell, face_index);
+        scratch.hp_fe_face_values.reinit(cell, grain_boundary_face.face_index);
 
         const dealii::FEFaceValues<dim> &fe_face_values =
           scratch.hp_fe_face_values.get_present_fe_values();
@@ -1897,10 +3377,10 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_projection_rhs(
         scratch.face_JxW_values = fe_face_values.get_JxW_values();
 
         // Get the internal variable values at the quadrature points
-        local_interface_quadrature_point_history =
+        const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+          local_interface_quadrature_point_history =
             interface_quadrature_point_history.get_data(
-              cell->id(),
-              cell->neighbor(face_index)->id());
+              grain_boundary_face.interface_id);
 
         // Loop over quadrature points
         for (unsigned int face_q_point = 0;
@@ -1909,7 +3389,7 @@ void GradientCrystalPlasticitySolver<dim>::assemble_local_projection_rhs(
           scratch.damage_variable_values[face_q_point] = 0.0;
 
           scratch.damage_variable_values[face_q_point] =
-            local_interface_quadrature_point_history[face_q_point]->
+            local_interface_quadrature_point_history[face_q_point].
               get_damage_variable();
 
           // Extract test function values at the quadrature points (Displacement)
@@ -1971,7 +3451,7 @@ double GradientCrystalPlasticitySolver<dim>::get_macroscopic_damage()
   // at the quadrature points
   std::vector<double> JxW_values(n_face_quadrature_points);
 
-  double              domain_integral_damage_variable;
+  double              domain_integral_damage_variable = 0.0;
 
   double              cell_integral_damage_variable;
 
@@ -1979,20 +3459,14 @@ double GradientCrystalPlasticitySolver<dim>::get_macroscopic_damage()
 
   double              cell_volume = 0.;
 
-  // Instance of the interface quadrature point history
-  std::vector<std::shared_ptr<InterfaceQuadraturePointHistory<dim>>>
-    local_interface_quadrature_point_history;
-
   for (const auto &cell : projection_dof_handler.active_cell_iterators())
     if (cell->is_locally_owned() &&
         cell_is_at_grain_boundary(cell->active_cell_index()) &&
         (fe_field->is_decohesion_allowed() ||
           parameters.boundary_conditions_at_grain_boundaries ==
           RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction))
-      for (const auto &face_index : cell->face_indices())
-        if (!cell->face(face_index)->at_boundary() &&
-            cell->material_id() !=
-              cell->neighbor(face_index)->material_id())
+      for (const auto &grain_boundary_face :
+           get_grain_boundary_faces(cell->active_cell_index()))
         {
           // Reset local values
           cell_integral_damage_variable = 0.0;
@@ -2000,7 +3474,7 @@ double GradientCrystalPlasticitySolver<dim>::get_macroscopic_damage()
           cell_volume                   = 0.0;
 
           // Update the hp::FEFaceValues instance to the values of the current cell
-          hp_fe_face_values.reinit(cell, face_index);
+          hp_fe_face_values.reinit(cell, grain_boundary_face.face_index);
 
           const dealii::FEFaceValues<dim> &fe_face_values =
             hp_fe_face_values.get_present_fe_values();
@@ -2009,10 +3483,10 @@ double GradientCrystalPlasticitySolver<dim>::get_macroscopic_damage()
           JxW_values = fe_face_values.get_JxW_values();
 
           // Get the internal variable values at the quadrature points
-          local_interface_quadrature_point_history =
+          const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+            local_interface_quadrature_point_history =
               interface_quadrature_point_history.get_data(
-                cell->id(),
-                cell->neighbor(face_index)->id());
+                grain_boundary_face.interface_id);
 
           // Numerical integration
           for (unsigned int quadrature_point_id = 0;
@@ -2020,7 +3494,7 @@ double GradientCrystalPlasticitySolver<dim>::get_macroscopic_damage()
                 ++quadrature_point_id)
           {
             cell_integral_damage_variable +=
-              local_interface_quadrature_point_history[quadrature_point_id]->
+              local_interface_quadrature_point_history[quadrature_point_id].
                 get_damage_variable() *
                 JxW_values[quadrature_point_id];
 
@@ -2054,6 +3528,126 @@ double GradientCrystalPlasticitySolver<dim>::get_macroscopic_damage()
 
 
 
+template void gCP::GradientCrystalPlasticitySolver<2>::evaluate_local_slips(
+  const typename dealii::DoFHandler<2>::active_cell_iterator  &,
+  const dealii::FEValues<2>                                   &,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector            &,
+  dealii::Vector<double>                                      &,
+  std::vector<std::vector<double>>                            &,
+  std::vector<std::vector<dealii::Tensor<1,2>>>               *) const;
+template void gCP::GradientCrystalPlasticitySolver<3>::evaluate_local_slips(
+  const typename dealii::DoFHandler<3>::active_cell_iterator  &,
+  const dealii::FEValues<3>                                   &,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector            &,
+  dealii::Vector<double>                                      &,
+  std::vector<std::vector<double>>                            &,
+  std::vector<std::vector<dealii::Tensor<1,3>>>               *) const;
+
+template void gCP::GradientCrystalPlasticitySolver<2>::gather_batch_dof_values(
+  const typename gCP::GradientCrystalPlasticitySolver<2>::CellBatch  &,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector                  &,
+  gCP::AssemblyData::SumFactorizationScratch<2>                     &) const;
+template void gCP::GradientCrystalPlasticitySolver<3>::gather_batch_dof_values(
+  const typename gCP::GradientCrystalPlasticitySolver<3>::CellBatch  &,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector                  &,
+  gCP::AssemblyData::SumFactorizationScratch<3>                     &) const;
+
+template void gCP::GradientCrystalPlasticitySolver<2>::evaluate_batch_component(
+  const typename gCP::GradientCrystalPlasticitySolver<2>::CellBatch  &,
+  const gCP::TensorProductKernels<2, dealii::VectorizedArray<double>> &,
+  const unsigned int                                                ,
+  gCP::AssemblyData::SumFactorizationScratch<2>                     &,
+  dealii::AlignedVector<dealii::VectorizedArray<double>>            *,
+  dealii::AlignedVector<
+    dealii::Tensor<1,2,dealii::VectorizedArray<double>>>            *) const;
+template void gCP::GradientCrystalPlasticitySolver<3>::evaluate_batch_component(
+  const typename gCP::GradientCrystalPlasticitySolver<3>::CellBatch  &,
+  const gCP::TensorProductKernels<3, dealii::VectorizedArray<double>> &,
+  const unsigned int                                                ,
+  gCP::AssemblyData::SumFactorizationScratch<3>                     &,
+  dealii::AlignedVector<dealii::VectorizedArray<double>>            *,
+  dealii::AlignedVector<
+    dealii::Tensor<1,3,dealii::VectorizedArray<double>>>            *) const;
+
+template void gCP::GradientCrystalPlasticitySolver<2>::integrate_batch_component(
+  const typename gCP::GradientCrystalPlasticitySolver<2>::CellBatch  &,
+  const gCP::TensorProductKernels<2, dealii::VectorizedArray<double>> &,
+  const unsigned int                                                ,
+  gCP::AssemblyData::SumFactorizationScratch<2>                     &,
+  const dealii::AlignedVector<dealii::VectorizedArray<double>>      *,
+  const dealii::AlignedVector<
+    dealii::Tensor<1,2,dealii::VectorizedArray<double>>>            *,
+  const typename gCP::GradientCrystalPlasticitySolver<2>::
+    BatchLocalVectors                                               &) const;
+template void gCP::GradientCrystalPlasticitySolver<3>::integrate_batch_component(
+  const typename gCP::GradientCrystalPlasticitySolver<3>::CellBatch  &,
+  const gCP::TensorProductKernels<3, dealii::VectorizedArray<double>> &,
+  const unsigned int                                                ,
+  gCP::AssemblyData::SumFactorizationScratch<3>                     &,
+  const dealii::AlignedVector<dealii::VectorizedArray<double>>      *,
+  const dealii::AlignedVector<
+    dealii::Tensor<1,3,dealii::VectorizedArray<double>>>            *,
+  const typename gCP::GradientCrystalPlasticitySolver<3>::
+    BatchLocalVectors                                               &) const;
+
+template void gCP::GradientCrystalPlasticitySolver<2>::get_lane_values(
+  const dealii::FEValues<2>                                         &,
+  const unsigned int                                                ,
+  const dealii::AlignedVector<dealii::VectorizedArray<double>>      *,
+  const dealii::AlignedVector<
+    dealii::Tensor<1,2,dealii::VectorizedArray<double>>>            *,
+  std::vector<double>                                               *,
+  std::vector<dealii::Tensor<1,2>>                                  *) const;
+template void gCP::GradientCrystalPlasticitySolver<3>::get_lane_values(
+  const dealii::FEValues<3>                                         &,
+  const unsigned int                                                ,
+  const dealii::AlignedVector<dealii::VectorizedArray<double>>      *,
+  const dealii::AlignedVector<
+    dealii::Tensor<1,3,dealii::VectorizedArray<double>>>            *,
+  std::vector<double>                                               *,
+  std::vector<dealii::Tensor<1,3>>                                  *) const;
+
+template void gCP::GradientCrystalPlasticitySolver<2>::set_lane_fluxes(
+  const dealii::FEValues<2>                                         &,
+  const unsigned int                                                ,
+  const std::vector<double>                                         *,
+  const std::vector<dealii::Tensor<1,2>>                            *,
+  dealii::AlignedVector<dealii::VectorizedArray<double>>            *,
+  dealii::AlignedVector<
+    dealii::Tensor<1,2,dealii::VectorizedArray<double>>>            *) const;
+template void gCP::GradientCrystalPlasticitySolver<3>::set_lane_fluxes(
+  const dealii::FEValues<3>                                         &,
+  const unsigned int                                                ,
+  const std::vector<double>                                         *,
+  const std::vector<dealii::Tensor<1,3>>                            *,
+  dealii::AlignedVector<dealii::VectorizedArray<double>>            *,
+  dealii::AlignedVector<
+    dealii::Tensor<1,3,dealii::VectorizedArray<double>>>            *) const;
+
+template void gCP::GradientCrystalPlasticitySolver<2>::set_lane_bulk_residual_fluxes(
+  const dealii::FEValues<2>                                         &,
+  const unsigned int                                                ,
+  gCP::AssemblyData::Residual::Scratch<2>                           &,
+  const bool) const;
+template void gCP::GradientCrystalPlasticitySolver<3>::set_lane_bulk_residual_fluxes(
+  const dealii::FEValues<3>                                         &,
+  const unsigned int                                                ,
+  gCP::AssemblyData::Residual::Scratch<3>                           &,
+  const bool) const;
+
+template void gCP::GradientCrystalPlasticitySolver<2>::integrate_batch_bulk_residual(
+  const typename gCP::GradientCrystalPlasticitySolver<2>::CellBatch  &,
+  gCP::AssemblyData::Residual::Scratch<2>                           &,
+  gCP::AssemblyData::CellBatchCopy<
+    gCP::AssemblyData::Residual::Copy>                              &,
+  const bool) const;
+template void gCP::GradientCrystalPlasticitySolver<3>::integrate_batch_bulk_residual(
+  const typename gCP::GradientCrystalPlasticitySolver<3>::CellBatch  &,
+  gCP::AssemblyData::Residual::Scratch<3>                           &,
+  gCP::AssemblyData::CellBatchCopy<
+    gCP::AssemblyData::Residual::Copy>                              &,
+  const bool) const;
+
 template void gCP::GradientCrystalPlasticitySolver<2>::assemble_jacobian();
 template void gCP::GradientCrystalPlasticitySolver<3>::assemble_jacobian();
 
@@ -2066,34 +3660,129 @@ template void gCP::GradientCrystalPlasticitySolver<3>::assemble_local_jacobian(
   gCP::AssemblyData::Jacobian::Scratch<3>                     &,
   gCP::AssemblyData::Jacobian::Copy                           &);
 
+template void gCP::GradientCrystalPlasticitySolver<2>::assemble_local_jacobian(
+  const typename dealii::DoFHandler<2>::active_cell_iterator  &,
+  const dealii::FEValues<2>                                   &,
+  gCP::AssemblyData::Jacobian::Scratch<2>                     &,
+  gCP::AssemblyData::Jacobian::Copy                           &,
+  const std::vector<std::vector<gCP::InterfaceQuadraturePointHistory<2>>> *);
+template void gCP::GradientCrystalPlasticitySolver<3>::assemble_local_jacobian(
+  const typename dealii::DoFHandler<3>::active_cell_iterator  &,
+  const dealii::FEValues<3>                                   &,
+  gCP::AssemblyData::Jacobian::Scratch<3>                     &,
+  gCP::AssemblyData::Jacobian::Copy                           &,
+  const std::vector<std::vector<gCP::InterfaceQuadraturePointHistory<3>>> *);
+
 template void gCP::GradientCrystalPlasticitySolver<2>::copy_local_to_global_jacobian(
   const gCP::AssemblyData::Jacobian::Copy &);
 template void gCP::GradientCrystalPlasticitySolver<3>::copy_local_to_global_jacobian(
   const gCP::AssemblyData::Jacobian::Copy &);
 
+template bool gCP::GradientCrystalPlasticitySolver<2>::get_cached_local_jacobian(
+  const typename dealii::DoFHandler<2>::active_cell_iterator  &,
+  const gCP::AssemblyData::Jacobian::Scratch<2>               &,
+  const dealii::ArrayView<const double>                       &,
+  dealii::FullMatrix<double>                                  &);
+template bool gCP::GradientCrystalPlasticitySolver<3>::get_cached_local_jacobian(
+  const typename dealii::DoFHandler<3>::active_cell_iterator  &,
+  const gCP::AssemblyData::Jacobian::Scratch<3>               &,
+  const dealii::ArrayView<const double>                       &,
+  dealii::FullMatrix<double>                                  &);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::cache_local_jacobian(
+  const typename dealii::DoFHandler<2>::active_cell_iterator  &,
+  const gCP::AssemblyData::Jacobian::Scratch<2>               &,
+  const dealii::ArrayView<const double>                       &,
+  const dealii::FullMatrix<double>                            &);
+template void gCP::GradientCrystalPlasticitySolver<3>::cache_local_jacobian(
+  const typename dealii::DoFHandler<3>::active_cell_iterator  &,
+  const gCP::AssemblyData::Jacobian::Scratch<3>               &,
+  const dealii::ArrayView<const double>                       &,
+  const dealii::FullMatrix<double>                            &);
+
 template double gCP::GradientCrystalPlasticitySolver<2>::assemble_residual();
 template double gCP::GradientCrystalPlasticitySolver<3>::assemble_residual();
 
 template void gCP::GradientCrystalPlasticitySolver<2>::assemble_local_residual(
   const typename dealii::DoFHandler<2>::active_cell_iterator  &,
   gCP::AssemblyData::Residual::Scratch<2>                     &,
-  gCP::AssemblyData::Residual::Copy                           &);
+  gCP::AssemblyData::Residual::Copy                           &,
+  const bool,
+  const bool);
+template void gCP::GradientCrystalPlasticitySolver<3>::assemble_local_residual(
+  const typename dealii::DoFHandler<3>::active_cell_iterator  &,
+  gCP::AssemblyData::Residual::Scratch<3>                     &,
+  gCP::AssemblyData::Residual::Copy                           &,
+  const bool,
+  const bool);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::assemble_local_residual(
+  const typename gCP::GradientCrystalPlasticitySolver<2>::CellBatch  &,
+  gCP::AssemblyData::Residual::Scratch<2>                           &,
+  gCP::AssemblyData::CellBatchCopy<
+    gCP::AssemblyData::Residual::Copy>                              &,
+  const bool,
+  const bool);
+template void gCP::GradientCrystalPlasticitySolver<3>::assemble_local_residual(
+  const typename gCP::GradientCrystalPlasticitySolver<3>::CellBatch  &,
+  gCP::AssemblyData::Residual::Scratch<3>                           &,
+  gCP::AssemblyData::CellBatchCopy<
+    gCP::AssemblyData::Residual::Copy>                              &,
+  const bool,
+  const bool);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::assemble_local_residual(
+  const typename dealii::DoFHandler<2>::active_cell_iterator  &,
+  const dealii::FEValues<2>                                   &,
+  gCP::AssemblyData::Residual::Scratch<2>                     &,
+  gCP::AssemblyData::Residual::Copy                           &,
+  const bool,
+  const bool);
 template void gCP::GradientCrystalPlasticitySolver<3>::assemble_local_residual(
   const typename dealii::DoFHandler<3>::active_cell_iterator  &,
+  const dealii::FEValues<3>                                   &,
   gCP::AssemblyData::Residual::Scratch<3>                     &,
-  gCP::AssemblyData::Residual::Copy                           &);
+  gCP::AssemblyData::Residual::Copy                           &,
+  const bool,
+  const bool);
 
 template void gCP::GradientCrystalPlasticitySolver<2>::copy_local_to_global_residual(
   const gCP::AssemblyData::Residual::Copy &);
 template void gCP::GradientCrystalPlasticitySolver<3>::copy_local_to_global_residual(
   const gCP::AssemblyData::Residual::Copy &);
 
+template void gCP::GradientCrystalPlasticitySolver<2>::store_linear_residual();
+template void gCP::GradientCrystalPlasticitySolver<3>::store_linear_residual();
+
+template void gCP::GradientCrystalPlasticitySolver<2>::store_linear_residual_increment();
+template void gCP::GradientCrystalPlasticitySolver<3>::store_linear_residual_increment();
+
+template double gCP::GradientCrystalPlasticitySolver<2>::assemble_line_search_residual(
+  const double);
+template double gCP::GradientCrystalPlasticitySolver<3>::assemble_line_search_residual(
+  const double);
+
+template double gCP::GradientCrystalPlasticitySolver<2>::assemble_linear_system();
+template double gCP::GradientCrystalPlasticitySolver<3>::assemble_linear_system();
+
+template void gCP::GradientCrystalPlasticitySolver<2>::assemble_local_linear_system(
+  const typename dealii::DoFHandler<2>::active_cell_iterator  &,
+  gCP::AssemblyData::LinearSystem::Scratch<2>                 &,
+  gCP::AssemblyData::LinearSystem::Copy                       &);
+template void gCP::GradientCrystalPlasticitySolver<3>::assemble_local_linear_system(
+  const typename dealii::DoFHandler<3>::active_cell_iterator  &,
+  gCP::AssemblyData::LinearSystem::Scratch<3>                 &,
+  gCP::AssemblyData::LinearSystem::Copy                       &);
+
 template void gCP::GradientCrystalPlasticitySolver<2>::prepare_quadrature_point_history();
 template void gCP::GradientCrystalPlasticitySolver<3>::prepare_quadrature_point_history();
 
 template void gCP::GradientCrystalPlasticitySolver<2>::reset_quadrature_point_history();
 template void gCP::GradientCrystalPlasticitySolver<3>::reset_quadrature_point_history();
 
+template void gCP::GradientCrystalPlasticitySolver<2>::commit_quadrature_point_history();
+template void gCP::GradientCrystalPlasticitySolver<3>::commit_quadrature_point_history();
+
 template void gCP::GradientCrystalPlasticitySolver<2>::reset_and_update_quadrature_point_history();
 template void gCP::GradientCrystalPlasticitySolver<3>::reset_and_update_quadrature_point_history();
 
@@ -2106,6 +3795,39 @@ template void gCP::GradientCrystalPlasticitySolver<3>::update_local_quadrature_p
   gCP::AssemblyData::QuadraturePointHistory::Scratch<3>       &,
   gCP::AssemblyData::QuadraturePointHistory::Copy             &);
 
+template void gCP::GradientCrystalPlasticitySolver<2>::
+update_local_interface_quadrature_point_history(
+  const gCP::GradientCrystalPlasticitySolver<2>::GrainBoundaryFace &,
+  gCP::AssemblyData::QuadraturePointHistory::Scratch<2>           &);
+template void gCP::GradientCrystalPlasticitySolver<3>::
+update_local_interface_quadrature_point_history(
+  const gCP::GradientCrystalPlasticitySolver<3>::GrainBoundaryFace &,
+  gCP::AssemblyData::QuadraturePointHistory::Scratch<3>           &);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::
+update_interface_quadrature_point_history(
+  const gCP::GradientCrystalPlasticitySolver<2>::GrainBoundaryFace &,
+  const std::vector<dealii::Tensor<1,2>>                          &,
+  const std::vector<dealii::Tensor<1,2>>                          &,
+  const std::vector<dealii::Tensor<1,2>>                          &,
+  const std::vector<std::vector<double>>                          &,
+  const std::vector<std::vector<double>>                          &,
+  const dealii::ArrayView<gCP::InterfaceQuadraturePointHistory<2>> &) const;
+template void gCP::GradientCrystalPlasticitySolver<3>::
+update_interface_quadrature_point_history(
+  const gCP::GradientCrystalPlasticitySolver<3>::GrainBoundaryFace &,
+  const std::vector<dealii::Tensor<1,3>>                          &,
+  const std::vector<dealii::Tensor<1,3>>                          &,
+  const std::vector<dealii::Tensor<1,3>>                          &,
+  const std::vector<std::vector<double>>                          &,
+  const std::vector<std::vector<double>>                          &,
+  const dealii::ArrayView<gCP::InterfaceQuadraturePointHistory<3>> &) const;
+
+template void gCP::GradientCrystalPlasticitySolver<2>::
+store_trial_interface_damage_variables();
+template void gCP::GradientCrystalPlasticitySolver<3>::
+store_trial_interface_damage_variables();
+
 template void gCP::GradientCrystalPlasticitySolver<2>::
 store_effective_opening_displacement_in_quadrature_history();
 template void gCP::GradientCrystalPlasticitySolver<3>::
@@ -2113,14 +3835,12 @@ store_effective_opening_displacement_in_quadrature_history();
 
 template void gCP::GradientCrystalPlasticitySolver<2>::
 store_local_effective_opening_displacement(
-  const typename dealii::DoFHandler<2>::active_cell_iterator  &,
-  gCP::AssemblyData::QuadraturePointHistory::Scratch<2>       &,
-  gCP::AssemblyData::QuadraturePointHistory::Copy             &);
+  const gCP::GradientCrystalPlasticitySolver<2>::GrainBoundaryFace &,
+  gCP::AssemblyData::QuadraturePointHistory::Scratch<2>           &);
 template void gCP::GradientCrystalPlasticitySolver<3>::
 store_local_effective_opening_displacement(
-  const typename dealii::DoFHandler<3>::active_cell_iterator  &,
-  gCP::AssemblyData::QuadraturePointHistory::Scratch<3>       &,
-  gCP::AssemblyData::QuadraturePointHistory::Copy             &);
+  const gCP::GradientCrystalPlasticitySolver<3>::GrainBoundaryFace &,
+  gCP::AssemblyData::QuadraturePointHistory::Scratch<3>           &);
 
 template void gCP::GradientCrystalPlasticitySolver<2>::assemble_projection_matrix();
 template void gCP::GradientCrystalPlasticitySolver<3>::assemble_projection_matrix();
@@ -40,6 +40,39 @@ dofs_per_cell(data.dofs_per_cell)
 
 
 
+template <typename Copy>
+CellBatchCopy<Copy>::CellBatchCopy(const Copy &copy)
+:
+cell_copies(dealii::VectorizedArray<double>::size(), copy),
+n_cells(0)
+{}
+
+
+
+template <int dim>
+SumFactorizationScratch<dim>::SumFactorizationScratch(
+  const unsigned int n_q_points,
+  const unsigned int n_components)
+:
+batch_local_dof_values(VectorizedArrayType::size()),
+component_values(
+  n_components,
+  dealii::AlignedVector<VectorizedArrayType>(n_q_points)),
+component_reference_gradients(
+  n_components,
+  dealii::AlignedVector<dealii::Tensor<1,dim,VectorizedArrayType>>(
+    n_q_points)),
+component_value_fluxes(
+  n_components,
+  dealii::AlignedVector<VectorizedArrayType>(n_q_points)),
+component_reference_gradient_fluxes(
+  n_components,
+  dealii::AlignedVector<dealii::Tensor<1,dim,VectorizedArrayType>>(
+    n_q_points))
+{}
+
+
+
 namespace Jacobian
 {
 
@@ -90,7 +123,6 @@ normal_vector_values(this->n_face_q_points),
 JxW_values(this->n_q_points),
 face_JxW_values(this->n_face_q_points),
 face_neighbor_JxW_values(this->n_face_q_points),
-symmetrized_schmid_tensors(n_slips),
 slip_values(
   n_slips,
   std::vector<double>(this->n_q_points)),
@@ -100,6 +132,7 @@ slip_gradient_values(
 old_slip_values(
   n_slips,
   std::vector<double>(this->n_q_points)),
+slip_resistance_values(this->n_q_points * n_slips),
 vectorial_microstress_law_jacobian_values(
   this->n_q_points,
   std::vector<dealii::SymmetricTensor<2,dim>>(n_slips)),
@@ -117,9 +150,13 @@ neighbor_cell_displacement_values(this->n_face_q_points),
 current_cell_old_displacement_values(this->n_face_q_points),
 neighbor_cell_old_displacement_values(this->n_face_q_points),
 damage_variable_values(this->n_face_q_points),
+opening_displacement_values(this->n_face_q_points),
+max_effective_opening_displacement_values(this->n_face_q_points),
+old_effective_opening_displacement_values(this->n_face_q_points),
 cohesive_law_jacobian_values(this->n_face_q_points),
 contact_law_jacobian_values(this->n_face_q_points),
 sym_grad_vector_phi(this->dofs_per_cell),
+stiffness_sym_grad_vector_phi(this->dofs_per_cell),
 scalar_phi(
   n_slips,
   std::vector<double>(this->dofs_per_cell)),
@@ -133,7 +170,8 @@ face_scalar_phi(
   std::vector<double>(this->dofs_per_cell)),
 neighbour_face_scalar_phi(
   n_slips,
-  std::vector<double>(this->dofs_per_cell))
+  std::vector<double>(this->dofs_per_cell)),
+local_dof_values(this->dofs_per_cell)
 {}
 
 
@@ -163,7 +201,6 @@ normal_vector_values(this->n_face_q_points),
 JxW_values(this->n_q_points),
 face_JxW_values(this->n_face_q_points),
 face_neighbor_JxW_values(this->n_face_q_points),
-symmetrized_schmid_tensors(n_slips),
 slip_values(
   n_slips,
   std::vector<double>(this->n_q_points)),
@@ -173,6 +210,7 @@ slip_gradient_values(
 old_slip_values(
   n_slips,
   std::vector<double>(this->n_q_points)),
+slip_resistance_values(this->n_q_points * n_slips),
 vectorial_microstress_law_jacobian_values(
   this->n_q_points,
   std::vector<dealii::SymmetricTensor<2,dim>>(n_slips)),
@@ -190,9 +228,13 @@ neighbor_cell_displacement_values(this->n_face_q_points),
 current_cell_old_displacement_values(this->n_face_q_points),
 neighbor_cell_old_displacement_values(this->n_face_q_points),
 damage_variable_values(this->n_face_q_points),
+opening_displacement_values(this->n_face_q_points),
+max_effective_opening_displacement_values(this->n_face_q_points),
+old_effective_opening_displacement_values(this->n_face_q_points),
 cohesive_law_jacobian_values(this->n_face_q_points),
 contact_law_jacobian_values(this->n_face_q_points),
 sym_grad_vector_phi(this->dofs_per_cell),
+stiffness_sym_grad_vector_phi(this->dofs_per_cell),
 scalar_phi(
   n_slips,
   std::vector<double>(this->dofs_per_cell)),
@@ -206,7 +248,8 @@ face_scalar_phi(
   std::vector<double>(this->dofs_per_cell)),
 neighbour_face_scalar_phi(
   n_slips,
-  std::vector<double>(this->dofs_per_cell))
+  std::vector<double>(this->dofs_per_cell)),
+local_dof_values(this->dofs_per_cell)
 {}
 
 
@@ -215,6 +258,142 @@ neighbour_face_scalar_phi(
 
 
 
+namespace JacobianAction
+{
+
+
+
+Copy::Copy(const unsigned int dofs_per_cell)
+:
+CopyBase(dofs_per_cell),
+local_dst_values(dofs_per_cell)
+{}
+
+
+
+template <int dim>
+Scratch<dim>::Scratch(
+  const dealii::hp::MappingCollection<dim>  &mapping_collection,
+  const dealii::hp::QCollection<dim>        &quadrature_collection,
+  const dealii::hp::QCollection<dim-1>      &face_quadrature_collection,
+  const dealii::hp::FECollection<dim>       &finite_element_collection,
+  const dealii::UpdateFlags                 update_flags,
+  const dealii::UpdateFlags                 face_update_flags,
+  const unsigned int                        n_slips)
+:
+ScratchBase<dim>(
+  quadrature_collection,
+  finite_element_collection),
+SumFactorizationScratch<dim>(
+  quadrature_collection.max_n_quadrature_points(),
+  dim + n_slips),
+hp_fe_values(
+  mapping_collection,
+  finite_element_collection,
+  quadrature_collection,
+  update_flags),
+hp_fe_face_values(
+  mapping_collection,
+  finite_element_collection,
+  face_quadrature_collection,
+  face_update_flags),
+neighbour_hp_fe_face_values(
+  mapping_collection,
+  finite_element_collection,
+  face_quadrature_collection,
+  face_update_flags),
+n_face_q_points(face_quadrature_collection.max_n_quadrature_points()),
+n_slips(n_slips),
+JxW_values(this->n_q_points),
+face_JxW_values(this->n_face_q_points),
+neighbour_local_dof_values(this->dofs_per_cell),
+displacement_gradient_values(
+  dim,
+  std::vector<dealii::Tensor<1,dim>>(this->n_q_points)),
+strain_tensor_values(this->n_q_points),
+stress_tensor_values(this->n_q_points),
+slip_values(
+  n_slips,
+  std::vector<double>(this->n_q_points)),
+slip_gradient_values(
+  n_slips,
+  std::vector<dealii::Tensor<1,dim>>(this->n_q_points)),
+value_flux_values(this->n_q_points),
+gradient_flux_values(this->n_q_points),
+face_displacement_values(this->n_face_q_points),
+neighbour_face_displacement_values(this->n_face_q_points),
+face_traction_values(this->n_face_q_points),
+face_slip_values(
+  n_slips,
+  std::vector<double>(this->n_face_q_points)),
+neighbour_face_slip_values(
+  n_slips,
+  std::vector<double>(this->n_face_q_points)),
+face_microtraction_values(
+  n_slips,
+  std::vector<double>(this->n_face_q_points))
+{}
+
+
+
+template <int dim>
+Scratch<dim>::Scratch(const Scratch<dim> &data)
+:
+ScratchBase<dim>(data),
+SumFactorizationScratch<dim>(data),
+hp_fe_values(
+  data.hp_fe_values.get_mapping_collection(),
+  data.hp_fe_values.get_fe_collection(),
+  data.hp_fe_values.get_quadrature_collection(),
+  data.hp_fe_values.get_update_flags()),
+hp_fe_face_values(
+  data.hp_fe_face_values.get_mapping_collection(),
+  data.hp_fe_face_values.get_fe_collection(),
+  data.hp_fe_face_values.get_quadrature_collection(),
+  data.hp_fe_face_values.get_update_flags()),
+neighbour_hp_fe_face_values(
+  data.hp_fe_face_values.get_mapping_collection(),
+  data.hp_fe_face_values.get_fe_collection(),
+  data.hp_fe_face_values.get_quadrature_collection(),
+  data.hp_fe_face_values.get_update_flags()),
+n_face_q_points(data.n_face_q_points),
+n_slips(data.n_slips),
+JxW_values(this->n_q_points),
+face_JxW_values(this->n_face_q_points),
+neighbour_local_dof_values(this->dofs_per_cell),
+displacement_gradient_values(
+  dim,
+  std::vector<dealii::Tensor<1,dim>>(this->n_q_points)),
+strain_tensor_values(this->n_q_points),
+stress_tensor_values(this->n_q_points),
+slip_values(
+  n_slips,
+  std::vector<double>(this->n_q_points)),
+slip_gradient_values(
+  n_slips,
+  std::vector<dealii::Tensor<1,dim>>(this->n_q_points)),
+value_flux_values(this->n_q_points),
+gradient_flux_values(this->n_q_points),
+face_displacement_values(this->n_face_q_points),
+neighbour_face_displacement_values(this->n_face_q_points),
+face_traction_values(this->n_face_q_points),
+face_slip_values(
+  n_slips,
+  std::vector<double>(this->n_face_q_points)),
+neighbour_face_slip_values(
+  n_slips,
+  std::vector<double>(this->n_face_q_points)),
+face_microtraction_values(
+  n_slips,
+  std::vector<double>(this->n_face_q_points))
+{}
+
+
+
+} // namespace JacobianAction
+
+
+
 namespace Residual
 {
 
@@ -224,6 +403,7 @@ Copy::Copy(const unsigned int dofs_per_cell)
 :
 CopyBase(dofs_per_cell),
 local_rhs(dofs_per_cell),
+local_nonlinear_rhs(dofs_per_cell),
 local_matrix_for_inhomogeneous_bcs(dofs_per_cell, dofs_per_cell)
 {}
 
@@ -242,6 +422,9 @@ Scratch<dim>::Scratch(
 ScratchBase<dim>(
   quadrature_collection,
   finite_element_collection),
+SumFactorizationScratch<dim>(
+  quadrature_collection.max_n_quadrature_points(),
+  dim + n_slips),
 hp_fe_values(
   mapping_collection,
   finite_element_collection,
@@ -281,6 +464,7 @@ slip_values(
 old_slip_values(
   n_slips,
   std::vector<double>(this->n_q_points)),
+slip_resistance_values(this->n_q_points * n_slips),
 scalar_microstress_values(
   n_slips,
   std::vector<double>(this->n_q_points)),
@@ -293,6 +477,8 @@ current_cell_displacement_values(this->n_face_q_points),
 neighbor_cell_displacement_values(this->n_face_q_points),
 current_cell_old_displacement_values(this->n_face_q_points),
 neighbor_cell_old_displacement_values(this->n_face_q_points),
+opening_displacement_values(this->n_face_q_points),
+max_effective_opening_displacement_values(this->n_face_q_points),
 cohesive_traction_values(this->n_face_q_points),
 contact_traction_values(this->n_face_q_points),
 damage_variable_values(this->n_face_q_points),
@@ -302,6 +488,9 @@ face_slip_values(
 neighbour_face_slip_values(
   n_slips,
   std::vector<double>(this->n_face_q_points)),
+interface_quadrature_point_history(
+  dealii::GeometryInfo<dim>::faces_per_cell,
+  std::vector<InterfaceQuadraturePointHistory<dim>>(this->n_face_q_points)),
 vector_phi(this->dofs_per_cell),
 face_vector_phi(this->dofs_per_cell),
 sym_grad_vector_phi(this->dofs_per_cell),
@@ -313,7 +502,24 @@ face_scalar_phi(
   std::vector<double>(this->dofs_per_cell)),
 grad_scalar_phi(
   n_slips,
-  std::vector<dealii::Tensor<1,dim>>(this->dofs_per_cell))
+  std::vector<dealii::Tensor<1,dim>>(this->dofs_per_cell)),
+local_dof_values(this->dofs_per_cell),
+flag_sum_factorization(false),
+displacement_gradient_values(
+  dim,
+  std::vector<dealii::Tensor<1,dim>>(this->n_q_points)),
+value_flux_values(this->n_q_points),
+gradient_flux_values(this->n_q_points),
+batch_old_slip_values(
+  n_slips,
+  dealii::AlignedVector<dealii::VectorizedArray<double>>(this->n_q_points)),
+nonlinear_value_fluxes(
+  n_slips,
+  dealii::AlignedVector<dealii::VectorizedArray<double>>(this->n_q_points)),
+nonlinear_reference_gradient_fluxes(
+  n_slips,
+  dealii::AlignedVector<
+    dealii::Tensor<1,dim,dealii::VectorizedArray<double>>>(this->n_q_points))
 {}
 
 
@@ -322,6 +528,7 @@ template <int dim>
 Scratch<dim>::Scratch(const Scratch<dim> &data)
 :
 ScratchBase<dim>(data),
+SumFactorizationScratch<dim>(data),
 hp_fe_values(
   data.hp_fe_values.get_mapping_collection(),
   data.hp_fe_values.get_fe_collection(),
@@ -361,6 +568,7 @@ slip_values(
 old_slip_values(
   n_slips,
   std::vector<double>(this->n_q_points)),
+slip_resistance_values(this->n_q_points * n_slips),
 scalar_microstress_values(
   n_slips,
   std::vector<double>(this->n_q_points)),
@@ -373,6 +581,8 @@ current_cell_displacement_values(this->n_face_q_points),
 neighbor_cell_displacement_values(this->n_face_q_points),
 current_cell_old_displacement_values(this->n_face_q_points),
 neighbor_cell_old_displacement_values(this->n_face_q_points),
+opening_displacement_values(this->n_face_q_points),
+max_effective_opening_displacement_values(this->n_face_q_points),
 cohesive_traction_values(this->n_face_q_points),
 contact_traction_values(this->n_face_q_points),
 damage_variable_values(this->n_face_q_points),
@@ -382,6 +592,9 @@ face_slip_values(
 neighbour_face_slip_values(
   n_slips,
   std::vector<double>(this->n_face_q_points)),
+interface_quadrature_point_history(
+  dealii::GeometryInfo<dim>::faces_per_cell,
+  std::vector<InterfaceQuadraturePointHistory<dim>>(this->n_face_q_points)),
 vector_phi(this->dofs_per_cell),
 face_vector_phi(this->dofs_per_cell),
 sym_grad_vector_phi(this->dofs_per_cell),
@@ -393,7 +606,24 @@ face_scalar_phi(
   std::vector<double>(this->dofs_per_cell)),
 grad_scalar_phi(
   n_slips,
-  std::vector<dealii::Tensor<1,dim>>(this->dofs_per_cell))
+  std::vector<dealii::Tensor<1,dim>>(this->dofs_per_cell)),
+local_dof_values(this->dofs_per_cell),
+flag_sum_factorization(data.flag_sum_factorization),
+displacement_gradient_values(
+  dim,
+  std::vector<dealii::Tensor<1,dim>>(this->n_q_points)),
+value_flux_values(this->n_q_points),
+gradient_flux_values(this->n_q_points),
+batch_old_slip_values(
+  n_slips,
+  dealii::AlignedVector<dealii::VectorizedArray<double>>(this->n_q_points)),
+nonlinear_value_fluxes(
+  n_slips,
+  dealii::AlignedVector<dealii::VectorizedArray<double>>(this->n_q_points)),
+nonlinear_reference_gradient_fluxes(
+  n_slips,
+  dealii::AlignedVector<
+    dealii::Tensor<1,dim,dealii::VectorizedArray<double>>>(this->n_q_points))
 {}
 
 
@@ -456,7 +686,10 @@ current_cell_displacement_values(this->n_face_q_points),
 neighbor_cell_displacement_values(this->n_face_q_points),
 current_cell_old_displacement_values(this->n_face_q_points),
 neighbor_cell_old_displacement_values(this->n_face_q_points),
-cohesive_traction_values(this->n_face_q_points)
+opening_displacement_values(this->n_face_q_points),
+max_effective_opening_displacement_values(this->n_face_q_points),
+cohesive_traction_values(this->n_face_q_points),
+local_dof_values(this->dofs_per_cell)
 {}
 
 
@@ -501,7 +734,10 @@ current_cell_displacement_values(this->n_face_q_points),
 neighbor_cell_displacement_values(this->n_face_q_points),
 current_cell_old_displacement_values(this->n_face_q_points),
 neighbor_cell_old_displacement_values(this->n_face_q_points),
-cohesive_traction_values(this->n_face_q_points)
+opening_displacement_values(this->n_face_q_points),
+max_effective_opening_displacement_values(this->n_face_q_points),
+cohesive_traction_values(this->n_face_q_points),
+local_dof_values(this->dofs_per_cell)
 {}
 
 
@@ -525,6 +761,62 @@ void Scratch<dim>::reset()
 
 
 
+namespace LinearSystem
+{
+
+
+
+Copy::Copy(const unsigned int dofs_per_cell)
+:
+jacobian_copy(dofs_per_cell),
+residual_copy(dofs_per_cell)
+{}
+
+
+
+template <int dim>
+Scratch<dim>::Scratch(
+  const dealii::hp::MappingCollection<dim>  &mapping_collection,
+  const dealii::hp::QCollection<dim>        &quadrature_collection,
+  const dealii::hp::QCollection<dim-1>      &face_quadrature_collection,
+  const dealii::hp::FECollection<dim>       &finite_element_collection,
+  const dealii::UpdateFlags                 update_flags,
+  const dealii::UpdateFlags                 face_update_flags,
+  const unsigned int                        n_slips)
+:
+jacobian_scratch(
+  mapping_collection,
+  quadrature_collection,
+  face_quadrature_collection,
+  finite_element_collection,
+  update_flags,
+  face_update_flags,
+  n_slips),
+residual_scratch(
+  mapping_collection,
+  quadrature_collection,
+  face_quadrature_collection,
+  finite_element_collection,
+  update_flags,
+  face_update_flags,
+  n_slips)
+{}
+
+
+
+template <int dim>
+Scratch<dim>::Scratch(const Scratch<dim> &data)
+:
+jacobian_scratch(data.jacobian_scratch),
+residual_scratch(data.residual_scratch)
+{}
+
+
+
+} // namespace LinearSystem
+
+
+
 namespace Postprocessing
 {
 
@@ -663,15 +955,29 @@ scalar_test_function(this->dofs_per_cell)
 template struct gCP::AssemblyData::ScratchBase<2>;
 template struct gCP::AssemblyData::ScratchBase<3>;
 
+template struct gCP::AssemblyData::CellBatchCopy<
+  gCP::AssemblyData::JacobianAction::Copy>;
+template struct gCP::AssemblyData::CellBatchCopy<
+  gCP::AssemblyData::Residual::Copy>;
+
+template struct gCP::AssemblyData::SumFactorizationScratch<2>;
+template struct gCP::AssemblyData::SumFactorizationScratch<3>;
+
 template struct gCP::AssemblyData::Jacobian::Scratch<2>;
 template struct gCP::AssemblyData::Jacobian::Scratch<3>;
 
+template struct gCP::AssemblyData::JacobianAction::Scratch<2>;
+template struct gCP::AssemblyData::JacobianAction::Scratch<3>;
+
 template struct gCP::AssemblyData::Residual::Scratch<2>;
 template struct gCP::AssemblyData::Residual::Scratch<3>;
 
 template struct gCP::AssemblyData::QuadraturePointHistory::Scratch<2>;
 template struct gCP::AssemblyData::QuadraturePointHistory::Scratch<3>;
 
+template struct gCP::AssemblyData::LinearSystem::Scratch<2>;
+template struct gCP::AssemblyData::LinearSystem::Scratch<3>;
+
 template struct gCP::AssemblyData::Postprocessing::ProjectionMatrix::Scratch<2>;
 template struct gCP::AssemblyData::Postprocessing::ProjectionMatrix::Scratch<3>;
 
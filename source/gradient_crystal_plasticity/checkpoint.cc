@@ -0,0 +1,346 @@
+#include <gCP/gradient_crystal_plasticity.h>
+
+namespace gCP
+{
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::save_checkpoint(
+  const std::string &filename)
+{
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The GradientCrystalPlasticitySolver<dim>"
+                                 " instance has not been initialized."));
+
+  dealii::TimerOutput::Scope  t(*timer_output, "Solver: Checkpoint");
+
+  const auto *const triangulation =
+    dynamic_cast<const dealii::parallel::distributed::Triangulation<dim> *>(
+      &fe_field->get_triangulation());
+
+  AssertThrow(triangulation != nullptr,
+              dealii::ExcMessage("Checkpoints are only supported for "
+                                 "dealii::parallel::distributed::"
+                                 "Triangulation<dim> instances."));
+
+  // The latest checkpoint is never overwritten
+  const std::string prefix = Utilities::get_next_checkpoint_prefix(filename);
+
+  // The order in which the data is attached has to match the order in
+  // which it is deserialized, see load_checkpoint()
+  fe_field->prepare_for_serialization();
+
+  prepare_quadrature_point_history_for_serialization();
+
+  triangulation->save(prefix);
+
+  cell_data_transfer.reset();
+
+  serialized_quadrature_point_history.clear();
+
+  Utilities::save_discrete_time(discrete_time, prefix + ".time");
+
+  nonlinear_solver_logger.save(prefix + ".log");
+
+  Utilities::commit_checkpoint(filename, prefix);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::load_checkpoint(
+  const std::string &filename)
+{
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The GradientCrystalPlasticitySolver<dim>"
+                                 " instance has not been initialized."));
+
+  dealii::TimerOutput::Scope  t(*timer_output, "Solver: Checkpoint");
+
+  fe_field->deserialize();
+
+  deserialize_quadrature_point_history();
+
+  nonlinear_solver_logger.load(
+    Utilities::get_latest_checkpoint_prefix(filename) + ".log");
+
+  // The Jacobian and its preconditioner correspond to the state prior
+  // to the restart
+  flag_refresh_jacobian       = true;
+
+  flag_refresh_preconditioner = true;
+}
+
+
+
+template <int dim>
+std::vector<double>
+GradientCrystalPlasticitySolver<dim>::pack_local_quadrature_point_history(
+  const unsigned int active_cell_index) const
+{
+  const unsigned int n_q_points =
+    quadrature_collection.max_n_quadrature_points();
+
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  std::vector<double> values;
+
+  // Slip resistances
+  for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+      values.push_back(
+        quadrature_point_history.get_slip_resistance(active_cell_index,
+                                                     q_point,
+                                                     slip_id));
+
+  // Internal variables of the cohesive law
+  if (fe_field->is_decohesion_allowed())
+  {
+    const dealii::ArrayView<const GrainBoundaryFace>
+      cell_grain_boundary_faces =
+        get_grain_boundary_faces(active_cell_index);
+
+    for (unsigned int face_index = 0;
+         face_index < dealii::GeometryInfo<dim>::faces_per_cell;
+         ++face_index)
+    {
+      const auto grain_boundary_face =
+        std::find_if(cell_grain_boundary_faces.begin(),
+                     cell_grain_boundary_faces.end(),
+                     [face_index](const GrainBoundaryFace &face)
+                     {
+                       return (face.face_index == face_index);
+                     });
+
+      if (grain_boundary_face == cell_grain_boundary_faces.end())
+      {
+        values.push_back(0.0);
+
+        continue;
+      }
+
+      values.push_back(1.0);
+
+      const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+        local_interface_quadrature_point_history =
+          interface_quadrature_point_history.get_data(
+            grain_boundary_face->interface_id);
+
+      for (unsigned int face_q_point = 0;
+           face_q_point < local_interface_quadrature_point_history.size();
+           ++face_q_point)
+        local_interface_quadrature_point_history[face_q_point].pack_values(
+          values,
+          get_committed_interface_values(grain_boundary_face->interface_id,
+                                         face_q_point));
+    }
+  }
+
+  return (values);
+}
+
+
+
+template <int dim>
+void
+GradientCrystalPlasticitySolver<dim>::unpack_local_quadrature_point_history(
+  const unsigned int          active_cell_index,
+  const std::vector<double>   &values)
+{
+  const unsigned int n_q_points =
+    quadrature_collection.max_n_quadrature_points();
+
+  const unsigned int n_face_q_points =
+    face_quadrature_collection.max_n_quadrature_points();
+
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  const unsigned int n_packed_values =
+    InterfaceQuadraturePointHistory<dim>::n_packed_values;
+
+  auto assert_size = [&values](const std::size_t size)
+  {
+    AssertThrow(size <= values.size(),
+                dealii::ExcMessage("The packed quadrature point history "
+                                   "does not match the discretization."));
+  };
+
+  std::size_t position = 0;
+
+  // Slip resistances
+  assert_size(n_q_points * n_slips);
+
+  for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+  {
+    quadrature_point_history.set_slip_resistances(
+      active_cell_index,
+      q_point,
+      dealii::make_array_view(values.data() + position,
+                              values.data() + position + n_slips));
+
+    position += n_slips;
+  }
+
+  // Internal variables of the cohesive law. Faces which are not at a
+  // grain boundary anymore are skipped and those which were not at one
+  // keep their initial values
+  if (fe_field->is_decohesion_allowed())
+  {
+    const dealii::ArrayView<const GrainBoundaryFace>
+      cell_grain_boundary_faces =
+        get_grain_boundary_faces(active_cell_index);
+
+    for (unsigned int face_index = 0;
+         face_index < dealii::GeometryInfo<dim>::faces_per_cell;
+         ++face_index)
+    {
+      assert_size(position + 1);
+
+      if (values[position++] == 0.0)
+        continue;
+
+      assert_size(position + n_face_q_points * n_packed_values);
+
+      const auto grain_boundary_face =
+        std::find_if(cell_grain_boundary_faces.begin(),
+                     cell_grain_boundary_faces.end(),
+                     [face_index](const GrainBoundaryFace &face)
+                     {
+                       return (face.face_index == face_index);
+                     });
+
+      if (grain_boundary_face != cell_grain_boundary_faces.end())
+      {
+        const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+          local_interface_quadrature_point_history =
+            interface_quadrature_point_history.get_data(
+              grain_boundary_face->interface_id);
+
+        for (unsigned int face_q_point = 0;
+             face_q_point < n_face_q_points;
+             ++face_q_point)
+        {
+          set_committed_interface_values(
+            grain_boundary_face->interface_id,
+            face_q_point,
+            local_interface_quadrature_point_history[face_q_point].
+              unpack_values(
+                dealii::make_array_view(
+                  values.data() + position,
+                  values.data() + position + n_packed_values)));
+
+          position += n_packed_values;
+        }
+      }
+      else
+        position += n_face_q_points * n_packed_values;
+    }
+  }
+
+  AssertThrow(position == values.size(),
+              dealii::ExcMessage("The packed quadrature point history "
+                                 "does not match the discretization."));
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::
+prepare_quadrature_point_history_for_serialization()
+{
+  const auto &triangulation =
+    dynamic_cast<const dealii::parallel::distributed::Triangulation<dim> &>(
+      fe_field->get_triangulation());
+
+  serialized_quadrature_point_history.assign(
+    triangulation.n_active_cells(), std::vector<double>());
+
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned())
+      serialized_quadrature_point_history[cell->active_cell_index()] =
+        pack_local_quadrature_point_history(cell->active_cell_index());
+
+  cell_data_transfer =
+    std::make_unique<dealii::parallel::distributed::CellDataTransfer<
+      dim, dim, std::vector<std::vector<double>>>>(
+        triangulation,
+        /*transfer_variable_size_data=*/true);
+
+  cell_data_transfer->prepare_for_serialization(
+    serialized_quadrature_point_history);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::
+deserialize_quadrature_point_history()
+{
+  const auto &triangulation =
+    dynamic_cast<const dealii::parallel::distributed::Triangulation<dim> &>(
+      fe_field->get_triangulation());
+
+  serialized_quadrature_point_history.assign(
+    triangulation.n_active_cells(), std::vector<double>());
+
+  cell_data_transfer =
+    std::make_unique<dealii::parallel::distributed::CellDataTransfer<
+      dim, dim, std::vector<std::vector<double>>>>(
+        triangulation,
+        /*transfer_variable_size_data=*/true);
+
+  cell_data_transfer->deserialize(serialized_quadrature_point_history);
+
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned())
+      unpack_local_quadrature_point_history(
+        cell->active_cell_index(),
+        serialized_quadrature_point_history[cell->active_cell_index()]);
+
+  cell_data_transfer.reset();
+
+  serialized_quadrature_point_history.clear();
+}
+
+
+
+} // namespace gCP
+
+
+
+template void gCP::GradientCrystalPlasticitySolver<2>::save_checkpoint(
+  const std::string &);
+template void gCP::GradientCrystalPlasticitySolver<3>::save_checkpoint(
+  const std::string &);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::load_checkpoint(
+  const std::string &);
+template void gCP::GradientCrystalPlasticitySolver<3>::load_checkpoint(
+  const std::string &);
+
+template std::vector<double>
+gCP::GradientCrystalPlasticitySolver<2>::pack_local_quadrature_point_history(
+  const unsigned int) const;
+template std::vector<double>
+gCP::GradientCrystalPlasticitySolver<3>::pack_local_quadrature_point_history(
+  const unsigned int) const;
+
+template void
+gCP::GradientCrystalPlasticitySolver<2>::unpack_local_quadrature_point_history(
+  const unsigned int,
+  const std::vector<double> &);
+template void
+gCP::GradientCrystalPlasticitySolver<3>::unpack_local_quadrature_point_history(
+  const unsigned int,
+  const std::vector<double> &);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::
+prepare_quadrature_point_history_for_serialization();
+template void gCP::GradientCrystalPlasticitySolver<3>::
+prepare_quadrature_point_history_for_serialization();
+
+template void gCP::GradientCrystalPlasticitySolver<2>::
+deserialize_quadrature_point_history();
+template void gCP::GradientCrystalPlasticitySolver<3>::
+deserialize_quadrature_point_history();
@@ -51,6 +51,8 @@ cohesive_law(
 contact_law(
   std::make_shared<ConstitutiveLaws::ContactLaw<dim>>(
     parameters.constitutive_laws_parameters.contact_law_parameters)),
+flag_refresh_jacobian(true),
+flag_refresh_preconditioner(true),
 residual_norm(std::numeric_limits<double>::max()),
 line_search(parameters.line_search_parameters),
 nonlinear_solver_logger(
@@ -60,7 +62,10 @@ postprocessor(
   discrete_time,
   fe_field,
   crystals_data),
-flag_init_was_called(false)
+flag_init_was_called(false),
+n_locally_owned_cells(0),
+n_local_jacobian_cache_hits(0),
+n_local_jacobian_cache_misses(0)
 {
   Assert(fe_field.get() != nullptr,
          dealii::ExcMessage("The FEField<dim>'s shared pointer has "
@@ -118,6 +123,11 @@ flag_init_was_called(false)
   nonlinear_solver_logger.declare_column("(R_U)_L2");
   nonlinear_solver_logger.declare_column("(R_G)_L2");
   nonlinear_solver_logger.declare_column("C-Rate");
+  if (parameters.flag_cache_local_jacobians)
+  {
+    nonlinear_solver_logger.declare_column("J-Hits");
+    nonlinear_solver_logger.declare_column("J-Misses");
+  }
   nonlinear_solver_logger.set_scientific("(NS)_L2", true);
   nonlinear_solver_logger.set_scientific("(NS_U)_L2", true);
   nonlinear_solver_logger.set_scientific("(NS_G)_L2", true);
@@ -0,0 +1,1125 @@
+#include <gCP/assembly_data.h>
+#include <gCP/gradient_crystal_plasticity.h>
+
+#include <deal.II/base/work_stream.h>
+#include <deal.II/grid/filtered_iterator.h>
+
+namespace gCP
+{
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::apply_jacobian(
+  dealii::LinearAlgebraTrilinos::MPI::Vector        &dst,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector  &src)
+{
+  dealii::TimerOutput::Scope  t(*timer_output,
+                                "Solver: Jacobian application");
+
+  const dealii::AffineConstraints<double> &newton_method_constraints =
+    fe_field->get_newton_method_constraints();
+
+  // The constraints are applied to the source vector before it is
+  // passed to its ghosted counterpart, i.e., the operator reads as
+  // C^T J C with C being the matrix of the constraints
+  distributed_src = src;
+
+  newton_method_constraints.distribute(distributed_src);
+
+  ghost_src = distributed_src;
+
+  // Reset data
+  dst = 0.0;
+
+  // Set up the lambda function for the local operation
+  auto worker = [this](
+    const CellBatchIterator                           &cell_batch,
+    gCP::AssemblyData::JacobianAction::Scratch<dim>   &scratch,
+    gCP::AssemblyData::CellBatchCopy<
+      gCP::AssemblyData::JacobianAction::Copy>        &data)
+  {
+    this->apply_local_jacobian(*cell_batch, scratch, data, ghost_src);
+  };
+
+  // Set up the lambda function for the copy local to global operation
+  auto copier = [&newton_method_constraints, &dst](
+    const gCP::AssemblyData::CellBatchCopy<
+      gCP::AssemblyData::JacobianAction::Copy>      &data)
+  {
+    for (unsigned int lane = 0; lane < data.n_cells; ++lane)
+      newton_method_constraints.distribute_local_to_global(
+        data.cell_copies[lane].local_dst_values,
+        data.cell_copies[lane].local_dof_indices,
+        dst);
+  };
+
+  // Define the update flags for the FEValues instances. The bulk
+  // integrals are sum-factorized, i.e., only the mapping data is
+  // needed
+  const dealii::UpdateFlags update_flags =
+    dealii::update_JxW_values |
+    dealii::update_inverse_jacobians;
+
+  const dealii::UpdateFlags face_update_flags =
+    dealii::update_JxW_values |
+    dealii::update_values;
+
+  // Apply using the WorkStream approach. The sum-factorized kernels
+  // run over cell batches. The copier writes into a non-ghosted vector,
+  // i.e., the batches are traversed as in the serial copier approach
+  dealii::WorkStream::run(
+    cell_batches.cbegin(),
+    cell_batches.cend(),
+    worker,
+    copier,
+    gCP::AssemblyData::JacobianAction::Scratch<dim>(
+      mapping_collection,
+      quadrature_collection,
+      face_quadrature_collection,
+      fe_field->get_fe_collection(),
+      update_flags,
+      face_update_flags,
+      crystals_data->get_n_slips()),
+    gCP::AssemblyData::CellBatchCopy<
+      gCP::AssemblyData::JacobianAction::Copy>(
+        gCP::AssemblyData::JacobianAction::Copy(
+          fe_field->get_fe_collection().max_dofs_per_cell())));
+
+  // Compress global data
+  dst.compress(dealii::VectorOperation::add);
+
+  // Identity rows for the constrained degrees of freedom
+  for (const auto locally_owned_dof : dst.locally_owned_elements())
+    if (newton_method_constraints.is_constrained(locally_owned_dof))
+      dst(locally_owned_dof) = src(locally_owned_dof);
+
+  dst.compress(dealii::VectorOperation::insert);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::apply_local_jacobian(
+  const CellBatch                                             &cell_batch,
+  gCP::AssemblyData::JacobianAction::Scratch<dim>             &scratch,
+  gCP::AssemblyData::CellBatchCopy<
+    gCP::AssemblyData::JacobianAction::Copy>                  &data,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector            &src)
+{
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  data.n_cells = cell_batch.cells.size();
+
+  // Gather the local values of the source vector and evaluate them at
+  // the quadrature points of all cells at once
+  gather_batch_dof_values(cell_batch, src, scratch);
+
+  for (unsigned int component = 0; component < dim; ++component)
+    evaluate_batch_component(
+      cell_batch,
+      *displacement_kernels,
+      component,
+      scratch,
+      nullptr,
+      &scratch.component_reference_gradients[component]);
+
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    evaluate_batch_component(
+      cell_batch,
+      *slip_kernels,
+      dim + slip_id,
+      scratch,
+      &scratch.component_values[dim + slip_id],
+      &scratch.component_reference_gradients[dim + slip_id]);
+
+  // The tangent moduli and the grain boundary integrals are applied
+  // cell by cell
+  BatchLocalVectors local_dst_values{};
+
+  for (unsigned int lane = 0; lane < cell_batch.cells.size(); ++lane)
+  {
+    apply_local_jacobian(cell_batch.cells[lane],
+                         lane,
+                         scratch,
+                         data.cell_copies[lane],
+                         src);
+
+    local_dst_values[lane] = &data.cell_copies[lane].local_dst_values;
+  }
+
+  // Integrate the bulk contributions of all cells at once
+  for (unsigned int component = 0; component < dim; ++component)
+    integrate_batch_component(
+      cell_batch,
+      *displacement_kernels,
+      component,
+      scratch,
+      nullptr,
+      &scratch.component_reference_gradient_fluxes[component],
+      local_dst_values);
+
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    integrate_batch_component(
+      cell_batch,
+      *slip_kernels,
+      dim + slip_id,
+      scratch,
+      &scratch.component_value_fluxes[dim + slip_id],
+      &scratch.component_reference_gradient_fluxes[dim + slip_id],
+      local_dst_values);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::apply_local_jacobian(
+  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+  const unsigned int                                            lane,
+  gCP::AssemblyData::JacobianAction::Scratch<dim>               &scratch,
+  gCP::AssemblyData::JacobianAction::Copy                       &data,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector              &src)
+{
+  // The tangent moduli were computed at the last Jacobian refresh,
+  // see assemble_jacobi_preconditioner()
+  const LocalJacobianTangent &tangent =
+    local_jacobian_tangents[
+      get_locally_owned_cell_index(cell->active_cell_index())];
+
+  Assert(!tangent.scalar_microstress_moduli.empty(),
+         dealii::ExcMessage("The tangent moduli of the cell have not "
+                            "been computed."));
+
+  // Reset local data
+  data.local_dst_values = 0.0;
+
+  // Local to global indices mapping
+  cell->get_dof_indices(data.local_dof_indices);
+
+  // Update the hp::FEValues instance to the mapping data of the
+  // current cell
+  scratch.hp_fe_values.reinit(cell);
+
+  const dealii::FEValues<dim> &fe_values =
+    scratch.hp_fe_values.get_present_fe_values();
+
+  // Get the crystal identifier for the current cell
+  const unsigned int crystal_id = cell->material_id();
+
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  // Get the moduli which are constant per crystal
+  const dealii::SymmetricTensor<4,dim> &stiffness_tetrad =
+    hooke_law->get_stiffness_tetrad(crystal_id);
+
+  const std::vector<dealii::SymmetricTensor<2,dim>>
+    &stiffness_schmid_contractions =
+      hooke_law->get_stiffness_schmid_contractions(crystal_id);
+
+  const std::vector<dealii::SymmetricTensor<2,dim>>
+    &schmid_stiffness_contractions =
+      hooke_law->get_schmid_stiffness_contractions(crystal_id);
+
+  const dealii::FullMatrix<double> &schmid_stiffness_schmid_contractions =
+    hooke_law->get_schmid_stiffness_schmid_contractions(crystal_id);
+
+  const bool flag_linear_vectorial_microstress =
+    vectorial_microstress_law_is_linear();
+
+  const std::vector<dealii::SymmetricTensor<2,dim>> *quadratic_jacobians =
+    flag_linear_vectorial_microstress ?
+      &vectorial_microstress_law->get_quadratic_jacobians(crystal_id) :
+      nullptr;
+
+  // Get JxW values at the quadrature points
+  scratch.JxW_values = fe_values.get_JxW_values();
+
+  // Get the values of the source vector at the quadrature points of
+  // the cell from the lane of the cell batch
+  for (unsigned int component = 0; component < dim; ++component)
+    get_lane_values(fe_values,
+                    lane,
+                    nullptr,
+                    &scratch.component_reference_gradients[component],
+                    nullptr,
+                    &scratch.displacement_gradient_values[component]);
+
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    get_lane_values(fe_values,
+                    lane,
+                    &scratch.component_values[dim + slip_id],
+                    &scratch.component_reference_gradients[dim + slip_id],
+                    &scratch.slip_values[slip_id],
+                    &scratch.slip_gradient_values[slip_id]);
+
+  // Linearized strain and stress tensors, i.e.,
+  // C : (eps(u) - sum_alpha S_alpha gamma_alpha)
+  for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
+  {
+    dealii::Tensor<2,dim> displacement_gradient;
+
+    for (unsigned int component = 0; component < dim; ++component)
+      displacement_gradient[component] =
+        scratch.displacement_gradient_values[component][q_point];
+
+    scratch.strain_tensor_values[q_point] =
+      dealii::symmetrize(displacement_gradient);
+
+    scratch.stress_tensor_values[q_point] =
+      stiffness_tetrad * scratch.strain_tensor_values[q_point];
+
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+      scratch.stress_tensor_values[q_point] -=
+        stiffness_schmid_contractions[slip_id] *
+        scratch.slip_values[slip_id][q_point];
+  }
+
+  // Displacements, i.e., grad(v) : sigma
+  for (unsigned int component = 0; component < dim; ++component)
+  {
+    for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
+      for (unsigned int d = 0; d < dim; ++d)
+        scratch.gradient_flux_values[q_point][d] =
+          scratch.stress_tensor_values[q_point][component][d] *
+          scratch.JxW_values[q_point];
+
+    set_lane_fluxes(fe_values,
+                    lane,
+                    nullptr,
+                    &scratch.gradient_flux_values,
+                    nullptr,
+                    &scratch.component_reference_gradient_fluxes[component]);
+  }
+
+  // Slips, i.e.,
+  // -eta_alpha S_alpha : C : eps(u) +
+  // eta_alpha (S_alpha : C : S_beta + dpi_alpha / dgamma_beta) gamma_beta +
+  // grad(eta_alpha) . dxi_alpha / dgrad(gamma_alpha) . grad(gamma_alpha)
+  for (unsigned int slip_id_alpha = 0;
+       slip_id_alpha < n_slips;
+       ++slip_id_alpha)
+  {
+    for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
+    {
+      const double *scalar_microstress_moduli =
+        tangent.scalar_microstress_moduli.data() +
+        (q_point * n_slips + slip_id_alpha) * n_slips;
+
+      double value_flux =
+        -schmid_stiffness_contractions[slip_id_alpha] *
+        scratch.strain_tensor_values[q_point];
+
+      for (unsigned int slip_id_beta = 0;
+           slip_id_beta < n_slips;
+           ++slip_id_beta)
+        value_flux +=
+          (schmid_stiffness_schmid_contractions(slip_id_alpha,
+                                                slip_id_beta) +
+           scalar_microstress_moduli[slip_id_beta]) *
+          scratch.slip_values[slip_id_beta][q_point];
+
+      const dealii::SymmetricTensor<2,dim> &vectorial_microstress_moduli =
+        flag_linear_vectorial_microstress ?
+          (*quadratic_jacobians)[slip_id_alpha] :
+          tangent.vectorial_microstress_moduli[q_point * n_slips +
+                                               slip_id_alpha];
+
+      scratch.value_flux_values[q_point] =
+        value_flux * scratch.JxW_values[q_point];
+
+      scratch.gradient_flux_values[q_point] =
+        vectorial_microstress_moduli *
+        scratch.slip_gradient_values[slip_id_alpha][q_point] *
+        scratch.JxW_values[q_point];
+    }
+
+    set_lane_fluxes(
+      fe_values,
+      lane,
+      &scratch.value_flux_values,
+      &scratch.gradient_flux_values,
+      &scratch.component_value_fluxes[dim + slip_id_alpha],
+      &scratch.component_reference_gradient_fluxes[dim + slip_id_alpha]);
+  }
+
+  const bool flag_microtraction =
+    parameters.boundary_conditions_at_grain_boundaries ==
+      RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction;
+
+  if (!cell_is_at_grain_boundary(cell->active_cell_index()) ||
+      !(fe_field->is_decohesion_allowed() || flag_microtraction))
+    return;
+
+  // Grain boundary integrals. Only the rows of the current cell are
+  // computed, the source values of the neighbour cell enter through
+  // the jumps across the face
+  const std::vector<unsigned int> &displacement_local_dofs =
+    fe_field->get_displacement_local_dofs(crystal_id);
+
+  const std::vector<std::vector<unsigned int>> &slips_local_dofs =
+    fe_field->get_slips_local_dofs(crystal_id);
+
+  const dealii::ArrayView<const GrainBoundaryFace> grain_boundary_faces =
+    get_grain_boundary_faces(cell->active_cell_index());
+
+  for (unsigned int face_id = 0;
+       face_id < grain_boundary_faces.size();
+       ++face_id)
+  {
+    const GrainBoundaryFace &grain_boundary_face =
+      grain_boundary_faces[face_id];
+
+    const unsigned int neighbour_crystal_id =
+      grain_boundary_face.neighbour_crystal_id;
+
+    // Update the hp::FEFaceValues instances to the values of the
+    // current and of the neighbour face
+    scratch.hp_fe_face_values.reinit(cell, grain_boundary_face.face_index);
+
+    const dealii::FEFaceValues<dim> &fe_face_values =
+      scratch.hp_fe_face_values.get_present_fe_values();
+
+    scratch.neighbour_hp_fe_face_values.reinit(
+      grain_boundary_face.neighbour_cell,
+      grain_boundary_face.neighbour_face_index);
+
+    const dealii::FEFaceValues<dim> &neighbour_fe_face_values =
+      scratch.neighbour_hp_fe_face_values.get_present_fe_values();
+
+    scratch.face_JxW_values = fe_face_values.get_JxW_values();
+
+    // Gather the local values of the source vector at the neighbour
+    // cell
+    scratch.neighbour_local_dof_values.reinit(
+      neighbour_fe_face_values.dofs_per_cell);
+
+    grain_boundary_face.neighbour_cell->get_dof_values(
+      src,
+      scratch.neighbour_local_dof_values);
+
+    const unsigned int face_offset = face_id * scratch.n_face_q_points;
+
+    // Macrotraction, i.e., -v . dt / d[u] . [u]
+    if (fe_field->is_decohesion_allowed())
+    {
+      fe_face_values[fe_field->get_displacement_extractor(crystal_id)].
+        get_function_values_from_local_dof_values(
+          scratch.batch_local_dof_values[lane],
+          scratch.face_displacement_values);
+
+      neighbour_fe_face_values[
+        fe_field->get_displacement_extractor(neighbour_crystal_id)].
+          get_function_values_from_local_dof_values(
+            scratch.neighbour_local_dof_values,
+            scratch.neighbour_face_displacement_values);
+
+      for (unsigned int face_q_point = 0;
+           face_q_point < scratch.n_face_q_points;
+           ++face_q_point)
+        scratch.face_traction_values[face_q_point] =
+          -tangent.macrotraction_moduli[face_offset + face_q_point] *
+          (scratch.neighbour_face_displacement_values[face_q_point] -
+           scratch.face_displacement_values[face_q_point]) *
+          scratch.face_JxW_values[face_q_point];
+
+      for (const unsigned int i : displacement_local_dofs)
+        for (unsigned int face_q_point = 0;
+             face_q_point < scratch.n_face_q_points;
+             ++face_q_point)
+          data.local_dst_values(i) +=
+            fe_face_values[fe_field->get_displacement_extractor(
+              crystal_id)].value(i, face_q_point) *
+            scratch.face_traction_values[face_q_point];
+    }
+
+    // Microtraction, i.e.,
+    // -eta_alpha (dxi_alpha / dgamma_beta gamma_beta +
+    //             dxi_alpha / dgamma'_beta gamma'_beta)
+    if (flag_microtraction)
+    {
+      for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+      {
+        fe_face_values[fe_field->get_slip_extractor(crystal_id, slip_id)].
+          get_function_values_from_local_dof_values(
+            scratch.batch_local_dof_values[lane],
+            scratch.face_slip_values[slip_id]);
+
+        neighbour_fe_face_values[
+          fe_field->get_slip_extractor(neighbour_crystal_id, slip_id)].
+            get_function_values_from_local_dof_values(
+              scratch.neighbour_local_dof_values,
+              scratch.neighbour_face_slip_values[slip_id]);
+      }
+
+      for (unsigned int face_q_point = 0;
+           face_q_point < scratch.n_face_q_points;
+           ++face_q_point)
+        for (unsigned int slip_id_alpha = 0;
+             slip_id_alpha < n_slips;
+             ++slip_id_alpha)
+        {
+          const std::size_t offset =
+            (static_cast<std::size_t>(face_offset + face_q_point) *
+               n_slips + slip_id_alpha) * n_slips;
+
+          double microtraction = 0.0;
+
+          for (unsigned int slip_id_beta = 0;
+               slip_id_beta < n_slips;
+               ++slip_id_beta)
+            microtraction +=
+              tangent.intra_microtraction_moduli[offset + slip_id_beta] *
+                scratch.face_slip_values[slip_id_beta][face_q_point]
+              +
+              tangent.inter_microtraction_moduli[offset + slip_id_beta] *
+                scratch.neighbour_face_slip_values[slip_id_beta][face_q_point];
+
+          scratch.face_microtraction_values[slip_id_alpha][face_q_point] =
+            -microtraction * scratch.face_JxW_values[face_q_point];
+        }
+
+      for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+        for (const unsigned int i : slips_local_dofs[slip_id])
+          for (unsigned int face_q_point = 0;
+               face_q_point < scratch.n_face_q_points;
+               ++face_q_point)
+            data.local_dst_values(i) +=
+              fe_face_values.shape_value(i, face_q_point) *
+              scratch.face_microtraction_values[slip_id][face_q_point];
+    }
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::assemble_local_jacobian_tangent(
+  const typename dealii::DoFHandler<dim>::active_cell_iterator  &cell,
+  gCP::AssemblyData::Jacobian::Scratch<dim>                     &scratch,
+  gCP::AssemblyData::JacobianAction::Copy                       &data)
+{
+  LocalJacobianTangent &tangent =
+    local_jacobian_tangents[
+      get_locally_owned_cell_index(cell->active_cell_index())];
+
+  // Reset local data
+  data.local_dst_values = 0.0;
+
+  // Local to global indices mapping
+  cell->get_dof_indices(data.local_dof_indices);
+
+  // Update the hp::FEValues instance to the values of the current cell
+  scratch.hp_fe_values.reinit(cell);
+
+  const dealii::FEValues<dim> &fe_values =
+    scratch.hp_fe_values.get_present_fe_values();
+
+  // Get values of the slips at the quadrature points
+  evaluate_local_slips(cell,
+                       fe_values,
+                       trial_solution,
+                       scratch.local_dof_values,
+                       scratch.slip_values,
+                       &scratch.slip_gradient_values);
+
+  evaluate_local_slips(cell,
+                       fe_values,
+                       fe_field->old_solution,
+                       scratch.local_dof_values,
+                       scratch.old_slip_values);
+
+  // Get the crystal identifier for the current cell
+  const unsigned int crystal_id = cell->material_id();
+
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  // Get the moduli which are constant per crystal
+  scratch.stiffness_tetrad =
+    hooke_law->get_stiffness_tetrad(crystal_id);
+
+  const dealii::FullMatrix<double> &schmid_stiffness_schmid_contractions =
+    hooke_law->get_schmid_stiffness_schmid_contractions(crystal_id);
+
+  // Get JxW values at the quadrature points
+  scratch.JxW_values = fe_values.get_JxW_values();
+
+  // Local degrees of freedom grouped by their global component
+  const std::vector<unsigned int> &displacement_local_dofs =
+    fe_field->get_displacement_local_dofs(crystal_id);
+
+  const std::vector<std::vector<unsigned int>> &slips_local_dofs =
+    fe_field->get_slips_local_dofs(crystal_id);
+
+  // The jacobians of a linear vectorial microscopic stress law are
+  // constant per crystal and slip system and are used as they are.
+  // Otherwise they are computed at all quadrature points at once
+  const std::vector<dealii::SymmetricTensor<2,dim>> *quadratic_jacobians =
+    vectorial_microstress_law_is_linear() ?
+      &vectorial_microstress_law->get_quadratic_jacobians(crystal_id) :
+      nullptr;
+
+  if (quadratic_jacobians == nullptr)
+    vectorial_microstress_law->get_jacobians(
+      crystal_id,
+      scratch.slip_gradient_values,
+      scratch.vectorial_microstress_law_jacobian_values);
+
+  // Get the trial slip resistances at all quadrature points
+  const dealii::ArrayView<const double> slip_resistances =
+    quadrature_point_history.get_slip_resistances(
+      cell->active_cell_index(),
+      scratch.slip_values,
+      scratch.old_slip_values,
+      scratch.slip_resistance_values);
+
+  tangent.scalar_microstress_moduli.resize(
+    scratch.n_q_points * n_slips * n_slips);
+
+  // The jacobians of a linear vectorial microstress law are not stored
+  if (quadratic_jacobians != nullptr)
+    tangent.vectorial_microstress_moduli.clear();
+  else
+    tangent.vectorial_microstress_moduli.resize(
+      scratch.n_q_points * n_slips);
+
+  // Loop over quadrature points
+  for (unsigned int q_point = 0; q_point < scratch.n_q_points; ++q_point)
+  {
+    const double JxW_value = scratch.JxW_values[q_point];
+
+    // Compute the jacobian of the scalar microscopic
+    // stress w.r.t. slip at the current quadrature point
+    scalar_microstress_law->get_jacobian(
+      q_point,
+      scratch.slip_values,
+      scratch.old_slip_values,
+      dealii::ArrayView<const double>(
+        slip_resistances.data() + q_point * n_slips, n_slips),
+      discrete_time.get_next_step_size(),
+      scratch.scalar_microstress_law_jacobian_values[q_point]);
+
+    // Store the tangent moduli
+    for (unsigned int slip_id_alpha = 0;
+         slip_id_alpha < n_slips;
+         ++slip_id_alpha)
+    {
+      for (unsigned int slip_id_beta = 0;
+           slip_id_beta < n_slips;
+           ++slip_id_beta)
+        tangent.scalar_microstress_moduli[
+          (q_point * n_slips + slip_id_alpha) * n_slips + slip_id_beta] =
+            scratch.scalar_microstress_law_jacobian_values[q_point](
+              slip_id_alpha, slip_id_beta);
+
+      if (!tangent.vectorial_microstress_moduli.empty())
+        tangent.vectorial_microstress_moduli[q_point * n_slips +
+                                             slip_id_alpha] =
+          scratch.vectorial_microstress_law_jacobian_values[q_point][slip_id_alpha];
+    }
+
+    // Diagonal of the displacement-displacement block
+    for (const unsigned int i : displacement_local_dofs)
+    {
+      const dealii::SymmetricTensor<2,dim> sym_grad_vector_phi =
+        fe_values[fe_field->get_displacement_extractor(crystal_id)].symmetric_gradient(i,q_point);
+
+      data.local_dst_values(i) +=
+        sym_grad_vector_phi *
+        scratch.stiffness_tetrad *
+        sym_grad_vector_phi *
+        JxW_value;
+    }
+
+    // Diagonal of the slip-slip blocks
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+    {
+      const double slip_slip_coupling =
+        schmid_stiffness_schmid_contractions(slip_id, slip_id) +
+        scratch.scalar_microstress_law_jacobian_values[q_point](slip_id,
+                                                                slip_id);
+
+      const dealii::SymmetricTensor<2,dim> &vectorial_microstress_jacobian =
+        quadratic_jacobians != nullptr ?
+          (*quadratic_jacobians)[slip_id] :
+          scratch.vectorial_microstress_law_jacobian_values[q_point][slip_id];
+
+      for (const unsigned int i : slips_local_dofs[slip_id])
+      {
+        const double scalar_phi = fe_values.shape_value(i, q_point);
+
+        const dealii::Tensor<1,dim> grad_scalar_phi =
+          fe_values.shape_grad(i, q_point);
+
+        data.local_dst_values(i) +=
+          (grad_scalar_phi *
+           vectorial_microstress_jacobian *
+           grad_scalar_phi
+           +
+           scalar_phi * slip_slip_coupling * scalar_phi) *
+          JxW_value;
+      }
+    }
+  } // Loop over quadrature points
+
+  const bool flag_microtraction =
+    parameters.boundary_conditions_at_grain_boundaries ==
+      RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction;
+
+  tangent.macrotraction_moduli.clear();
+  tangent.intra_microtraction_moduli.clear();
+  tangent.inter_microtraction_moduli.clear();
+
+  if (!cell_is_at_grain_boundary(cell->active_cell_index()) ||
+      !(fe_field->is_decohesion_allowed() || flag_microtraction))
+    return;
+
+  // Grain boundary integrals
+  const dealii::ArrayView<const GrainBoundaryFace> grain_boundary_faces =
+    get_grain_boundary_faces(cell->active_cell_index());
+
+  const unsigned int n_face_values =
+    grain_boundary_faces.size() * scratch.n_face_q_points;
+
+  if (fe_field->is_decohesion_allowed())
+    tangent.macrotraction_moduli.resize(n_face_values);
+
+  if (flag_microtraction)
+  {
+    tangent.intra_microtraction_moduli.resize(
+      n_face_values * n_slips * n_slips);
+
+    tangent.inter_microtraction_moduli.resize(
+      n_face_values * n_slips * n_slips);
+  }
+
+  const RunTimeParameters::CohesiveLawParameters &cohesive_law_parameters =
+    parameters.constitutive_laws_parameters.cohesive_law_parameters;
+
+  for (unsigned int face_id = 0;
+       face_id < grain_boundary_faces.size();
+       ++face_id)
+  {
+    const GrainBoundaryFace &grain_boundary_face =
+      grain_boundary_faces[face_id];
+
+    const unsigned int face_offset = face_id * scratch.n_face_q_points;
+
+    // Update the hp::FEFaceValues instance to the values of the
+    // current face
+    scratch.hp_fe_face_values.reinit(cell, grain_boundary_face.face_index);
+
+    const dealii::FEFaceValues<dim> &fe_face_values =
+      scratch.hp_fe_face_values.get_present_fe_values();
+
+    // Get JxW values at the face quadrature points
+    scratch.face_JxW_values = fe_face_values.get_JxW_values();
+
+    // Get the internal variable values at the quadrature points
+    const dealii::ArrayView<InterfaceQuadraturePointHistory<dim>>
+      local_interface_quadrature_point_history =
+        interface_quadrature_point_history.get_data(
+          grain_boundary_face.interface_id);
+
+    if (fe_field->is_decohesion_allowed())
+    {
+      // Update the hp::FEFaceValues instance to the values of the
+      // neighbour face
+      scratch.neighbour_hp_fe_face_values.reinit(
+        grain_boundary_face.neighbour_cell,
+        grain_boundary_face.neighbour_face_index);
+
+      const dealii::FEFaceValues<dim> &neighbour_fe_face_values =
+        scratch.neighbour_hp_fe_face_values.get_present_fe_values();
+
+      // Get normal vector values values at the face quadrature points
+      scratch.normal_vector_values = fe_face_values.get_normal_vectors();
+
+      fe_face_values[
+        fe_field->get_displacement_extractor(crystal_id)].get_function_values(
+        trial_solution,
+        scratch.current_cell_displacement_values);
+
+      neighbour_fe_face_values[
+        fe_field->get_displacement_extractor(
+          grain_boundary_face.neighbour_crystal_id)].get_function_values(
+        trial_solution,
+        scratch.neighbor_cell_displacement_values);
+
+      // Gather the opening displacements and the history values of
+      // the face and evaluate the grain boundary laws at all its
+      // quadrature points at once
+      for (unsigned int face_q_point = 0;
+           face_q_point < scratch.n_face_q_points;
+           ++face_q_point)
+      {
+        scratch.opening_displacement_values[face_q_point] =
+          scratch.neighbor_cell_displacement_values[face_q_point] -
+          scratch.current_cell_displacement_values[face_q_point];
+
+        scratch.max_effective_opening_displacement_values[face_q_point] =
+          local_interface_quadrature_point_history[face_q_point].
+            get_max_effective_opening_displacement();
+
+        scratch.old_effective_opening_displacement_values[face_q_point] =
+          get_committed_interface_values(
+            grain_boundary_face.interface_id,
+            face_q_point).old_effective_opening_displacement;
+      }
+
+      cohesive_law->get_jacobians(
+        scratch.opening_displacement_values,
+        scratch.normal_vector_values,
+        scratch.max_effective_opening_displacement_values,
+        scratch.old_effective_opening_displacement_values,
+        discrete_time.get_next_step_size(),
+        scratch.cohesive_law_jacobian_values);
+
+      contact_law->get_jacobians(
+        scratch.opening_displacement_values,
+        scratch.normal_vector_values,
+        scratch.contact_law_jacobian_values);
+    }
+
+    // Loop over face quadrature points
+    for (unsigned int face_q_point = 0;
+         face_q_point < scratch.n_face_q_points;
+         ++face_q_point)
+    {
+      const double damage_variable =
+        fe_field->is_decohesion_allowed() ?
+          local_interface_quadrature_point_history[face_q_point].
+            get_damage_variable() : 0.0;
+
+      if (fe_field->is_decohesion_allowed())
+      {
+        const dealii::SymmetricTensor<2,dim> macrotraction_moduli =
+          cohesive_law->get_degradation_function_value(
+            damage_variable,
+            cohesive_law_parameters.flag_couple_macrotraction_to_damage) *
+          scratch.cohesive_law_jacobian_values[face_q_point]
+          +
+          scratch.contact_law_jacobian_values[face_q_point];
+
+        tangent.macrotraction_moduli[face_offset + face_q_point] =
+          macrotraction_moduli;
+
+        for (const unsigned int i : displacement_local_dofs)
+        {
+          const dealii::Tensor<1,dim> face_vector_phi =
+            fe_face_values[fe_field->get_displacement_extractor(
+              crystal_id)].value(i, face_q_point);
+
+          data.local_dst_values(i) +=
+            face_vector_phi *
+            macrotraction_moduli *
+            face_vector_phi *
+            scratch.face_JxW_values[face_q_point];
+        }
+      }
+
+      if (flag_microtraction)
+      {
+        const double degradation_function_value =
+          cohesive_law->get_degradation_function_value(
+            damage_variable,
+            cohesive_law_parameters.flag_couple_microtraction_to_damage);
+
+        scratch.intra_gateaux_derivative_values[face_q_point] =
+          microscopic_traction_law->get_intra_gateaux_derivative(
+            face_q_point,
+            grain_boundary_face.grain_interaction_moduli);
+
+        scratch.inter_gateaux_derivative_values[face_q_point] =
+          microscopic_traction_law->get_inter_gateaux_derivative(
+            face_q_point,
+            grain_boundary_face.grain_interaction_moduli);
+
+        for (unsigned int slip_id_alpha = 0;
+             slip_id_alpha < n_slips;
+             ++slip_id_alpha)
+          for (unsigned int slip_id_beta = 0;
+               slip_id_beta < n_slips;
+               ++slip_id_beta)
+          {
+            const std::size_t offset =
+              (static_cast<std::size_t>(face_offset + face_q_point) *
+                 n_slips + slip_id_alpha) * n_slips + slip_id_beta;
+
+            tangent.intra_microtraction_moduli[offset] =
+              degradation_function_value *
+              scratch.intra_gateaux_derivative_values[face_q_point](
+                slip_id_alpha, slip_id_beta);
+
+            tangent.inter_microtraction_moduli[offset] =
+              degradation_function_value *
+              scratch.inter_gateaux_derivative_values[face_q_point](
+                slip_id_alpha, slip_id_beta);
+          }
+
+        for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+          for (const unsigned int i : slips_local_dofs[slip_id])
+          {
+            const double face_scalar_phi =
+              fe_face_values.shape_value(i, face_q_point);
+
+            data.local_dst_values(i) -=
+              face_scalar_phi *
+              degradation_function_value *
+              scratch.intra_gateaux_derivative_values[face_q_point](
+                slip_id, slip_id) *
+              face_scalar_phi *
+              scratch.face_JxW_values[face_q_point];
+          }
+      }
+    } // Loop over face quadrature points
+  } // Loop over cell's faces
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::assemble_jacobi_preconditioner()
+{
+  if (parameters.verbose)
+    *pcout << std::setw(38) << std::left
+           << "  Solver: Assembling preconditioner...";
+
+  dealii::TimerOutput::Scope  t(*timer_output,
+                                "Solver: Preconditioner assembly");
+
+  const dealii::AffineConstraints<double> &newton_method_constraints =
+    fe_field->get_newton_method_constraints();
+
+  dealii::LinearAlgebraTrilinos::MPI::Vector &inverse_diagonal =
+    jacobi_preconditioner.get_vector();
+
+  // Reset data
+  inverse_diagonal.reinit(fe_field->distributed_vector);
+
+  // Set up the lambda function for the local assembly operation. Each
+  // entry of local_jacobian_tangents is only accessed by the worker of
+  // its cell
+  auto worker = [this](
+    const CellIterator                              &cell,
+    gCP::AssemblyData::Jacobian::Scratch<dim>       &scratch,
+    gCP::AssemblyData::JacobianAction::Copy         &data)
+  {
+    this->assemble_local_jacobian_tangent(cell, scratch, data);
+  };
+
+  // Set up the lambda function for the copy local to global operation
+  auto copier = [&newton_method_constraints, &inverse_diagonal](
+    const gCP::AssemblyData::JacobianAction::Copy   &data)
+  {
+    newton_method_constraints.distribute_local_to_global(
+      data.local_dst_values,
+      data.local_dof_indices,
+      inverse_diagonal);
+  };
+
+  // Define the update flags for the FEValues instances
+  const dealii::UpdateFlags update_flags =
+    dealii::update_JxW_values |
+    dealii::update_values |
+    dealii::update_gradients |
+    dealii::update_quadrature_points;
+
+  const dealii::UpdateFlags face_update_flags =
+    dealii::update_JxW_values |
+    dealii::update_normal_vectors |
+    dealii::update_values |
+    dealii::update_quadrature_points;
+
+  // Assemble using the WorkStream approach
+  dealii::WorkStream::run(
+    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
+               fe_field->get_dof_handler().begin_active()),
+    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
+               fe_field->get_dof_handler().end()),
+    worker,
+    copier,
+    gCP::AssemblyData::Jacobian::Scratch<dim>(
+      mapping_collection,
+      quadrature_collection,
+      face_quadrature_collection,
+      fe_field->get_fe_collection(),
+      update_flags,
+      face_update_flags,
+      crystals_data->get_n_slips()),
+    gCP::AssemblyData::JacobianAction::Copy(
+      fe_field->get_fe_collection().max_dofs_per_cell()));
+
+  // Compress global data
+  inverse_diagonal.compress(dealii::VectorOperation::add);
+
+  // Invert the diagonal. Constrained rows are identity rows of the
+  // operator, see apply_jacobian()
+  for (const auto locally_owned_dof :
+        inverse_diagonal.locally_owned_elements())
+  {
+    const double diagonal_entry = inverse_diagonal(locally_owned_dof);
+
+    if (newton_method_constraints.is_constrained(locally_owned_dof) ||
+        std::abs(diagonal_entry) < std::numeric_limits<double>::epsilon())
+      inverse_diagonal(locally_owned_dof) = 1.0;
+    else
+      inverse_diagonal(locally_owned_dof) = 1.0 / diagonal_entry;
+  }
+
+  inverse_diagonal.compress(dealii::VectorOperation::insert);
+
+  if (parameters.verbose)
+    *pcout << " done!" << std::endl;
+}
+
+
+
+template <int dim>
+double GradientCrystalPlasticitySolver<dim>::compute_matrix_free_jacobian_error(
+  const dealii::LinearAlgebraTrilinos::MPI::Vector &src)
+{
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The GradientCrystalPlasticitySolver<dim>"
+                                 " instance has not been initialized."));
+
+  AssertThrow(!parameters.krylov_parameters.flag_matrix_free,
+              dealii::ExcMessage("The Jacobian matrix is not assembled "
+                                 "in the matrix-free mode."));
+
+  // The data of the matrix-free mode is only allocated in init() if the
+  // mode is set. It is released again at the end
+  const bool flag_release_kernels = (displacement_kernels == nullptr);
+
+  if (flag_release_kernels)
+  {
+    setup_sum_factorization();
+
+    make_cell_batches();
+  }
+
+  local_jacobian_tangents.clear();
+
+  local_jacobian_tangents.resize(n_locally_owned_cells);
+
+  jacobi_preconditioner.reinit(fe_field->distributed_vector);
+
+  distributed_src.reinit(fe_field->distributed_vector);
+
+  ghost_src.reinit(fe_field->solution);
+
+  assemble_jacobian();
+
+  assemble_jacobi_preconditioner();
+
+  dealii::LinearAlgebraTrilinos::MPI::Vector
+    matrix_free_dst(fe_field->distributed_vector);
+
+  dealii::LinearAlgebraTrilinos::MPI::Vector
+    assembled_dst(fe_field->distributed_vector);
+
+  apply_jacobian(matrix_free_dst, src);
+
+  jacobian.vmult(assembled_dst, src);
+
+  fe_field->get_newton_method_constraints().set_zero(matrix_free_dst);
+
+  fe_field->get_newton_method_constraints().set_zero(assembled_dst);
+
+  const double assembled_norm = assembled_dst.l2_norm();
+
+  AssertThrow(assembled_norm > 0.0,
+              dealii::ExcMessage("The action of the assembled Jacobian "
+                                 "vanishes."));
+
+  assembled_dst -= matrix_free_dst;
+
+  const double relative_error = assembled_dst.l2_norm() / assembled_norm;
+
+  // Release the data of the matrix-free mode
+  local_jacobian_tangents.clear();
+
+  jacobi_preconditioner.clear();
+
+  distributed_src.clear();
+
+  ghost_src.clear();
+
+  if (flag_release_kernels)
+  {
+    displacement_kernels.reset();
+
+    slip_kernels.reset();
+
+    lexicographic_local_dofs.clear();
+
+    cell_batches.clear();
+
+    colored_cell_batches.clear();
+  }
+
+  // The Jacobian matrix corresponds to the current trial solution
+  // instead of the one the nonlinear solver last assembled it at
+  flag_refresh_jacobian       = true;
+
+  flag_refresh_preconditioner = true;
+
+  return (relative_error);
+}
+
+
+
+} // namespace gCP
+
+
+
+template void gCP::GradientCrystalPlasticitySolver<2>::apply_jacobian(
+  dealii::LinearAlgebraTrilinos::MPI::Vector        &,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector  &);
+template void gCP::GradientCrystalPlasticitySolver<3>::apply_jacobian(
+  dealii::LinearAlgebraTrilinos::MPI::Vector        &,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector  &);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::apply_local_jacobian(
+  const typename gCP::GradientCrystalPlasticitySolver<2>::CellBatch  &,
+  gCP::AssemblyData::JacobianAction::Scratch<2>                     &,
+  gCP::AssemblyData::CellBatchCopy<
+    gCP::AssemblyData::JacobianAction::Copy>                        &,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector                  &);
+template void gCP::GradientCrystalPlasticitySolver<3>::apply_local_jacobian(
+  const typename gCP::GradientCrystalPlasticitySolver<3>::CellBatch  &,
+  gCP::AssemblyData::JacobianAction::Scratch<3>                     &,
+  gCP::AssemblyData::CellBatchCopy<
+    gCP::AssemblyData::JacobianAction::Copy>                        &,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector                  &);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::apply_local_jacobian(
+  const typename dealii::DoFHandler<2>::active_cell_iterator  &,
+  const unsigned int                                          ,
+  gCP::AssemblyData::JacobianAction::Scratch<2>               &,
+  gCP::AssemblyData::JacobianAction::Copy                     &,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector            &);
+template void gCP::GradientCrystalPlasticitySolver<3>::apply_local_jacobian(
+  const typename dealii::DoFHandler<3>::active_cell_iterator  &,
+  const unsigned int                                          ,
+  gCP::AssemblyData::JacobianAction::Scratch<3>               &,
+  gCP::AssemblyData::JacobianAction::Copy                     &,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector            &);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::assemble_local_jacobian_tangent(
+  const typename dealii::DoFHandler<2>::active_cell_iterator  &,
+  gCP::AssemblyData::Jacobian::Scratch<2>                     &,
+  gCP::AssemblyData::JacobianAction::Copy                     &);
+template void gCP::GradientCrystalPlasticitySolver<3>::assemble_local_jacobian_tangent(
+  const typename dealii::DoFHandler<3>::active_cell_iterator  &,
+  gCP::AssemblyData::Jacobian::Scratch<3>                     &,
+  gCP::AssemblyData::JacobianAction::Copy                     &);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::assemble_jacobi_preconditioner();
+template void gCP::GradientCrystalPlasticitySolver<3>::assemble_jacobi_preconditioner();
+
+template double gCP::GradientCrystalPlasticitySolver<2>::
+compute_matrix_free_jacobian_error(
+  const dealii::LinearAlgebraTrilinos::MPI::Vector &);
+template double gCP::GradientCrystalPlasticitySolver<3>::
+compute_matrix_free_jacobian_error(
+  const dealii::LinearAlgebraTrilinos::MPI::Vector &);
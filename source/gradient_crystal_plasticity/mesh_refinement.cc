@@ -0,0 +1,597 @@
+#include <gCP/gradient_crystal_plasticity.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_tools.h>
+
+#include <deal.II/numerics/error_estimator.h>
+
+namespace gCP
+{
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::estimate_error(
+  dealii::Vector<float> &estimated_error_per_cell) const
+{
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The GradientCrystalPlasticitySolver<dim>"
+                                 " instance has not been initialized."));
+
+  dealii::TimerOutput::Scope  t(*timer_output,
+                                "Solver: Error estimation");
+
+  // Mask of the slips of all crystals
+  dealii::ComponentMask slips_mask(fe_field->get_n_components(), false);
+
+  for (unsigned int crystal_id = 0;
+       crystal_id < crystals_data->get_n_crystals();
+       ++crystal_id)
+    for (unsigned int slip_id = 0;
+         slip_id < crystals_data->get_n_slips();
+         ++slip_id)
+      slips_mask = slips_mask |
+        fe_field->get_fe_collection().component_mask(
+          fe_field->get_slip_extractor(crystal_id, slip_id));
+
+  estimated_error_per_cell.reinit(
+    fe_field->get_triangulation().n_active_cells());
+
+  dealii::KellyErrorEstimator<dim>::estimate(
+    mapping_collection,
+    fe_field->get_dof_handler(),
+    face_quadrature_collection,
+    std::map<dealii::types::boundary_id,
+             const dealii::Function<dim> *>(),
+    fe_field->solution,
+    estimated_error_per_cell,
+    slips_mask);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::prepare_for_coarsening_and_refinement(
+  dealii::parallel::distributed::Triangulation<dim> &triangulation,
+  const unsigned int                                max_level)
+{
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The GradientCrystalPlasticitySolver<dim>"
+                                 " instance has not been initialized."));
+
+  AssertThrow(&triangulation == &fe_field->get_triangulation(),
+              dealii::ExcMessage("The triangulation does not correspond "
+                                 "to the one of the FEField<dim> "
+                                 "instance."));
+
+  dealii::TimerOutput::Scope  t(*timer_output,
+                                "Solver: Prepare mesh refinement");
+
+  // The cells at both sides of a grain boundary are refined together
+  // and only coarsened together, also across the partition
+  Utilities::match_refinement_flags_at_grain_boundaries(triangulation,
+                                                        max_level);
+
+  // Projection of the slip resistances. The quadrature formula is the
+  // same for all crystals
+  const dealii::Quadrature<dim> &quadrature_formula =
+    quadrature_collection[0];
+
+  history_projection_fe =
+    std::make_unique<const dealii::FE_DGQ<dim>>(
+      fe_field->get_slips_fe_degree());
+
+  AssertThrow(history_projection_fe->n_dofs_per_cell() <=
+                quadrature_formula.size(),
+              dealii::ExcMessage("The quadrature formula has less points "
+                                 "than the projection space has degrees "
+                                 "of freedom."));
+
+  history_projection_matrix.reinit(history_projection_fe->n_dofs_per_cell(),
+                                   quadrature_formula.size());
+
+  dealii::FETools::compute_projection_from_quadrature_points_matrix(
+    *history_projection_fe,
+    quadrature_formula,
+    quadrature_formula,
+    history_projection_matrix);
+
+  history_interpolation_matrix.reinit(quadrature_formula.size(),
+                                      history_projection_fe->n_dofs_per_cell());
+
+  dealii::FETools::compute_interpolation_to_quadrature_points_matrix(
+    *history_projection_fe,
+    quadrature_formula,
+    history_interpolation_matrix);
+
+  // Projection of the internal variables of the cohesive law on the
+  // grain boundary faces
+  if (fe_field->is_decohesion_allowed())
+  {
+    const dealii::Quadrature<dim-1> &face_quadrature_formula =
+      face_quadrature_collection[0];
+
+    history_face_projection_fe =
+      std::make_unique<const dealii::FE_DGQ<dim-1>>(
+        fe_field->get_slips_fe_degree());
+
+    AssertThrow(history_face_projection_fe->n_dofs_per_cell() <=
+                  face_quadrature_formula.size(),
+                dealii::ExcMessage("The face quadrature formula has less "
+                                   "points than the projection space has "
+                                   "degrees of freedom."));
+
+    history_face_projection_matrix.reinit(
+      history_face_projection_fe->n_dofs_per_cell(),
+      face_quadrature_formula.size());
+
+    dealii::FETools::compute_projection_from_quadrature_points_matrix(
+      *history_face_projection_fe,
+      face_quadrature_formula,
+      face_quadrature_formula,
+      history_face_projection_matrix);
+
+    history_face_interpolation_matrix.reinit(
+      face_quadrature_formula.size(),
+      history_face_projection_fe->n_dofs_per_cell());
+
+    dealii::FETools::compute_interpolation_to_quadrature_points_matrix(
+      *history_face_projection_fe,
+      face_quadrature_formula,
+      history_face_interpolation_matrix);
+  }
+
+  // Attach the data
+  fe_field->prepare_for_coarsening_and_refinement();
+
+  serialized_quadrature_point_history.assign(
+    triangulation.n_active_cells(), std::vector<double>());
+
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned())
+      serialized_quadrature_point_history[cell->active_cell_index()] =
+        pack_local_quadrature_point_history(cell->active_cell_index());
+
+  cell_data_transfer =
+    std::make_unique<dealii::parallel::distributed::CellDataTransfer<
+      dim, dim, std::vector<std::vector<double>>>>(
+        triangulation,
+        /*transfer_variable_size_data=*/true,
+        [this](const typename dealii::Triangulation<dim>::cell_iterator &,
+               const std::vector<double> parent_values)
+        {
+          return (this->refine_local_quadrature_point_history(
+                    parent_values));
+        },
+        [this](const typename dealii::Triangulation<dim>::cell_iterator &,
+               const std::vector<std::vector<double>> &children_values)
+        {
+          return (this->coarsen_local_quadrature_point_history(
+                    children_values));
+        });
+
+  cell_data_transfer->prepare_for_coarsening_and_refinement(
+    serialized_quadrature_point_history);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::
+interpolate_after_coarsening_and_refinement()
+{
+  AssertThrow(flag_init_was_called,
+              dealii::ExcMessage("The GradientCrystalPlasticitySolver<dim>"
+                                 " instance has not been initialized."));
+
+  AssertThrow(cell_data_transfer != nullptr,
+              dealii::ExcMessage("The prepare_for_coarsening_and_refinement()"
+                                 " method has to be called before the "
+                                 "refinement."));
+
+  dealii::TimerOutput::Scope  t(*timer_output,
+                                "Solver: Interpolate after mesh refinement");
+
+  fe_field->interpolate_after_coarsening_and_refinement();
+
+  std::vector<std::vector<double>> transferred_quadrature_point_history(
+    fe_field->get_triangulation().n_active_cells());
+
+  cell_data_transfer->unpack(transferred_quadrature_point_history);
+
+  for (const auto &cell :
+        fe_field->get_triangulation().active_cell_iterators())
+    if (cell->is_locally_owned())
+      unpack_local_quadrature_point_history(
+        cell->active_cell_index(),
+        transferred_quadrature_point_history[cell->active_cell_index()]);
+
+  cell_data_transfer.reset();
+
+  serialized_quadrature_point_history.clear();
+
+  flag_refresh_jacobian       = true;
+
+  flag_refresh_preconditioner = true;
+}
+
+
+
+template <int dim>
+std::vector<std::vector<double>>
+GradientCrystalPlasticitySolver<dim>::refine_local_quadrature_point_history(
+  const std::vector<double> &parent_values) const
+{
+  const unsigned int n_children =
+    dealii::GeometryInfo<dim>::max_children_per_cell;
+
+  const unsigned int n_q_points = history_interpolation_matrix.m();
+
+  const unsigned int n_dofs = history_projection_matrix.m();
+
+  const unsigned int n_face_q_points =
+    face_quadrature_collection.max_n_quadrature_points();
+
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  const unsigned int n_packed_values =
+    InterfaceQuadraturePointHistory<dim>::n_packed_values;
+
+  std::vector<std::vector<double>> children_values(
+    n_children, std::vector<double>(n_q_points * n_slips));
+
+  // Slip resistances
+  dealii::Vector<double> parent_q_point_values(n_q_points);
+  dealii::Vector<double> parent_dof_values(n_dofs);
+  dealii::Vector<double> child_dof_values(n_dofs);
+  dealii::Vector<double> child_q_point_values(n_q_points);
+
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+  {
+    for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+      parent_q_point_values(q_point) =
+        parent_values[q_point * n_slips + slip_id];
+
+    history_projection_matrix.vmult(parent_dof_values,
+                                    parent_q_point_values);
+
+    for (unsigned int child = 0; child < n_children; ++child)
+    {
+      history_projection_fe->get_prolongation_matrix(child).vmult(
+        child_dof_values,
+        parent_dof_values);
+
+      history_interpolation_matrix.vmult(child_q_point_values,
+                                         child_dof_values);
+
+      for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+        children_values[child][q_point * n_slips + slip_id] =
+          child_q_point_values(q_point);
+    }
+  }
+
+  // Internal variables of the cohesive law. They are projected face-wise
+  // onto a discontinuous polynomial space and evaluated at the
+  // quadrature points of the faces of the children lying on the
+  // grain boundary face of the parent, i.e., its subfaces
+  if (fe_field->is_decohesion_allowed())
+  {
+    const unsigned int n_face_dofs = history_face_projection_matrix.m();
+
+    // The packed values at the quadrature points of each subface of
+    // each face of the parent
+    std::vector<std::vector<std::vector<double>>> subface_values(
+      dealii::GeometryInfo<dim>::faces_per_cell);
+
+    dealii::Vector<double> parent_face_q_point_values(n_face_q_points);
+    dealii::Vector<double> parent_face_dof_values(n_face_dofs);
+    dealii::Vector<double> subface_dof_values(n_face_dofs);
+    dealii::Vector<double> subface_q_point_values(n_face_q_points);
+
+    std::size_t position = n_q_points * n_slips;
+
+    for (unsigned int face_index = 0;
+         face_index < dealii::GeometryInfo<dim>::faces_per_cell;
+         ++face_index)
+      if (parent_values[position++] != 0.0)
+      {
+        subface_values[face_index].assign(
+          dealii::GeometryInfo<dim>::max_children_per_face,
+          std::vector<double>(n_face_q_points * n_packed_values));
+
+        for (unsigned int value_id = 0;
+             value_id < n_packed_values;
+             ++value_id)
+        {
+          for (unsigned int face_q_point = 0;
+               face_q_point < n_face_q_points; ++face_q_point)
+            parent_face_q_point_values(face_q_point) =
+              parent_values[position +
+                            face_q_point * n_packed_values +
+                            value_id];
+
+          history_face_projection_matrix.vmult(parent_face_dof_values,
+                                               parent_face_q_point_values);
+
+          for (unsigned int subface = 0;
+               subface < dealii::GeometryInfo<dim>::max_children_per_face;
+               ++subface)
+          {
+            history_face_projection_fe->get_prolongation_matrix(
+              subface).vmult(subface_dof_values,
+                             parent_face_dof_values);
+
+            history_face_interpolation_matrix.vmult(subface_q_point_values,
+                                                    subface_dof_values);
+
+            for (unsigned int face_q_point = 0;
+                 face_q_point < n_face_q_points; ++face_q_point)
+              subface_values[face_index][subface][
+                face_q_point * n_packed_values + value_id] =
+                  subface_q_point_values(face_q_point);
+          }
+        }
+
+        for (auto &values : subface_values[face_index])
+          InterfaceQuadraturePointHistory<dim>::bound_packed_values(values);
+
+        position += n_face_q_points * n_packed_values;
+      }
+
+    AssertDimension(position, parent_values.size());
+
+    for (unsigned int child = 0; child < n_children; ++child)
+      for (unsigned int face_index = 0;
+           face_index < dealii::GeometryInfo<dim>::faces_per_cell;
+           ++face_index)
+      {
+        unsigned int child_subface =
+          dealii::numbers::invalid_unsigned_int;
+
+        for (unsigned int subface = 0;
+             subface < dealii::GeometryInfo<dim>::max_children_per_face;
+             ++subface)
+          if (dealii::GeometryInfo<dim>::child_cell_on_face(
+                dealii::RefinementCase<dim>::isotropic_refinement,
+                face_index,
+                subface) == child)
+            child_subface = subface;
+
+        if (child_subface == dealii::numbers::invalid_unsigned_int ||
+            subface_values[face_index].empty())
+        {
+          children_values[child].push_back(0.0);
+
+          continue;
+        }
+
+        children_values[child].push_back(1.0);
+
+        children_values[child].insert(
+          children_values[child].end(),
+          subface_values[face_index][child_subface].begin(),
+          subface_values[face_index][child_subface].end());
+      }
+  }
+
+  return (children_values);
+}
+
+
+
+template <int dim>
+std::vector<double>
+GradientCrystalPlasticitySolver<dim>::coarsen_local_quadrature_point_history(
+  const std::vector<std::vector<double>> &children_values) const
+{
+  AssertDimension(children_values.size(),
+                  dealii::GeometryInfo<dim>::max_children_per_cell);
+
+  const unsigned int n_q_points = history_interpolation_matrix.m();
+
+  const unsigned int n_dofs = history_projection_matrix.m();
+
+  const unsigned int n_face_q_points =
+    face_quadrature_collection.max_n_quadrature_points();
+
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  const unsigned int n_packed_values =
+    InterfaceQuadraturePointHistory<dim>::n_packed_values;
+
+  std::vector<double> parent_values(n_q_points * n_slips);
+
+  // Slip resistances. The restriction matrices of discontinuous
+  // elements are additive
+  dealii::Vector<double> child_q_point_values(n_q_points);
+  dealii::Vector<double> child_dof_values(n_dofs);
+  dealii::Vector<double> parent_dof_values(n_dofs);
+  dealii::Vector<double> parent_q_point_values(n_q_points);
+
+  for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+  {
+    parent_dof_values = 0.0;
+
+    for (unsigned int child = 0; child < children_values.size(); ++child)
+    {
+      for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+        child_q_point_values(q_point) =
+          children_values[child][q_point * n_slips + slip_id];
+
+      history_projection_matrix.vmult(child_dof_values,
+                                      child_q_point_values);
+
+      history_projection_fe->get_restriction_matrix(child).vmult_add(
+        parent_dof_values,
+        child_dof_values);
+    }
+
+    history_interpolation_matrix.vmult(parent_q_point_values,
+                                       parent_dof_values);
+
+    for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+      parent_values[q_point * n_slips + slip_id] =
+        parent_q_point_values(q_point);
+  }
+
+  // Internal variables of the cohesive law. The values at the faces of
+  // the children lying on a grain boundary face of the parent are
+  // projected face-wise onto a discontinuous polynomial space, restricted
+  // to the face of the parent and evaluated at its quadrature points
+  if (fe_field->is_decohesion_allowed())
+  {
+    const unsigned int n_face_dofs = history_face_projection_matrix.m();
+
+    dealii::Vector<double> subface_q_point_values(n_face_q_points);
+    dealii::Vector<double> subface_dof_values(n_face_dofs);
+    dealii::Vector<double> parent_face_dof_values(n_face_dofs);
+    dealii::Vector<double> parent_face_q_point_values(n_face_q_points);
+
+    // The packed values of each face of each child
+    std::vector<std::vector<std::vector<double>>> children_face_values(
+      children_values.size(),
+      std::vector<std::vector<double>>(
+        dealii::GeometryInfo<dim>::faces_per_cell));
+
+    for (unsigned int child = 0; child < children_values.size(); ++child)
+    {
+      std::size_t position = n_q_points * n_slips;
+
+      for (unsigned int face_index = 0;
+           face_index < dealii::GeometryInfo<dim>::faces_per_cell;
+           ++face_index)
+        if (children_values[child][position++] != 0.0)
+        {
+          children_face_values[child][face_index].assign(
+            children_values[child].begin() + position,
+            children_values[child].begin() + position +
+              n_face_q_points * n_packed_values);
+
+          position += n_face_q_points * n_packed_values;
+        }
+
+      AssertDimension(position, children_values[child].size());
+    }
+
+    for (unsigned int face_index = 0;
+         face_index < dealii::GeometryInfo<dim>::faces_per_cell;
+         ++face_index)
+    {
+      // The children lying on the face, indexed by the subface
+      std::vector<unsigned int> subface_children(
+        dealii::GeometryInfo<dim>::max_children_per_face);
+
+      unsigned int n_subfaces_with_values = 0;
+
+      for (unsigned int subface = 0;
+           subface < dealii::GeometryInfo<dim>::max_children_per_face;
+           ++subface)
+      {
+        subface_children[subface] =
+          dealii::GeometryInfo<dim>::child_cell_on_face(
+            dealii::RefinementCase<dim>::isotropic_refinement,
+            face_index,
+            subface);
+
+        if (!children_face_values[subface_children[subface]][face_index].empty())
+          ++n_subfaces_with_values;
+      }
+
+      if (n_subfaces_with_values == 0)
+      {
+        parent_values.push_back(0.0);
+
+        continue;
+      }
+
+      AssertThrow(n_subfaces_with_values ==
+                    dealii::GeometryInfo<dim>::max_children_per_face,
+                  dealii::ExcMessage("The face of the parent lies only "
+                                     "partially at a grain boundary."));
+
+      parent_values.push_back(1.0);
+
+      std::vector<double> face_values(n_face_q_points * n_packed_values);
+
+      for (unsigned int value_id = 0; value_id < n_packed_values; ++value_id)
+      {
+        parent_face_dof_values = 0.0;
+
+        for (unsigned int subface = 0;
+             subface < dealii::GeometryInfo<dim>::max_children_per_face;
+             ++subface)
+        {
+          const std::vector<double> &values =
+            children_face_values[subface_children[subface]][face_index];
+
+          for (unsigned int face_q_point = 0;
+               face_q_point < n_face_q_points; ++face_q_point)
+            subface_q_point_values(face_q_point) =
+              values[face_q_point * n_packed_values + value_id];
+
+          history_face_projection_matrix.vmult(subface_dof_values,
+                                               subface_q_point_values);
+
+          history_face_projection_fe->get_restriction_matrix(
+            subface).vmult_add(parent_face_dof_values,
+                               subface_dof_values);
+        }
+
+        history_face_interpolation_matrix.vmult(parent_face_q_point_values,
+                                                parent_face_dof_values);
+
+        for (unsigned int face_q_point = 0;
+             face_q_point < n_face_q_points; ++face_q_point)
+          face_values[face_q_point * n_packed_values + value_id] =
+            parent_face_q_point_values(face_q_point);
+      }
+
+      InterfaceQuadraturePointHistory<dim>::bound_packed_values(face_values);
+
+      parent_values.insert(parent_values.end(),
+                           face_values.begin(),
+                           face_values.end());
+    }
+  }
+
+  return (parent_values);
+}
+
+
+
+} // namespace gCP
+
+
+
+template void gCP::GradientCrystalPlasticitySolver<2>::estimate_error(
+  dealii::Vector<float> &) const;
+template void gCP::GradientCrystalPlasticitySolver<3>::estimate_error(
+  dealii::Vector<float> &) const;
+
+template void gCP::GradientCrystalPlasticitySolver<2>::
+prepare_for_coarsening_and_refinement(
+  dealii::parallel::distributed::Triangulation<2> &,
+  const unsigned int);
+template void gCP::GradientCrystalPlasticitySolver<3>::
+prepare_for_coarsening_and_refinement(
+  dealii::parallel::distributed::Triangulation<3> &,
+  const unsigned int);
+
+template void gCP::GradientCrystalPlasticitySolver<2>::
+interpolate_after_coarsening_and_refinement();
+template void gCP::GradientCrystalPlasticitySolver<3>::
+interpolate_after_coarsening_and_refinement();
+
+template std::vector<std::vector<double>>
+gCP::GradientCrystalPlasticitySolver<2>::refine_local_quadrature_point_history(
+  const std::vector<double> &) const;
+template std::vector<std::vector<double>>
+gCP::GradientCrystalPlasticitySolver<3>::refine_local_quadrature_point_history(
+  const std::vector<double> &) const;
+
+template std::vector<double>
+gCP::GradientCrystalPlasticitySolver<2>::coarsen_local_quadrature_point_history(
+  const std::vector<std::vector<double>> &) const;
+template std::vector<double>
+gCP::GradientCrystalPlasticitySolver<3>::coarsen_local_quadrature_point_history(
+  const std::vector<std::vector<double>> &) const;
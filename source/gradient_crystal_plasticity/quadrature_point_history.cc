@@ -1,8 +1,15 @@
 
+#include <gCP/constitutive_laws.h>
 #include <gCP/quadrature_point_history.h>
+#include <gCP/utilities.h>
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/grid/filtered_iterator.h>
 
+#include <algorithm>
+
 namespace gCP
 {
 
@@ -41,59 +48,66 @@ void InterfaceData<dim>::update(
 
 
 
-template <int dim>
-InterfaceQuadraturePointHistory<dim>::InterfaceQuadraturePointHistory()
+HistoryBuffer::HistoryBuffer()
 :
-tangential_to_normal_stiffness_ratio(1.0),
-damage_accumulation_constant(1.0),
-damage_decay_constant(0.0),
-damage_decay_exponent(1.0),
-endurance_limit(0.0),
-damage_variable(0.0),
-max_effective_opening_displacement(0.0),
-old_effective_opening_displacement(0.0),
-tmp_scalar_values(2),
-effective_opening_displacement(0.0),
-normal_opening_displacement(0.0),
-tangential_opening_displacement(0.0),
-effective_cohesive_traction(0.0),
-flag_init_was_called(false)
+precision(RunTimeParameters::HistoryStoragePrecision::Double),
+fixed_point_resolution(1e-6)
 {}
 
 
 
-template <int dim>
-void InterfaceQuadraturePointHistory<dim>::init(
-  const RunTimeParameters::CohesiveLawParameters &parameters)
+void HistoryBuffer::reinit(
+  const std::size_t                                 n_values,
+  const RunTimeParameters::HistoryStoragePrecision  precision,
+  const double                                      fixed_point_resolution)
 {
-  if (flag_init_was_called)
-    return;
+  AssertThrow(fixed_point_resolution > 0.0,
+              dealii::ExcMessage(
+                "The resolution of the fixed-point format has to be "
+                "bigger than zero."));
 
-  critical_cohesive_traction =
-    parameters.critical_cohesive_traction;
+  this->precision               = precision;
 
-  critical_opening_displacement =
-    parameters.critical_opening_displacement;
+  this->fixed_point_resolution  = fixed_point_resolution;
 
-  tangential_to_normal_stiffness_ratio =
-    parameters.tangential_to_normal_stiffness_ratio;
+  // Zero is represented exactly in all formats
+  if (is_compressed())
+  {
+    std::vector<double>().swap(values);
 
-  damage_accumulation_constant =
-    parameters.damage_accumulation_constant;
-
-  damage_decay_constant   = parameters.damage_decay_constant;
+    codes.assign(n_values, encode(0.0));
+  }
+  else
+  {
+    values.assign(n_values, 0.0);
 
-  damage_decay_exponent   = parameters.damage_decay_exponent;
+    std::vector<std::int32_t>().swap(codes);
+  }
+}
 
-  endurance_limit         = parameters.endurance_limit;
 
-  flag_set_damage_to_zero = parameters.flag_set_damage_to_zero;
 
-  flag_init_was_called    = true;
+std::size_t HistoryBuffer::memory_consumption() const
+{
+  return (dealii::MemoryConsumption::memory_consumption(values) +
+          dealii::MemoryConsumption::memory_consumption(codes));
 }
 
 
 
+template <int dim>
+InterfaceQuadraturePointHistory<dim>::InterfaceQuadraturePointHistory()
+:
+damage_variable(0.0),
+max_effective_opening_displacement(0.0),
+effective_opening_displacement(0.0),
+normal_opening_displacement(0.0),
+tangential_opening_displacement(0.0),
+effective_cohesive_traction(0.0)
+{}
+
+
+
 template <int dim>
 void InterfaceQuadraturePointHistory<dim>::set(
   const double damage_variable_value)
@@ -104,184 +118,144 @@ void InterfaceQuadraturePointHistory<dim>::set(
 
 
 template <int dim>
-void InterfaceQuadraturePointHistory<dim>::store_current_values()
+typename InterfaceQuadraturePointHistory<dim>::CommittedValues
+InterfaceQuadraturePointHistory<dim>::get_values_to_commit(
+  const CommittedValues &committed_values) const
 {
-  tmp_scalar_values[0]  = damage_variable;
-  tmp_scalar_values[1]  = max_effective_opening_displacement;
+  CommittedValues values_to_commit = committed_values;
+
+  values_to_commit.damage_variable                    = damage_variable;
+
+  values_to_commit.max_effective_opening_displacement =
+    max_effective_opening_displacement;
 
-  flag_values_were_updated = false;
+  return (values_to_commit);
 }
 
 
 
 template <int dim>
-void InterfaceQuadraturePointHistory<dim>::reset_values()
+void InterfaceQuadraturePointHistory<dim>::pack_values(
+  std::vector<double>    &values,
+  const CommittedValues  &committed_values) const
 {
-  damage_variable                     = tmp_scalar_values[0];
-
-  max_effective_opening_displacement  = tmp_scalar_values[1];
+  values.push_back(damage_variable);
+  values.push_back(max_effective_opening_displacement);
+  values.push_back(committed_values.old_effective_opening_displacement);
 }
 
 
 
 template <int dim>
-void InterfaceQuadraturePointHistory<dim>::update_values(
-  const dealii::Tensor<1,dim> neighbor_cell_displacement,
-  const dealii::Tensor<1,dim> current_cell_displacement)
+typename InterfaceQuadraturePointHistory<dim>::CommittedValues
+InterfaceQuadraturePointHistory<dim>::unpack_values(
+  const dealii::ArrayView<const double> values)
 {
-  /*if (flag_values_were_updated)
-    return;*/
-
-  damage_variable                     = tmp_scalar_values[0];
-  max_effective_opening_displacement  = tmp_scalar_values[1];
-
-  const dealii::Tensor<1,dim> displacement_jump =
-    neighbor_cell_displacement - current_cell_displacement;
+  AssertDimension(values.size(), n_packed_values);
 
-  max_effective_opening_displacement =
-    std::max(max_effective_opening_displacement,
-             displacement_jump.norm());
-
-  const double displacement_ratio =
-     max_effective_opening_displacement / critical_opening_displacement;
-
-  damage_variable =
-    1.0 - (1.0 + displacement_ratio) * std::exp(-displacement_ratio);
-
-  if (flag_set_damage_to_zero)
-    damage_variable = 0.0;
+  damage_variable                     = values[0];
+  max_effective_opening_displacement  = values[1];
 
-  flag_values_were_updated = true;
+  return (CommittedValues{values[0], values[1], values[2]});
 }
 
 
-/*
+
 template <int dim>
-void InterfaceQuadraturePointHistory<dim>::update_values(
-  const double  effective_opening_displacement,
-  const double  cohesive_traction_norm)
+void InterfaceQuadraturePointHistory<dim>::bound_packed_values(
+  std::vector<double> &values)
 {
-  damage_variable                     = tmp_scalar_values[0];
-  max_effective_opening_displacement  = tmp_scalar_values[1];
+  Assert(values.size() % n_packed_values == 0,
+         dealii::ExcMessage("The size of the vector is not a multiple "
+                            "of the number of packed values."));
+
+  for (std::size_t i = 0; i < values.size(); i += n_packed_values)
+  {
+    values[i]     = std::min(std::max(values[i], 0.0), 1.0);
+    values[i + 1] = std::max(values[i + 1], 0.0);
+    values[i + 2] = std::max(values[i + 2], 0.0);
+  }
+}
 
-  max_effective_opening_displacement =
-    std::max(max_effective_opening_displacement,
-             effective_opening_displacement);
 
-  damage_variable +=
-    damage_accumulation_constant *
-    macaulay_brackets(effective_opening_displacement -
-                      old_effective_opening_displacement) *
-    std::pow(1.0 - damage_variable + damage_decay_constant,
-     damage_decay_exponent) *
-    (cohesive_traction_norm - endurance_limit);
 
-  if (flag_set_damage_to_zero)
-    damage_variable = 0.0;
+template <int dim>
+void InterfaceQuadraturePointHistory<dim>::reset_values(
+  const CommittedValues &committed_values)
+{
+  damage_variable                     = committed_values.damage_variable;
 
-  flag_values_were_updated = true;
-}*/
+  max_effective_opening_displacement  =
+    committed_values.max_effective_opening_displacement;
+}
 
 
 
 template <int dim>
 void InterfaceQuadraturePointHistory<dim>::update_values(
-  const double  effective_opening_displacement)
+  const dealii::Tensor<1,dim>               neighbor_cell_displacement,
+  const dealii::Tensor<1,dim>               current_cell_displacement,
+  const CommittedValues                     &committed_values,
+  const ConstitutiveLaws::CohesiveLaw<dim>  &cohesive_law)
 {
-  damage_variable                     = tmp_scalar_values[0];
-  max_effective_opening_displacement  = tmp_scalar_values[1];
+  const dealii::Tensor<1,dim> displacement_jump =
+    neighbor_cell_displacement - current_cell_displacement;
 
   max_effective_opening_displacement =
-    std::max(max_effective_opening_displacement,
-             effective_opening_displacement);
+    std::max(committed_values.max_effective_opening_displacement,
+             displacement_jump.norm());
 
-  flag_values_were_updated = true;
+  damage_variable =
+    cohesive_law.get_damage_variable(max_effective_opening_displacement);
 }
 
 
 
 template <int dim>
 void InterfaceQuadraturePointHistory<dim>::update_values(
-  const double  effective_opening_displacement,
-  const double  thermodynamic_force)
+  const double                              effective_opening_displacement,
+  const CommittedValues                     &committed_values)
 {
-  damage_variable                     = tmp_scalar_values[0];
-  max_effective_opening_displacement  = tmp_scalar_values[1];
+  damage_variable = committed_values.damage_variable;
 
   max_effective_opening_displacement =
-    std::max(max_effective_opening_displacement,
+    std::max(committed_values.max_effective_opening_displacement,
              effective_opening_displacement);
-
-  damage_variable +=
-    damage_accumulation_constant *
-    macaulay_brackets(effective_opening_displacement -
-                      old_effective_opening_displacement) *
-    std::pow(1.0 - damage_variable + damage_decay_constant,
-     damage_decay_exponent) *
-    (thermodynamic_force - endurance_limit);
-
-  if (damage_variable > 1.0)
-    damage_variable = 1.0;
-
-  if (flag_set_damage_to_zero)
-    damage_variable = 0.0;
-
-  flag_values_were_updated = true;
 }
 
 
 
 template <int dim>
-void InterfaceQuadraturePointHistory<dim>::store_effective_opening_displacement(
-  const dealii::Tensor<1,dim> current_cell_displacement,
-  const dealii::Tensor<1,dim> neighbor_cell_displacement,
-  const dealii::Tensor<1,dim> normal_vector)
+void InterfaceQuadraturePointHistory<dim>::update_values(
+  const double                              effective_opening_displacement,
+  const double                              thermodynamic_force,
+  const CommittedValues                     &committed_values,
+  const ConstitutiveLaws::CohesiveLaw<dim>  &cohesive_law)
 {
-  /*if (flag_values_were_updated)
-    return;*/
-
-  // Define projectors
-  dealii::SymmetricTensor<2,dim> normal_projector =
-    dealii::symmetrize(dealii::outer_product(normal_vector,
-                                             normal_vector));
-
-  dealii::SymmetricTensor<2,dim> tangential_projector =
-    dealii::unit_symmetric_tensor<dim>() - normal_projector;
-
-  // Compute opening displacement
-  dealii::Tensor<1,dim> opening_displacement =
-    neighbor_cell_displacement - current_cell_displacement;
-
-  // Compute normal and tangential components
-  double normal_opening_displacement =
-    (normal_projector * opening_displacement).norm();
-
-  double tangential_opening_displacement =
-    (tangential_projector * opening_displacement).norm();
+  max_effective_opening_displacement =
+    std::max(committed_values.max_effective_opening_displacement,
+             effective_opening_displacement);
 
-  // Compute effective opening displacements (Needed for the next
-  // pseudo-time iteration)
-  old_effective_opening_displacement =
-     std::sqrt(macaulay_brackets(normal_opening_displacement) *
-               macaulay_brackets(normal_opening_displacement)
-               +
-               tangential_to_normal_stiffness_ratio *
-               tangential_to_normal_stiffness_ratio *
-               tangential_opening_displacement *
-               tangential_opening_displacement);
+  damage_variable =
+    cohesive_law.get_damage_variable(
+      committed_values.damage_variable,
+      effective_opening_displacement,
+      committed_values.old_effective_opening_displacement,
+      thermodynamic_force);
 }
 
 
 
 template <int dim>
-void InterfaceQuadraturePointHistory<dim>::store_effective_opening_displacement(
-  const dealii::Tensor<1,dim> current_cell_displacement,
-  const dealii::Tensor<1,dim> neighbor_cell_displacement,
-  const dealii::Tensor<1,dim> normal_vector,
-  const double                effective_cohesive_traction)
+double InterfaceQuadraturePointHistory<dim>::store_effective_opening_displacement(
+  const dealii::Tensor<1,dim>               current_cell_displacement,
+  const dealii::Tensor<1,dim>               neighbor_cell_displacement,
+  const dealii::Tensor<1,dim>               normal_vector,
+  const double                              effective_cohesive_traction,
+  const ConstitutiveLaws::CohesiveLaw<dim>  &cohesive_law)
 {
-  /*if (flag_values_were_updated)
-    return;*/
+  const double tangential_to_normal_stiffness_ratio =
+    cohesive_law.get_tangential_to_normal_stiffness_ratio();
 
   // Define projectors
   dealii::SymmetricTensor<2,dim> normal_projector =
@@ -304,7 +278,7 @@ void InterfaceQuadraturePointHistory<dim>::store_effective_opening_displacement(
 
   // Compute effective opening displacements (Needed for the next
   // pseudo-time iteration)
-  old_effective_opening_displacement =
+  const double old_effective_opening_displacement =
      std::sqrt(macaulay_brackets(normal_opening_displacement) *
                macaulay_brackets(normal_opening_displacement)
                +
@@ -320,37 +294,84 @@ void InterfaceQuadraturePointHistory<dim>::store_effective_opening_displacement(
   this->tangential_opening_displacement = tangential_opening_displacement;
 
   this->effective_cohesive_traction = effective_cohesive_traction;
+
+  return (old_effective_opening_displacement);
 }
 
 
 
 template <int dim>
-QuadraturePointHistory<dim>::QuadraturePointHistory()
+QuadraturePointHistoryStorage<dim>::QuadraturePointHistoryStorage()
 :
+n_cells(0),
+n_q_points(0),
+n_slips(0),
+committed_buffer_id(0),
+epoch(0),
 flag_init_was_called(false)
 {}
 
 
 
 template <int dim>
-void QuadraturePointHistory<dim>::init(
+void QuadraturePointHistoryStorage<dim>::initialize(
   const RunTimeParameters::ScalarMicroscopicStressLawParameters
     &parameters,
-  const unsigned int n_slips)
+  const dealii::Triangulation<dim> &triangulation,
+  const unsigned int n_q_points,
+  const unsigned int n_slips,
+  const RunTimeParameters::HistoryStoragePrecision precision,
+  const double fixed_point_resolution)
 {
-  this->n_slips             = n_slips;
+  Assert(n_q_points > 0,
+         dealii::ExcMessage(
+           "The number of quadrature points per cell has to be bigger "
+           "than zero."));
+
+  // Dense numbering of the locally owned cells
+  local_cell_indices.assign(triangulation.n_active_cells(),
+                            dealii::numbers::invalid_unsigned_int);
 
-  initial_slip_resistance   = parameters.initial_slip_resistance;
+  n_cells                   = 0;
+
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned())
+      local_cell_indices[cell->active_cell_index()] = n_cells++;
+
+  this->n_q_points          = n_q_points;
+
+  this->n_slips             = n_slips;
 
   linear_hardening_modulus  = parameters.linear_hardening_modulus;
 
   hardening_parameter       = parameters.hardening_parameter;
 
-  slip_resistances          = std::vector<double>(
-                                n_slips,
-                                0.0 /*initial_slip_resistance*/);
+  const std::size_t n_values =
+    static_cast<std::size_t>(n_cells) * n_q_points * n_slips;
+
+  // Only the committed values are stored if they are compressed. In
+  // double precision the buffer stays empty
+  compressed_buffer.reinit(
+    precision != RunTimeParameters::HistoryStoragePrecision::Double ?
+      n_values : 0,
+    precision,
+    fixed_point_resolution);
+
+  for (auto &buffer : buffers)
+    if (is_compressed())
+      std::vector<double>().swap(buffer);
+    else
+      buffer.assign(n_values, 0.0 /*initial_slip_resistance*/);
 
-  tmp_slip_resistances      = slip_resistances;
+  committed_buffer_id       = 0;
+
+  epoch                     = 0;
+
+  // The epochs are only needed to track the trial values
+  if (is_compressed())
+    std::vector<unsigned int>().swap(cell_epochs);
+  else
+    cell_epochs.assign(n_cells, dealii::numbers::invalid_unsigned_int);
 
   flag_init_was_called      = true;
 }
@@ -358,105 +379,321 @@ void QuadraturePointHistory<dim>::init(
 
 
 template <int dim>
-void QuadraturePointHistory<dim>::store_current_values()
+void QuadraturePointHistoryStorage<dim>::set_slip_resistances(
+  const unsigned int                      cell_index,
+  const unsigned int                      q_point,
+  const dealii::ArrayView<const double>   slip_resistances)
 {
-  tmp_slip_resistances = slip_resistances;
+  AssertDimension(slip_resistances.size(), n_slips);
+
+  const std::size_t offset = get_offset(cell_index, q_point);
+
+  if (is_compressed())
+  {
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+      compressed_buffer.set(offset + slip_id, slip_resistances[slip_id]);
+
+    return;
+  }
+
+  for (auto &buffer : buffers)
+    std::copy(slip_resistances.begin(),
+              slip_resistances.end(),
+              buffer.begin() + offset);
+
+  cell_epochs[get_local_cell_index(cell_index)] =
+    dealii::numbers::invalid_unsigned_int;
 }
 
 
 
 template <int dim>
-void QuadraturePointHistory<dim>::reset_values()
+void QuadraturePointHistoryStorage<dim>::store_current_values()
 {
-  slip_resistances = tmp_slip_resistances;
+  // The compressed values are committed by commit_values()
+  if (is_compressed())
+    return;
+
+  const std::size_t n_values_per_cell =
+    static_cast<std::size_t>(n_q_points) * n_slips;
+
+  std::vector<double> &committed_buffer = buffers[committed_buffer_id];
+
+  std::vector<double> &trial_buffer = buffers[1 - committed_buffer_id];
+
+  // The trial buffer becomes the committed one. Cells which were not
+  // updated during the current epoch and whose buffers differ have
+  // their committed values copied into it beforehand
+  dealii::parallel::apply_to_subranges(
+    0U,
+    n_cells,
+    [&](const unsigned int begin, const unsigned int end)
+    {
+      for (unsigned int local_cell_index = begin;
+           local_cell_index < end;
+           ++local_cell_index)
+        if (cell_epochs[local_cell_index] != epoch &&
+            cell_epochs[local_cell_index] !=
+              dealii::numbers::invalid_unsigned_int)
+        {
+          std::copy_n(
+            committed_buffer.begin() + local_cell_index * n_values_per_cell,
+            n_values_per_cell,
+            trial_buffer.begin() + local_cell_index * n_values_per_cell);
+
+          cell_epochs[local_cell_index] =
+            dealii::numbers::invalid_unsigned_int;
+        }
+    },
+    /* grainsize */ 1024);
+
+  committed_buffer_id = 1 - committed_buffer_id;
+
+  // Start a new epoch. The cells updated during the previous one keep
+  // its value, flagging that their buffers now hold different values
+  start_new_epoch();
 }
 
 
 
 template <int dim>
-void QuadraturePointHistory<dim>::update_values(
+void QuadraturePointHistoryStorage<dim>::reset_values()
+{
+  // There are no trial values to reset if the committed values are
+  // compressed
+  if (is_compressed())
+    return;
+
+  start_new_epoch();
+}
+
+
+
+template <int dim>
+std::size_t QuadraturePointHistoryStorage<dim>::memory_consumption() const
+{
+  return (dealii::MemoryConsumption::memory_consumption(buffers) +
+          compressed_buffer.memory_consumption() +
+          dealii::MemoryConsumption::memory_consumption(cell_epochs) +
+          dealii::MemoryConsumption::memory_consumption(local_cell_indices));
+}
+
+
+
+template <int dim>
+void QuadraturePointHistoryStorage<dim>::start_new_epoch()
+{
+  ++epoch;
+
+  AssertThrow(epoch != dealii::numbers::invalid_unsigned_int,
+              dealii::ExcMessage("The epoch counter overflowed."));
+}
+
+
+
+template <int dim>
+void QuadraturePointHistoryStorage<dim>::update_values(
+  const unsigned int                      cell_index,
   const unsigned int                      q_point,
   const std::vector<std::vector<double>>  &slips,
   const std::vector<std::vector<double>>  &old_slips)
 {
-  slip_resistances = tmp_slip_resistances;
+  // The trial values are computed on demand if the committed values
+  // are compressed
+  if (is_compressed())
+    return;
 
-  for (unsigned int slip_id_alpha = 0;
-        slip_id_alpha < n_slips;
-        ++slip_id_alpha)
-    for (unsigned int slip_id_beta = 0;
-          slip_id_beta < n_slips;
-          ++slip_id_beta)
-      slip_resistances[slip_id_alpha] +=
-        get_hardening_matrix_entry(slip_id_alpha == slip_id_beta) *
-        std::fabs(slips[slip_id_beta][q_point] -
-                  old_slips[slip_id_beta][q_point]);
+  cell_epochs[get_local_cell_index(cell_index)] = epoch;
+
+  double *const trial_values =
+    buffers[1 - committed_buffer_id].data() +
+      get_offset(cell_index, q_point);
+
+  dispatch_compute_trial_values(
+    cell_index,
+    q_point,
+    slips,
+    old_slips,
+    [trial_values](const unsigned int slip_id, const double value)
+    {
+      trial_values[slip_id] = value;
+    });
 }
 
 
 
-template <typename CellIteratorType, typename DataType>
-std::vector<std::shared_ptr<DataType>>
-InterfaceDataStorage<CellIteratorType, DataType>::get_data(
-  const dealii::CellId current_cell_id,
-  const dealii::CellId neighbour_cell_id)
+template <int dim>
+dealii::ArrayView<const double>
+QuadraturePointHistoryStorage<dim>::get_slip_resistances(
+  const unsigned int                      cell_index,
+  const std::vector<std::vector<double>>  &slips,
+  const std::vector<std::vector<double>>  &old_slips,
+  std::vector<double>                     &slip_resistances) const
 {
-  std::pair<dealii::CellId, dealii::CellId> key;
+  if (!is_compressed())
+    return (get_slip_resistances(cell_index));
+
+  slip_resistances.resize(static_cast<std::size_t>(n_q_points) * n_slips);
+
+  for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+  {
+    double *const trial_values =
+      slip_resistances.data() + q_point * n_slips;
+
+    dispatch_compute_trial_values(
+      cell_index,
+      q_point,
+      slips,
+      old_slips,
+      [trial_values](const unsigned int slip_id, const double value)
+      {
+        trial_values[slip_id] = value;
+      });
+  }
+
+  return (dealii::make_array_view(slip_resistances));
+}
 
-  if (current_cell_id < neighbour_cell_id)
-    key =
-      std::make_pair(current_cell_id, neighbour_cell_id);
-  else
-    key =
-      std::make_pair(neighbour_cell_id, current_cell_id);
 
-  Assert(map.find(key) != map.end(),
-         dealii::ExcMessage(
-           "The dealii::CellId pair does not correspond "
-           "to a pair at the interface."));
 
-  return map[key];
+template <int dim>
+void QuadraturePointHistoryStorage<dim>::commit_values(
+  const unsigned int                      cell_index,
+  const unsigned int                      q_point,
+  const std::vector<std::vector<double>>  &slips,
+  const std::vector<std::vector<double>>  &old_slips)
+{
+  Assert(is_compressed(),
+         dealii::ExcMessage("The values are committed by "
+                            "store_current_values() in double "
+                            "precision."));
+
+  const std::size_t offset = get_offset(cell_index, q_point);
+
+  // A trial value only depends on the committed value of its own slip
+  // system, which is read before the former is set, i.e., the committed
+  // values can be overwritten in place
+  dispatch_compute_trial_values(
+    cell_index,
+    q_point,
+    slips,
+    old_slips,
+    [this, offset](const unsigned int slip_id, const double value)
+    {
+      compressed_buffer.set(offset + slip_id, value);
+    });
 }
 
 
 
-template <typename CellIteratorType, typename DataType>
-std::vector<std::shared_ptr<const DataType>>
-InterfaceDataStorage<CellIteratorType, DataType>::get_data(
-  const dealii::CellId current_cell_id,
-  const dealii::CellId neighbour_cell_id) const
+template <int dim>
+template <typename TrialValueSetter>
+void QuadraturePointHistoryStorage<dim>::dispatch_compute_trial_values(
+  const unsigned int                      cell_index,
+  const unsigned int                      q_point,
+  const std::vector<std::vector<double>>  &slips,
+  const std::vector<std::vector<double>>  &old_slips,
+  const TrialValueSetter                  &set_trial_value) const
 {
-  std::pair<dealii::CellId, dealii::CellId> key;
+  Utilities::dispatch_n_slips(
+    n_slips,
+    [&](const auto n_slips_at_compile_time)
+    {
+      this->template compute_trial_values<
+        decltype(n_slips_at_compile_time)::value>(
+          cell_index,
+          q_point,
+          slips,
+          old_slips,
+          set_trial_value);
+    });
+}
 
-  if (current_cell_id < neighbour_cell_id)
-    key =
-      std::make_pair(current_cell_id, neighbour_cell_id);
-  else
-    key =
-      std::make_pair(neighbour_cell_id, current_cell_id);
 
-  Assert(map.find(key) != map.end(),
-         dealii::ExcMessage(
-           "The dealii::CellId pair does not correspond "
-           "to a pair at the interface."));
 
-  const auto it = map.find(key);
+template <int dim>
+template <unsigned int n_slips_at_compile_time, typename TrialValueSetter>
+void QuadraturePointHistoryStorage<dim>::compute_trial_values(
+  const unsigned int                      cell_index,
+  const unsigned int                      q_point,
+  const std::vector<std::vector<double>>  &slips,
+  const std::vector<std::vector<double>>  &old_slips,
+  const TrialValueSetter                  &set_trial_value) const
+{
+  const unsigned int n_slip_systems =
+    (n_slips_at_compile_time > 0) ? n_slips_at_compile_time : n_slips;
+
+  AssertDimension(n_slip_systems, n_slips);
+
+  // The absolute slip increments are computed once per slip system if
+  // their number is known at compile time
+  std::array<double, std::max(n_slips_at_compile_time, 1U)> slip_increments;
+
+  if constexpr (n_slips_at_compile_time > 0)
+    for (unsigned int slip_id = 0;
+         slip_id < n_slips_at_compile_time;
+         ++slip_id)
+      slip_increments[slip_id] =
+        std::fabs(slips[slip_id][q_point] - old_slips[slip_id][q_point]);
+
+  auto get_slip_increment = [&](const unsigned int slip_id)
+  {
+    if constexpr (n_slips_at_compile_time > 0)
+      return (slip_increments[slip_id]);
+    else
+      return (std::fabs(slips[slip_id][q_point] -
+                        old_slips[slip_id][q_point]));
+  };
+
+  for (unsigned int slip_id_alpha = 0;
+        slip_id_alpha < n_slip_systems;
+        ++slip_id_alpha)
+  {
+    double trial_value =
+      get_committed_slip_resistance(cell_index, q_point, slip_id_alpha);
 
+    for (unsigned int slip_id_beta = 0;
+          slip_id_beta < n_slip_systems;
+          ++slip_id_beta)
+      trial_value +=
+        get_hardening_matrix_entry(slip_id_alpha == slip_id_beta) *
+        get_slip_increment(slip_id_beta);
 
-  const unsigned int n_face_q_points = it->second.size();
+    set_trial_value(slip_id_alpha, trial_value);
+  }
+}
 
-  std::vector<std::shared_ptr<const DataType>> tmp(n_face_q_points);
 
-  for (unsigned int face_q_point = 0;
-        face_q_point < n_face_q_points; ++face_q_point)
-    tmp[face_q_point] =
-      std::dynamic_pointer_cast<const DataType>(it->second[face_q_point]);
 
-  return tmp;
+template <typename CellIteratorType, typename DataType>
+unsigned int
+InterfaceDataStorage<CellIteratorType, DataType>::get_face_id(
+  const dealii::CellId current_cell_id,
+  const dealii::CellId neighbour_cell_id) const
+{
+  const auto it =
+    face_ids.find(get_key(current_cell_id, neighbour_cell_id));
+
+  AssertThrow(it != face_ids.end(),
+              dealii::ExcMessage(
+                "The dealii::CellId pair does not correspond "
+                "to a pair at the interface."));
+
+  return (it->second);
 }
 
 
 
+template <typename CellIteratorType, typename DataType>
+dealii::ArrayView<DataType>
+InterfaceDataStorage<CellIteratorType, DataType>::get_data(
+  const dealii::CellId current_cell_id,
+  const dealii::CellId neighbour_cell_id)
+{
+  return (get_data(get_face_id(current_cell_id, neighbour_cell_id)));
+}
+
+
 
 } // namespace gCP
 
@@ -473,9 +710,9 @@ template class
 gCP::InterfaceQuadraturePointHistory<3>;
 
 template class
-gCP::QuadraturePointHistory<2>;
+gCP::QuadraturePointHistoryStorage<2>;
 template class
-gCP::QuadraturePointHistory<3>;
+gCP::QuadraturePointHistoryStorage<3>;
 
 
 template class
@@ -1,5 +1,9 @@
 #include <gCP/gradient_crystal_plasticity.h>
 
+#include <deal.II/base/graph_coloring.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/dofs/dof_tools.h>
 #include <deal.II/dofs/dof_renumbering.h>
 
@@ -9,6 +13,8 @@
 
 #include <deal.II/numerics/data_out.h>
 
+#include <algorithm>
+
 namespace gCP
 {
 
@@ -37,31 +43,80 @@ void GradientCrystalPlasticitySolver<dim>::init()
   initial_trial_solution.reinit(fe_field->solution);
   tmp_trial_solution.reinit(fe_field->solution);
   newton_update.reinit(fe_field->solution);
-  residual.reinit(fe_field->distributed_vector);
-  cell_is_at_grain_boundary.reinit(
-    fe_field->get_triangulation().n_active_cells());
+
+  // In the colored assembly the worker threads write into the rows of
+  // the locally relevant degrees of freedom concurrently, which
+  // requires the vectors to have a separate storage for them
+  if (parameters.flag_colored_assembly)
+  {
+    residual.reinit(fe_field->get_locally_owned_dofs(),
+                    fe_field->get_locally_relevant_dofs(),
+                    MPI_COMM_WORLD,
+                    true);
+    nonlinear_residual.reinit(fe_field->get_locally_owned_dofs(),
+                              fe_field->get_locally_relevant_dofs(),
+                              MPI_COMM_WORLD,
+                              true);
+  }
+  else
+  {
+    residual.reinit(fe_field->distributed_vector);
+    nonlinear_residual.reinit(fe_field->distributed_vector);
+  }
+
+  linear_residual.reinit(fe_field->distributed_vector);
+  linear_residual_increment.reinit(fe_field->distributed_vector);
 
   trial_solution            = 0.0;
   initial_trial_solution    = 0.0;
   tmp_trial_solution        = 0.0;
   newton_update             = 0.0;
   residual                  = 0.0;
-  cell_is_at_grain_boundary = 0.0;
+  nonlinear_residual        = 0.0;
+  linear_residual           = 0.0;
+  linear_residual_increment = 0.0;
 
-  // Identify which cells are located at a grain boundary
-  for (const auto &cell :
-       fe_field->get_dof_handler().active_cell_iterators())
-    if (cell->is_locally_owned())
-      for (const auto &face_index : cell->face_indices())
-        if (!cell->face(face_index)->at_boundary() &&
-            cell->material_id() !=
-              cell->neighbor(face_index)->material_id())
-        {
-          cell_is_at_grain_boundary(cell->active_cell_index()) = 1.0;
-          break;
-        }
+  make_locally_owned_cell_indices();
+
+  // Identify the faces at the grain boundaries
+  make_grain_boundary_faces();
+
+  if (parameters.boundary_conditions_at_grain_boundaries ==
+        RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction)
+    make_grain_interaction_moduli();
+
+  // The matrix-free application of the Jacobian is always
+  // sum-factorized
+  if (parameters.flag_sum_factorization ||
+      parameters.krylov_parameters.flag_matrix_free)
+    setup_sum_factorization();
+
+  // Initiate the cache of the local Jacobians. The local matrices are
+  // only allocated once the corresponding cell is assembled
+  local_jacobian_cache.clear();
 
-  // Initiate Jacobian matrix
+  if (parameters.flag_cache_local_jacobians)
+    local_jacobian_cache.resize(n_locally_owned_cells);
+
+  // Initiate Jacobian matrix. In the matrix-free mode only the
+  // diagonal used by the Jacobi preconditioner and the tangent moduli
+  // at the quadrature points are stored. The latter are allocated
+  // once the corresponding cell is assembled
+  if (parameters.krylov_parameters.flag_matrix_free)
+  {
+    jacobian.clear();
+
+    jacobi_preconditioner.reinit(fe_field->distributed_vector);
+
+    distributed_src.reinit(fe_field->distributed_vector);
+
+    ghost_src.reinit(fe_field->solution);
+
+    local_jacobian_tangents.clear();
+
+    local_jacobian_tangents.resize(n_locally_owned_cells);
+  }
+  else
   {
     jacobian.clear();
 
@@ -100,6 +155,12 @@ void GradientCrystalPlasticitySolver<dim>::init()
     jacobian.reinit(sparsity_pattern);
   }
 
+  // A factorization of a previous Jacobian does not fit the current
+  // degrees of freedom
+  direct_solver.reset();
+
+  flag_refresh_preconditioner = true;
+
   // Initiate constitutive laws
   hooke_law->init();
 
@@ -126,8 +187,11 @@ void GradientCrystalPlasticitySolver<dim>::init()
   // Set-up memberes related to the L2 projection of the damage variable
   {
     // The FE collection consists of a single second order
-    // Lagrange-Element
-    projection_fe_collection.push_back(dealii::FE_Q<dim>(2));
+    // Lagrange-Element. It is only built in the first call, i.e.,
+    // subsequent ones after a refinement only redistribute the
+    // degrees of freedom
+    if (projection_fe_collection.size() == 0)
+      projection_fe_collection.push_back(dealii::FE_Q<dim>(2));
 
     // Distribute degrees of freedom based on the defined finite elements
     projection_dof_handler.reinit(fe_field->get_triangulation());
@@ -173,14 +237,57 @@ void GradientCrystalPlasticitySolver<dim>::init()
                                       true);
     }
 
+    // The coloring of the projection's cells is needed by the
+    // following assembly
+    if (parameters.flag_colored_assembly)
+      make_cell_coloring();
+
     assemble_projection_matrix();
   } // End of set-up memberes related to the L2 projection of the
     // damage variable
 
+  // The batches of the colored assembly are made from the colors
+  if (parameters.flag_sum_factorization ||
+      parameters.krylov_parameters.flag_matrix_free)
+    make_cell_batches();
+
   flag_init_was_called = true;
 
   if (parameters.verbose)
     *pcout << " done!" << std::endl;
+
+  // Report the traversal of the assemblies. The timer sections
+  // "Solver: Colored ... assembly on ... threads" and "Solver: Serial
+  // copier ... assembly on ... threads" of runs with different number
+  // of threads can then be set in relation to it
+  if (parameters.flag_colored_assembly)
+  {
+    std::vector<unsigned int> color_sizes;
+
+    for (const auto &color : colored_cells)
+      color_sizes.push_back(color.size());
+
+    *pcout
+      << "  Solver: Colored assembly with " << colored_cells.size()
+      << " colors (";
+
+    if (!color_sizes.empty())
+      *pcout
+        << *std::min_element(color_sizes.begin(), color_sizes.end())
+        << " to "
+        << *std::max_element(color_sizes.begin(), color_sizes.end())
+        << " ";
+
+    *pcout
+      << "cells per color) on "
+      << dealii::MultithreadInfo::n_threads() << " threads"
+      << std::endl;
+  }
+  else
+    *pcout
+      << "  Solver: Serial copier assembly on "
+      << dealii::MultithreadInfo::n_threads() << " threads"
+      << std::endl;
 }
 
 
@@ -283,23 +390,24 @@ void GradientCrystalPlasticitySolver<dim>::make_sparsity_pattern(
             (fe_field->is_decohesion_allowed() ||
               parameters.boundary_conditions_at_grain_boundaries ==
                 RunTimeParameters::BoundaryConditionsAtGrainBoundaries::Microtraction))
-          for (const auto &face_index : cell->face_indices())
-            if (!cell->face(face_index)->at_boundary() &&
-                cell->material_id() !=
-                  cell->neighbor(face_index)->material_id())
+          for (const auto &grain_boundary_face :
+               get_grain_boundary_faces(cell->active_cell_index()))
             {
+              const auto &neighbour_cell =
+                grain_boundary_face.neighbour_cell;
+
               AssertThrow(
-                cell->neighbor(face_index)->active_fe_index() ==
-                  cell->neighbor(face_index)->material_id(),
+                neighbour_cell->active_fe_index() ==
+                  neighbour_cell->material_id(),
                 dealii::ExcMessage(
                   "The active finite element index and the material "
                   " identifier of the cell have to coincide!"));
 
               const unsigned int n_dofs_on_neighbour_cell =
-               cell->neighbor(face_index)->get_fe().n_dofs_per_cell();
+               neighbour_cell->get_fe().n_dofs_per_cell();
               dof_indices_on_neighbour_cell.resize(
                 n_dofs_on_neighbour_cell);
-              cell->neighbor(face_index)->get_dof_indices(
+              neighbour_cell->get_dof_indices(
                 dof_indices_on_neighbour_cell);
 
               fe_field->get_newton_method_constraints().add_entries_local_to_global(
@@ -313,6 +421,361 @@ void GradientCrystalPlasticitySolver<dim>::make_sparsity_pattern(
 
 
 
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::make_locally_owned_cell_indices()
+{
+  locally_owned_cell_indices.assign(
+    fe_field->get_triangulation().n_active_cells(),
+    dealii::numbers::invalid_unsigned_int);
+
+  n_locally_owned_cells = 0;
+
+  for (const auto &cell :
+       fe_field->get_triangulation().active_cell_iterators())
+    if (cell->is_locally_owned())
+      locally_owned_cell_indices[cell->active_cell_index()] =
+        n_locally_owned_cells++;
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::make_grain_boundary_faces()
+{
+  grain_boundary_faces.clear();
+
+  grain_boundary_faces_offsets.assign(
+    fe_field->get_triangulation().n_active_cells() + 1, 0);
+
+  cell_is_at_grain_boundary.reinit(
+    fe_field->get_triangulation().n_active_cells());
+
+  // The active cell iterators traverse the cells in ascending order
+  // of their active cell index
+  for (const auto &cell :
+       fe_field->get_dof_handler().active_cell_iterators())
+  {
+    if (cell->is_locally_owned())
+      for (const auto &face_index : cell->face_indices())
+        if (!cell->face(face_index)->at_boundary() &&
+            cell->material_id() !=
+              cell->neighbor(face_index)->material_id())
+        {
+          AssertThrow(cell->neighbor(face_index)->is_active() &&
+                        !cell->neighbor_is_coarser(face_index),
+                      dealii::ExcMessage(
+                        "The grain boundaries have to be conforming, "
+                        "i.e., hanging nodes at them are not supported."));
+
+          GrainBoundaryFace grain_boundary_face;
+
+          grain_boundary_face.cell                  = cell;
+          grain_boundary_face.face_index            = face_index;
+          grain_boundary_face.neighbour_cell        =
+            cell->neighbor(face_index);
+          grain_boundary_face.neighbour_face_index  =
+            cell->neighbor_of_neighbor(face_index);
+          grain_boundary_face.neighbour_crystal_id  =
+            cell->neighbor(face_index)->active_fe_index();
+
+          grain_boundary_faces.push_back(grain_boundary_face);
+
+          cell_is_at_grain_boundary(cell->active_cell_index()) = 1.0;
+        }
+
+    grain_boundary_faces_offsets[cell->active_cell_index() + 1] =
+      grain_boundary_faces.size();
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::make_grain_interaction_moduli()
+{
+  // The faces are independent of each other and are therefore
+  // processed in parallel, each subrange with its own
+  // hp::FEFaceValues instance
+  dealii::parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(grain_boundary_faces.size()),
+    [this](const unsigned int begin, const unsigned int end)
+    {
+      dealii::hp::FEFaceValues<dim> hp_fe_face_values(
+        mapping_collection,
+        fe_field->get_fe_collection(),
+        face_quadrature_collection,
+        dealii::update_normal_vectors);
+
+      for (unsigned int i = begin; i < end; ++i)
+      {
+        GrainBoundaryFace &grain_boundary_face = grain_boundary_faces[i];
+
+        hp_fe_face_values.reinit(grain_boundary_face.cell,
+                                 grain_boundary_face.face_index);
+
+        grain_boundary_face.grain_interaction_moduli =
+          microscopic_traction_law->get_grain_interaction_moduli(
+            grain_boundary_face.cell->material_id(),
+            grain_boundary_face.neighbour_crystal_id,
+            hp_fe_face_values.get_present_fe_values().get_normal_vectors());
+      }
+    },
+    16);
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::setup_sum_factorization()
+{
+  const dealii::Quadrature<dim> &quadrature_formula =
+    quadrature_collection[0];
+
+  AssertThrow(quadrature_collection.size() == 1 &&
+              quadrature_formula.is_tensor_product(),
+              dealii::ExcMessage("The sum factorization requires a single "
+                                 "tensor-product quadrature formula."));
+
+  const dealii::Quadrature<1> &quadrature_formula_1d =
+    quadrature_formula.get_tensor_basis()[0];
+
+  for (unsigned int d = 1; d < dim; ++d)
+    AssertThrow(quadrature_formula.get_tensor_basis()[d].size() ==
+                  quadrature_formula_1d.size(),
+                dealii::ExcMessage("The sum factorization requires the "
+                                   "same quadrature formula in each "
+                                   "direction."));
+
+  // All crystals share the finite elements of the displacement and of
+  // the slips, see FEField<dim>::setup_dofs()
+  displacement_kernels =
+    std::make_unique<const TensorProductKernels<dim, VectorizedArrayType>>(
+      dealii::FE_Q<dim>(fe_field->get_displacement_fe_degree()),
+      quadrature_formula_1d);
+
+  slip_kernels =
+    std::make_unique<const TensorProductKernels<dim, VectorizedArrayType>>(
+      dealii::FE_Q<dim>(fe_field->get_slips_fe_degree()),
+      quadrature_formula_1d);
+
+  const dealii::hp::FECollection<dim> &fe_collection =
+    fe_field->get_fe_collection();
+
+  const unsigned int n_slips = crystals_data->get_n_slips();
+
+  lexicographic_local_dofs.assign(
+    fe_collection.size(),
+    std::vector<std::vector<unsigned int>>(dim + n_slips));
+
+  for (unsigned int crystal_id = 0;
+       crystal_id < fe_collection.size();
+       ++crystal_id)
+  {
+    for (unsigned int component = 0; component < dim + n_slips; ++component)
+      lexicographic_local_dofs[crystal_id][component].assign(
+        (component < dim ? displacement_kernels : slip_kernels)->
+          n_dofs_per_cell(),
+        dealii::numbers::invalid_unsigned_int);
+
+    // The base elements are either FE_Q or FE_Nothing. The latter have
+    // no degrees of freedom, i.e., every local degree of freedom
+    // belongs to a FE_Q base element
+    for (unsigned int i = 0;
+         i < fe_collection[crystal_id].n_dofs_per_cell();
+         ++i)
+    {
+      const unsigned int component =
+        fe_field->get_global_component(crystal_id, i);
+
+      const unsigned int base_index =
+        fe_collection[crystal_id].system_to_component_index(i).second;
+
+      const TensorProductKernels<dim, VectorizedArrayType> &kernels =
+        component < dim ? *displacement_kernels : *slip_kernels;
+
+      lexicographic_local_dofs[crystal_id][component][
+        kernels.get_lexicographic_numbering()[base_index]] = i;
+    }
+
+    for (const auto &component_local_dofs :
+          lexicographic_local_dofs[crystal_id])
+      AssertThrow(
+        std::find(component_local_dofs.begin(),
+                  component_local_dofs.end(),
+                  dealii::numbers::invalid_unsigned_int) ==
+          component_local_dofs.end(),
+        dealii::ExcMessage("The local degrees of freedom do not match "
+                           "the sum-factorized kernels."));
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::make_cell_batches()
+{
+  using CellIterator =
+    typename dealii::DoFHandler<dim>::active_cell_iterator;
+
+  const unsigned int n_lanes = VectorizedArrayType::size();
+
+  // Groups the cells crystal by crystal into batches of at most n_lanes
+  // cells
+  auto make_batches =
+    [this, n_lanes](const std::vector<CellIterator> &cells,
+                    std::vector<CellBatch>          &batches)
+  {
+    std::vector<std::vector<CellIterator>> crystal_cells(
+      crystals_data->get_n_crystals());
+
+    for (const auto &cell : cells)
+    {
+      AssertIndexRange(cell->material_id(), crystal_cells.size());
+
+      crystal_cells[cell->material_id()].push_back(cell);
+    }
+
+    batches.clear();
+
+    for (const auto &cells_of_crystal : crystal_cells)
+      for (unsigned int i = 0; i < cells_of_crystal.size(); i += n_lanes)
+      {
+        CellBatch cell_batch;
+
+        cell_batch.cells.assign(
+          cells_of_crystal.begin() + i,
+          cells_of_crystal.begin() +
+            std::min<std::size_t>(i + n_lanes, cells_of_crystal.size()));
+
+        batches.push_back(std::move(cell_batch));
+      }
+  };
+
+  std::vector<CellIterator> locally_owned_cells;
+
+  for (const auto &cell :
+       fe_field->get_dof_handler().active_cell_iterators())
+    if (cell->is_locally_owned())
+      locally_owned_cells.push_back(cell);
+
+  make_batches(locally_owned_cells, cell_batches);
+
+  // Cells of the same color do not conflict, i.e., neither do batches
+  // made of them
+  colored_cell_batches.clear();
+
+  if (parameters.flag_colored_assembly)
+  {
+    colored_cell_batches.resize(colored_cells.size());
+
+    for (unsigned int color = 0; color < colored_cells.size(); ++color)
+      make_batches(colored_cells[color], colored_cell_batches[color]);
+  }
+}
+
+
+
+template <int dim>
+void GradientCrystalPlasticitySolver<dim>::make_cell_coloring()
+{
+  using CellFilter =
+    dealii::FilteredIterator<
+      typename dealii::DoFHandler<dim>::active_cell_iterator>;
+
+  // Converts the colored filtered iterators into plain ones
+  auto store_coloring =
+    [](const std::vector<std::vector<CellFilter>> &coloring,
+       std::vector<std::vector<
+         typename dealii::DoFHandler<dim>::active_cell_iterator>>
+                                                  &cell_colors)
+  {
+    cell_colors.clear();
+
+    cell_colors.resize(coloring.size());
+
+    for (unsigned int color = 0; color < coloring.size(); ++color)
+      cell_colors[color].assign(coloring[color].begin(),
+                                coloring[color].end());
+  };
+
+  // Coloring of the DoFHandler of the FEField<dim> instance
+  {
+    const dealii::AffineConstraints<double> &newton_method_constraints =
+      fe_field->get_newton_method_constraints();
+
+    auto get_conflict_indices =
+      [this, &newton_method_constraints](const CellFilter &cell)
+    {
+      std::vector<dealii::types::global_dof_index> conflict_indices(
+        cell->get_fe().n_dofs_per_cell());
+
+      cell->get_dof_indices(conflict_indices);
+
+      // The cells at the grain boundaries are coupled to their
+      // neighbours through the face integrals
+      std::vector<dealii::types::global_dof_index>
+        neighbour_dof_indices;
+
+      for (const auto &grain_boundary_face :
+           get_grain_boundary_faces(cell->active_cell_index()))
+      {
+        neighbour_dof_indices.resize(
+          grain_boundary_face.neighbour_cell->get_fe().n_dofs_per_cell());
+
+        grain_boundary_face.neighbour_cell->get_dof_indices(
+          neighbour_dof_indices);
+
+        conflict_indices.insert(conflict_indices.end(),
+                                neighbour_dof_indices.begin(),
+                                neighbour_dof_indices.end());
+      }
+
+      // The contributions of constrained degrees of freedom are
+      // distributed to the ones they are constrained to
+      newton_method_constraints.resolve_indices(conflict_indices);
+
+      return (conflict_indices);
+    };
+
+    store_coloring(
+      dealii::GraphColoring::make_graph_coloring(
+        CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
+                   fe_field->get_dof_handler().begin_active()),
+        CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
+                   fe_field->get_dof_handler().end()),
+        get_conflict_indices),
+      colored_cells);
+  }
+
+  // Coloring of the DoFHandler of the L2 projection
+  {
+    auto get_conflict_indices = [this](const CellFilter &cell)
+    {
+      std::vector<dealii::types::global_dof_index> conflict_indices(
+        cell->get_fe().n_dofs_per_cell());
+
+      cell->get_dof_indices(conflict_indices);
+
+      projection_hanging_node_constraints.resolve_indices(
+        conflict_indices);
+
+      return (conflict_indices);
+    };
+
+    store_coloring(
+      dealii::GraphColoring::make_graph_coloring(
+        CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
+                   projection_dof_handler.begin_active()),
+        CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
+                   projection_dof_handler.end()),
+        get_conflict_indices),
+      colored_projection_cells);
+  }
+}
+
+
+
 template <int dim>
 void GradientCrystalPlasticitySolver<dim>::init_quadrature_point_history()
 {
@@ -327,97 +790,53 @@ void GradientCrystalPlasticitySolver<dim>::init_quadrature_point_history()
     face_quadrature_collection.max_n_quadrature_points();
 
   quadrature_point_history.initialize(
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               fe_field->get_dof_handler().begin_active()),
-    CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
-               fe_field->get_dof_handler().end()),
-    n_q_points);
-
+    parameters.constitutive_laws_parameters.scalar_microstress_law_parameters,
+    fe_field->get_triangulation(),
+    n_q_points,
+    crystals_data->get_n_slips(),
+    parameters.history_storage_precision,
+    parameters.history_fixed_point_resolution);
+
+  // The committed interface values are stored in the same format as
+  // the slip resistances
   interface_quadrature_point_history.initialize(
     CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
                fe_field->get_dof_handler().begin_active()),
     CellFilter(dealii::IteratorFilters::LocallyOwnedCell(),
                fe_field->get_dof_handler().end()),
-    n_face_q_points);
+    n_face_q_points,
+    InterfaceQuadraturePointHistory<dim>::n_committed_values,
+    parameters.history_storage_precision,
+    parameters.history_fixed_point_resolution);
+
+  // Set the identifiers of the grain boundary faces and select one
+  // face per identifier
+  interface_grain_boundary_faces.assign(
+    interface_quadrature_point_history.n_faces(),
+    dealii::numbers::invalid_unsigned_int);
+
+  for (unsigned int i = 0; i < grain_boundary_faces.size(); ++i)
+  {
+    GrainBoundaryFace &grain_boundary_face = grain_boundary_faces[i];
 
-  const dealii::UpdateFlags face_update_flags =
-    dealii::update_quadrature_points;
+    grain_boundary_face.interface_id =
+      interface_quadrature_point_history.get_face_id(
+        grain_boundary_face.cell->id(),
+        grain_boundary_face.neighbour_cell->id());
 
-  // Finite element values
-  dealii::hp::FEFaceValues<dim> hp_fe_face_values(
-    mapping_collection,
-    fe_field->get_fe_collection(),
-    face_quadrature_collection,
-    face_update_flags);
+    AssertIndexRange(grain_boundary_face.interface_id,
+                     interface_grain_boundary_faces.size());
 
-  for (const auto &cell : fe_field->get_triangulation().active_cell_iterators())
-    if (cell->is_locally_owned())
-    {
-      const std::vector<std::shared_ptr<QuadraturePointHistory<dim>>>
-        local_quadrature_point_history =
-          quadrature_point_history.get_data(cell);
-
-      Assert(local_quadrature_point_history.size() == n_q_points,
-              dealii::ExcInternalError());
-
-      for (unsigned int q_point = 0;
-            q_point < n_q_points;
-            ++q_point)
-        local_quadrature_point_history[q_point]->init(
-          parameters.constitutive_laws_parameters.scalar_microstress_law_parameters,
-          crystals_data->get_n_slips());
-
-      if (cell_is_at_grain_boundary(cell->active_cell_index()) &&
-          fe_field->is_decohesion_allowed())
-        for (const auto &face_index : cell->face_indices())
-          if (!cell->face(face_index)->at_boundary() &&
-              cell->material_id() !=
-                cell->neighbor(face_index)->material_id())
-          {
-            // Update the hp::FEFaceValues instance to the values of the current cell
-            hp_fe_face_values.reinit(cell, face_index);
-
-            const dealii::FEFaceValues<dim> &fe_face_values =
-              hp_fe_face_values.get_present_fe_values();
-
-            const std::vector<dealii::Point<dim>> quadrature_points =
-              fe_face_values.get_quadrature_points();
-
-            const std::vector<std::shared_ptr<InterfaceQuadraturePointHistory<dim>>>
-              local_interface_quadrature_point_history =
-                interface_quadrature_point_history.get_data(
-                  cell->id(),
-                  cell->neighbor(face_index)->id());
-
-            Assert(local_interface_quadrature_point_history.size() ==
-                     n_face_q_points,
-                   dealii::ExcInternalError());
-
-            for (unsigned int face_q_point = 0;
-                  face_q_point < n_face_q_points; ++face_q_point)
-            {
-              local_interface_quadrature_point_history[face_q_point]->init(
-                parameters.constitutive_laws_parameters.cohesive_law_parameters);
-              /*
-              const dealii::Point<dim> quadrature_point =
-                quadrature_points[face_q_point];
-
-              bool condition =
-                quadrature_point[0] > 2.0 &&
-                quadrature_point[0] < 2.5 &&
-                quadrature_point[1] > 2.59808 && //2.59808 &&
-                quadrature_point[1] < 3.4641;
-
-              if (condition)
-              {
-                local_interface_quadrature_point_history[face_q_point]->set(
-                  1.0);
-              }
-              */
-            }
-          }
+    if (interface_grain_boundary_faces[grain_boundary_face.interface_id] ==
+          dealii::numbers::invalid_unsigned_int)
+      interface_grain_boundary_faces[grain_boundary_face.interface_id] = i;
+  }
 
-    }
+  Assert(std::find(interface_grain_boundary_faces.begin(),
+                   interface_grain_boundary_faces.end(),
+                   dealii::numbers::invalid_unsigned_int) ==
+           interface_grain_boundary_faces.end(),
+         dealii::ExcInternalError());
 }
 
 
@@ -519,6 +938,24 @@ template void
 gCP::GradientCrystalPlasticitySolver<3>::make_sparsity_pattern(
    dealii::TrilinosWrappers::SparsityPattern &);
 
+template void gCP::GradientCrystalPlasticitySolver<2>::make_locally_owned_cell_indices();
+template void gCP::GradientCrystalPlasticitySolver<3>::make_locally_owned_cell_indices();
+
+template void gCP::GradientCrystalPlasticitySolver<2>::make_grain_boundary_faces();
+template void gCP::GradientCrystalPlasticitySolver<3>::make_grain_boundary_faces();
+
+template void gCP::GradientCrystalPlasticitySolver<2>::make_grain_interaction_moduli();
+template void gCP::GradientCrystalPlasticitySolver<3>::make_grain_interaction_moduli();
+
+template void gCP::GradientCrystalPlasticitySolver<2>::setup_sum_factorization();
+template void gCP::GradientCrystalPlasticitySolver<3>::setup_sum_factorization();
+
+template void gCP::GradientCrystalPlasticitySolver<2>::make_cell_batches();
+template void gCP::GradientCrystalPlasticitySolver<3>::make_cell_batches();
+
+template void gCP::GradientCrystalPlasticitySolver<2>::make_cell_coloring();
+template void gCP::GradientCrystalPlasticitySolver<3>::make_cell_coloring();
+
 template void gCP::GradientCrystalPlasticitySolver<2>::init_quadrature_point_history();
 template void gCP::GradientCrystalPlasticitySolver<3>::init_quadrature_point_history();
 
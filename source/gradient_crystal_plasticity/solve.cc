@@ -1,5 +1,8 @@
 #include <gCP/gradient_crystal_plasticity.h>
 
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_gmres.h>
+
 #include <deal.II/numerics/data_out.h>
 
 namespace gCP
@@ -7,6 +10,55 @@ namespace gCP
 
 
 
+namespace
+{
+
+
+
+  /*!
+   * @brief Calls @p solve and aborts with a message on the standard
+   * error stream if it throws
+   */
+  template <typename SolveFunction>
+  void run_linear_solver(const SolveFunction &solve)
+  {
+    try
+    {
+      solve();
+    }
+    catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception in the solve method: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::abort();
+    }
+    catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception in the solve method!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::abort();
+    }
+  }
+
+
+
+} // namespace
+
+
+
   template <int dim>
   void GradientCrystalPlasticitySolver<dim>::extrapolate_initial_trial_solution()
   {
@@ -160,6 +212,22 @@ namespace gCP
     const RunTimeParameters::NewtonRaphsonParameters
       &newton_parameters = parameters.newton_parameters;
 
+    // The matrix-free mode does not assemble the Jacobian
+    const bool flag_fused_assembly =
+      parameters.flag_fused_assembly &&
+      !parameters.krylov_parameters.flag_matrix_free;
+
+    const bool flag_reuse_linear_contributions =
+      parameters.line_search_parameters.flag_reuse_linear_contributions;
+
+    // In the fused mode the residual assembly updates the quadrature
+    // point history itself
+    const bool flag_fused_history_update =
+      parameters.flag_fused_history_update;
+
+    if (!newton_parameters.flag_reuse_jacobian_across_time_steps)
+      flag_refresh_jacobian = true;
+
     // Newton-Raphson loop
     do
     {
@@ -175,9 +243,26 @@ namespace gCP
       // The current trial solution has to be stored in case
       store_trial_solution();
 
-      reset_and_update_quadrature_point_history();
+      // In the modified Newton-Raphson method the Jacobian (and its
+      // preconditioner) of a previous iteration is reused until the
+      // convergence deteriorates
+      const bool flag_assemble_jacobian =
+        !newton_parameters.flag_reuse_jacobian || flag_refresh_jacobian;
+
+      double initial_value_scalar_function;
+
+      if (flag_fused_assembly && flag_assemble_jacobian)
+        initial_value_scalar_function = assemble_linear_system();
+      else
+      {
+        if (!flag_fused_history_update)
+          reset_and_update_quadrature_point_history();
+
+        initial_value_scalar_function = assemble_residual();
+      }
 
-      const double initial_value_scalar_function = assemble_residual();
+      if (flag_reuse_linear_contributions)
+        store_linear_residual();
 
       if (nonlinear_iteration == 1)
       {
@@ -207,12 +292,26 @@ namespace gCP
         nonlinear_solver_logger.update_value("C-Rate",
                                              0.);
 
+        if (parameters.flag_cache_local_jacobians)
+        {
+          nonlinear_solver_logger.update_value("J-Hits", 0.);
+          nonlinear_solver_logger.update_value("J-Misses", 0.);
+        }
+
         nonlinear_solver_logger.log_to_file();
 
         nonlinear_solver_logger.log_values_to_terminal();
       }
 
-      assemble_jacobian();
+      if (flag_assemble_jacobian)
+      {
+        if (parameters.krylov_parameters.flag_matrix_free)
+          assemble_jacobi_preconditioner();
+        else if (!flag_fused_assembly)
+          assemble_jacobian();
+
+        flag_refresh_jacobian = false;
+      }
 
       const unsigned int n_krylov_iterations = solve_linearized_system();
 
@@ -220,12 +319,16 @@ namespace gCP
 
       update_trial_solution(relaxation_parameter);
 
-      reset_and_update_quadrature_point_history();
+      if (!flag_fused_history_update)
+        reset_and_update_quadrature_point_history();
 
       // Line search algorithm
       {
         double trial_value_scalar_function = assemble_residual();
 
+        if (flag_reuse_linear_contributions)
+          store_linear_residual_increment();
+
         line_search.reinit(initial_value_scalar_function);
 
         while (!line_search.suficient_descent_condition(
@@ -239,9 +342,13 @@ namespace gCP
 
           update_trial_solution(relaxation_parameter);
 
-          reset_and_update_quadrature_point_history();
+          if (!flag_fused_history_update)
+            reset_and_update_quadrature_point_history();
 
-          trial_value_scalar_function = assemble_residual();
+          trial_value_scalar_function =
+            flag_reuse_linear_contributions ?
+              assemble_line_search_residual(relaxation_parameter) :
+              assemble_residual();
         }
       }
 
@@ -253,10 +360,16 @@ namespace gCP
         const auto newton_update_l2_norms =
             fe_field->get_l2_norms(newton_update);
 
+        // Only logged
         const double order_of_convergence =
             (nonlinear_iteration > 1) ? std::log(residual_norm) /
               std::log(previous_residual_norm) : 0.0;
 
+        // Request a new Jacobian if the reused one does not deliver
+        // the expected decrease of the residual
+        flag_refresh_jacobian =
+          needs_jacobian_refresh(residual_norm, previous_residual_norm);
+
         previous_residual_norm = residual_norm;
 
         nonlinear_solver_logger.update_value("N-Itr",
@@ -283,6 +396,17 @@ namespace gCP
         nonlinear_solver_logger.update_value("C-Rate",
                                             order_of_convergence);
 
+        if (parameters.flag_cache_local_jacobians)
+        {
+          nonlinear_solver_logger.update_value(
+            "J-Hits", n_local_jacobian_cache_hits);
+          nonlinear_solver_logger.update_value(
+            "J-Misses", n_local_jacobian_cache_misses);
+
+          n_local_jacobian_cache_hits   = 0;
+          n_local_jacobian_cache_misses = 0;
+        }
+
         nonlinear_solver_logger.log_to_file();
 
         nonlinear_solver_logger.log_values_to_terminal();
@@ -315,6 +439,9 @@ namespace gCP
 
     store_effective_opening_displacement_in_quadrature_history();
 
+    if (quadrature_point_history.is_compressed())
+      commit_quadrature_point_history();
+
     fe_field->solution = trial_solution;
 
     *pcout << std::endl;
@@ -356,126 +483,100 @@ namespace gCP
     {
       case RunTimeParameters::SolverType::DirectSolver:
       {
-        dealii::TrilinosWrappers::SolverDirect solver(solver_control);
-
-        try
-        {
-          solver.solve(jacobian, distributed_newton_update, residual);
-        }
-        catch (std::exception &exc)
+        if (direct_solver.get() == nullptr)
+          direct_solver =
+            std::make_unique<dealii::TrilinosWrappers::SolverDirect>(
+              direct_solver_control);
+
+        // The factorization is reused until the Jacobian is assembled
+        // again
+        if (flag_refresh_preconditioner)
         {
-          std::cerr << std::endl
-                    << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::cerr << "Exception in the solve method: " << std::endl
-                    << exc.what() << std::endl
-                    << "Aborting!" << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::abort();
+          run_linear_solver([&]()
+          {
+            direct_solver->initialize(jacobian);
+          });
+
+          flag_refresh_preconditioner = false;
         }
-        catch (...)
+
+        run_linear_solver([&]()
         {
-          std::cerr << std::endl
-                    << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::cerr << "Unknown exception in the solve method!" << std::endl
-                    << "Aborting!" << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::abort();
-        }
+          direct_solver->solve(distributed_newton_update, residual);
+        });
       }
       break;
 
     case RunTimeParameters::SolverType::CG:
+      if (krylov_parameters.flag_matrix_free)
+      {
+        dealii::SolverCG<dealii::LinearAlgebraTrilinos::MPI::Vector>
+          solver(solver_control);
+
+        run_linear_solver([&]()
+        {
+          solver.solve(JacobianOperator(*this),
+                       distributed_newton_update,
+                       residual,
+                       jacobi_preconditioner);
+        });
+      }
+      else
       {
         dealii::LinearAlgebraTrilinos::SolverCG solver(solver_control);
 
-        dealii::LinearAlgebraTrilinos::MPI::PreconditionILU::AdditionalData
-          additional_data;
+        if (flag_refresh_preconditioner)
+        {
+          dealii::LinearAlgebraTrilinos::MPI::PreconditionILU::AdditionalData
+            additional_data;
 
-        dealii::LinearAlgebraTrilinos::MPI::PreconditionILU preconditioner;
+          ilu_preconditioner.initialize(jacobian, additional_data);
 
-        preconditioner.initialize(jacobian, additional_data);
+          flag_refresh_preconditioner = false;
+        }
 
-        try
+        run_linear_solver([&]()
         {
           solver.solve(jacobian,
                       distributed_newton_update,
                       residual,
-                      preconditioner);
-        }
-        catch (std::exception &exc)
-        {
-          std::cerr << std::endl
-                    << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::cerr << "Exception in the solve method: " << std::endl
-                    << exc.what() << std::endl
-                    << "Aborting!" << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::abort();
-        }
-        catch (...)
-        {
-          std::cerr << std::endl
-                    << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::cerr << "Unknown exception in the solve method!" << std::endl
-                    << "Aborting!" << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::abort();
-        }
+                      ilu_preconditioner);
+        });
       }
       break;
 
     case RunTimeParameters::SolverType::GMRES:
+      if (krylov_parameters.flag_matrix_free)
+      {
+        dealii::SolverGMRES<dealii::LinearAlgebraTrilinos::MPI::Vector>
+          solver(solver_control);
+
+        run_linear_solver([&]()
+        {
+          solver.solve(JacobianOperator(*this),
+                       distributed_newton_update,
+                       residual,
+                       jacobi_preconditioner);
+        });
+      }
+      else
       {
         dealii::LinearAlgebraTrilinos::SolverGMRES solver(solver_control);
 
-        dealii::LinearAlgebraTrilinos::MPI::PreconditionILU preconditioner;
+        if (flag_refresh_preconditioner)
+        {
+          ilu_preconditioner.initialize(jacobian);
 
-        preconditioner.initialize(jacobian);
+          flag_refresh_preconditioner = false;
+        }
 
-        try
+        run_linear_solver([&]()
         {
           solver.solve(jacobian,
                       distributed_newton_update,
                       residual,
-                      preconditioner);
-        }
-        catch (std::exception &exc)
-        {
-          std::cerr << std::endl
-                    << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::cerr << "Exception in the solve method: " << std::endl
-                    << exc.what() << std::endl
-                    << "Aborting!" << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::abort();
-        }
-        catch (...)
-        {
-          std::cerr << std::endl
-                    << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::cerr << "Unknown exception in the solve method!" << std::endl
-                    << "Aborting!" << std::endl
-                    << "----------------------------------------------------"
-                    << std::endl;
-          std::abort();
-        }
+                      ilu_preconditioner);
+        });
       }
       break;
 
@@ -572,6 +673,25 @@ namespace gCP
 
 
 
+  template <int dim>
+  bool GradientCrystalPlasticitySolver<dim>::needs_jacobian_refresh(
+    const double current_residual_norm,
+    const double previous_residual_norm) const
+  {
+    if (line_search.get_n_iterations() > 0)
+      return (true);
+
+    // Negated such that an infinite or undefined contraction factor,
+    // i.e., a vanishing previous residual, also requests a new Jacobian
+    const double contraction_factor =
+      current_residual_norm / previous_residual_norm;
+
+    return (!(contraction_factor <=
+                parameters.newton_parameters.jacobian_refresh_threshold));
+  }
+
+
+
   template <int dim>
   bool GradientCrystalPlasticitySolver<dim>::compute_initial_guess()
   {
@@ -584,6 +704,22 @@ namespace gCP
     const RunTimeParameters::NewtonRaphsonParameters
       &newton_parameters = parameters.newton_parameters;
 
+    // The matrix-free mode does not assemble the Jacobian
+    const bool flag_fused_assembly =
+      parameters.flag_fused_assembly &&
+      !parameters.krylov_parameters.flag_matrix_free;
+
+    const bool flag_reuse_linear_contributions =
+      parameters.line_search_parameters.flag_reuse_linear_contributions;
+
+    // In the fused mode the residual assembly updates the quadrature
+    // point history itself
+    const bool flag_fused_history_update =
+      parameters.flag_fused_history_update;
+
+    if (!newton_parameters.flag_reuse_jacobian_across_time_steps)
+      flag_refresh_jacobian = true;
+
     // Newton-Raphson loop
     do
     {
@@ -612,11 +748,39 @@ namespace gCP
 
       store_trial_solution();
 
-      reset_and_update_quadrature_point_history();
+      // The Jacobian is reused as in solve_nonlinear_system()
+      const bool flag_assemble_jacobian =
+        !newton_parameters.flag_reuse_jacobian || flag_refresh_jacobian;
 
-      const double initial_value_scalar_function = assemble_residual();
+      double initial_value_scalar_function;
 
-      assemble_jacobian();
+      if (flag_fused_assembly && flag_assemble_jacobian)
+        initial_value_scalar_function = assemble_linear_system();
+      else
+      {
+        if (!flag_fused_history_update)
+          reset_and_update_quadrature_point_history();
+
+        initial_value_scalar_function = assemble_residual();
+      }
+
+      if (flag_reuse_linear_contributions)
+        store_linear_residual();
+
+      // The contraction factor of the first iteration refers to the
+      // initial residual, as in solve_nonlinear_system()
+      if (nonlinear_iteration == 1)
+        previous_residual_norm = residual_norm;
+
+      if (flag_assemble_jacobian)
+      {
+        if (parameters.krylov_parameters.flag_matrix_free)
+          assemble_jacobi_preconditioner();
+        else if (!flag_fused_assembly)
+          assemble_jacobian();
+
+        flag_refresh_jacobian = false;
+      }
 
       const unsigned int n_krylov_iterations = solve_linearized_system();
 
@@ -624,12 +788,16 @@ namespace gCP
 
       update_trial_solution(relaxation_parameter);
 
-      reset_and_update_quadrature_point_history();
+      if (!flag_fused_history_update)
+        reset_and_update_quadrature_point_history();
 
       // Line search algorithm
       {
         double trial_value_scalar_function = assemble_residual();
 
+        if (flag_reuse_linear_contributions)
+          store_linear_residual_increment();
+
         line_search.reinit(initial_value_scalar_function);
 
         while (!line_search.suficient_descent_condition(
@@ -642,9 +810,13 @@ namespace gCP
 
           update_trial_solution(relaxation_parameter);
 
-          reset_and_update_quadrature_point_history();
+          if (!flag_fused_history_update)
+            reset_and_update_quadrature_point_history();
 
-          trial_value_scalar_function = assemble_residual();
+          trial_value_scalar_function =
+            flag_reuse_linear_contributions ?
+              assemble_line_search_residual(relaxation_parameter) :
+              assemble_residual();
         }
       }
 
@@ -659,6 +831,11 @@ namespace gCP
         const double order_of_convergence =
             (nonlinear_iteration > 1) ? std::log(residual_norm) / std::log(previous_residual_norm) : 0.0;
 
+        // Request a new Jacobian if the reused one does not deliver
+        // the expected decrease of the residual
+        flag_refresh_jacobian =
+          needs_jacobian_refresh(residual_norm, previous_residual_norm);
+
         previous_residual_norm = residual_norm;
 
         nonlinear_solver_logger.update_value("N-Itr",
@@ -682,6 +859,17 @@ namespace gCP
         nonlinear_solver_logger.update_value("C-Rate",
                                             order_of_convergence);
 
+        if (parameters.flag_cache_local_jacobians)
+        {
+          nonlinear_solver_logger.update_value(
+            "J-Hits", n_local_jacobian_cache_hits);
+          nonlinear_solver_logger.update_value(
+            "J-Misses", n_local_jacobian_cache_misses);
+
+          n_local_jacobian_cache_hits   = 0;
+          n_local_jacobian_cache_misses = 0;
+        }
+
         nonlinear_solver_logger.log_to_file();
 
         nonlinear_solver_logger.log_values_to_terminal();
@@ -710,5 +898,10 @@ template std::tuple<bool,unsigned int> gCP::GradientCrystalPlasticitySolver<3>::
 template unsigned int gCP::GradientCrystalPlasticitySolver<2>::solve_linearized_system();
 template unsigned int gCP::GradientCrystalPlasticitySolver<3>::solve_linearized_system();
 
+template bool gCP::GradientCrystalPlasticitySolver<2>::needs_jacobian_refresh(
+  const double, const double) const;
+template bool gCP::GradientCrystalPlasticitySolver<3>::needs_jacobian_refresh(
+  const double, const double) const;
+
 template void gCP::GradientCrystalPlasticitySolver<2>::update_trial_solution(const double);
 template void gCP::GradientCrystalPlasticitySolver<3>::update_trial_solution(const double);
@@ -516,7 +516,8 @@ solver_type(SolverType::CG),
 relative_tolerance(1e-6),
 absolute_tolerance(1e-8),
 tolerance_relaxation_factor(1.0),
-n_max_iterations(1000)
+n_max_iterations(1000),
+flag_matrix_free(false)
 {}
 
 
@@ -545,6 +546,10 @@ void KrylovParameters::declare_parameters(
     prm.declare_entry("Maximum number of iterations",
                       "1000",
                       dealii::Patterns::Integer());
+
+    prm.declare_entry("Matrix-free",
+                      "false",
+                      dealii::Patterns::Bool());
   }
   prm.leave_subsection();
 }
@@ -586,6 +591,8 @@ void KrylovParameters::parse_parameters(
     n_max_iterations =
       prm.get_integer("Maximum number of iterations");
 
+    flag_matrix_free = prm.get_bool("Matrix-free");
+
     AssertThrow(relative_tolerance > 0,
                 dealii::ExcLowerRange(relative_tolerance, 0));
 
@@ -602,6 +609,11 @@ void KrylovParameters::parse_parameters(
 
     AssertThrow(n_max_iterations > 0,
                 dealii::ExcLowerRange(n_max_iterations, 0));
+
+    AssertThrow(!(flag_matrix_free &&
+                  solver_type == SolverType::DirectSolver),
+                dealii::ExcMessage(
+                  "The matrix-free mode requires an iterative solver."));
   }
   prm.leave_subsection();
 }
@@ -613,7 +625,10 @@ NewtonRaphsonParameters::NewtonRaphsonParameters()
 relative_tolerance(1e-6),
 absolute_tolerance(1e-8),
 step_tolerance(1e-8),
-n_max_iterations(15)
+n_max_iterations(15),
+flag_reuse_jacobian(false),
+jacobian_refresh_threshold(0.5),
+flag_reuse_jacobian_across_time_steps(false)
 {}
 
 
@@ -638,6 +653,18 @@ void NewtonRaphsonParameters::declare_parameters(
     prm.declare_entry("Maximum number of iterations",
                       "15",
                       dealii::Patterns::Integer());
+
+    prm.declare_entry("Reuse Jacobian",
+                      "false",
+                      dealii::Patterns::Bool());
+
+    prm.declare_entry("Jacobian refresh threshold",
+                      "0.5",
+                      dealii::Patterns::Double(0.0, 1.0));
+
+    prm.declare_entry("Reuse Jacobian across time steps",
+                      "false",
+                      dealii::Patterns::Bool());
   }
   prm.leave_subsection();
 }
@@ -661,6 +688,14 @@ void NewtonRaphsonParameters::parse_parameters(
     n_max_iterations =
       prm.get_integer("Maximum number of iterations");
 
+    flag_reuse_jacobian = prm.get_bool("Reuse Jacobian");
+
+    jacobian_refresh_threshold =
+      prm.get_double("Jacobian refresh threshold");
+
+    flag_reuse_jacobian_across_time_steps =
+      prm.get_bool("Reuse Jacobian across time steps");
+
     AssertThrow(step_tolerance > 0,
                 dealii::ExcLowerRange(step_tolerance, 0));
 
@@ -674,6 +709,11 @@ void NewtonRaphsonParameters::parse_parameters(
     AssertThrow(n_max_iterations > 0,
                 dealii::ExcLowerRange(n_max_iterations, 0));
 
+    AssertThrow(jacobian_refresh_threshold > 0.0 &&
+                jacobian_refresh_threshold < 1.0,
+                dealii::ExcMessage("The Jacobian refresh threshold has "
+                                   "to lie in the open interval (0,1)."));
+
   }
   prm.leave_subsection();
 }
@@ -683,7 +723,8 @@ void NewtonRaphsonParameters::parse_parameters(
 LineSearchParameters::LineSearchParameters()
 :
 armijo_condition_constant(1e-4),
-n_max_iterations(15)
+n_max_iterations(15),
+flag_reuse_linear_contributions(true)
 {}
 
 
@@ -700,6 +741,10 @@ void LineSearchParameters::declare_parameters(
     prm.declare_entry("Maximum number of iterations",
                       "15",
                       dealii::Patterns::Integer());
+
+    prm.declare_entry("Reuse linear contributions",
+                      "true",
+                      dealii::Patterns::Bool());
   }
   prm.leave_subsection();
 }
@@ -717,6 +762,9 @@ void LineSearchParameters::parse_parameters(
     n_max_iterations =
       prm.get_integer("Maximum number of iterations");
 
+    flag_reuse_linear_contributions =
+      prm.get_bool("Reuse linear contributions");
+
     AssertThrow(armijo_condition_constant > 0,
                 dealii::ExcLowerRange(armijo_condition_constant, 0));
 
@@ -737,6 +785,14 @@ boundary_conditions_at_grain_boundaries(
 logger_output_directory("results/default/"),
 flag_skip_extrapolation_at_extrema(false),
 flag_zero_damage_during_loading_and_unloading(false),
+flag_fused_assembly(true),
+flag_fused_history_update(true),
+flag_colored_assembly(false),
+flag_cache_local_jacobians(false),
+local_jacobian_cache_tolerance(1e-8),
+flag_sum_factorization(false),
+history_storage_precision(HistoryStoragePrecision::Double),
+history_fixed_point_resolution(1e-6),
 print_sparsity_pattern(false),
 verbose(false)
 {}
@@ -776,6 +832,39 @@ void SolverParameters::declare_parameters(dealii::ParameterHandler &prm)
                     "false",
                     dealii::Patterns::Bool());
 
+  prm.declare_entry("Fused assembly",
+                    "true",
+                    dealii::Patterns::Bool());
+
+  prm.declare_entry("Fused history update",
+                    "true",
+                    dealii::Patterns::Bool());
+
+  prm.declare_entry("Colored assembly",
+                    "false",
+                    dealii::Patterns::Bool());
+
+  prm.declare_entry("Cache local Jacobians",
+                    "false",
+                    dealii::Patterns::Bool());
+
+  prm.declare_entry("Local Jacobian cache tolerance",
+                    "1e-8",
+                    dealii::Patterns::Double(0.));
+
+  prm.declare_entry("Sum factorization",
+                    "false",
+                    dealii::Patterns::Bool());
+
+  prm.declare_entry("History storage precision",
+                    "double",
+                    dealii::Patterns::Selection(
+                      "double|single|fixed-point"));
+
+  prm.declare_entry("History fixed-point resolution",
+                    "1e-6",
+                    dealii::Patterns::Double(0.));
+
   prm.declare_entry("Print sparsity pattern",
                     "false",
                     dealii::Patterns::Bool());
@@ -830,6 +919,47 @@ void SolverParameters::parse_parameters(dealii::ParameterHandler &prm)
   flag_zero_damage_during_loading_and_unloading =
     prm.get_bool("Zero damage evolution during un- and loading");
 
+  flag_fused_assembly = prm.get_bool("Fused assembly");
+
+  flag_fused_history_update = prm.get_bool("Fused history update");
+
+  flag_colored_assembly = prm.get_bool("Colored assembly");
+
+  flag_cache_local_jacobians = prm.get_bool("Cache local Jacobians");
+
+  AssertThrow(!(flag_cache_local_jacobians &&
+                krylov_parameters.flag_matrix_free),
+              dealii::ExcMessage(
+                "The local Jacobians can not be cached in the "
+                "matrix-free mode, as no local matrices are assembled."));
+
+  local_jacobian_cache_tolerance =
+    prm.get_double("Local Jacobian cache tolerance");
+
+  flag_sum_factorization = prm.get_bool("Sum factorization");
+
+  const std::string string_history_storage_precision(
+                    prm.get("History storage precision"));
+
+  if (string_history_storage_precision == std::string("double"))
+    history_storage_precision = HistoryStoragePrecision::Double;
+  else if (string_history_storage_precision == std::string("single"))
+    history_storage_precision = HistoryStoragePrecision::Single;
+  else if (string_history_storage_precision ==
+            std::string("fixed-point"))
+    history_storage_precision = HistoryStoragePrecision::FixedPoint;
+  else
+    AssertThrow(false,
+      dealii::ExcMessage(
+        "Unexpected identifier for the history storage precision."));
+
+  history_fixed_point_resolution =
+    prm.get_double("History fixed-point resolution");
+
+  AssertThrow(history_fixed_point_resolution > 0.0,
+              dealii::ExcLowerRangeType<double>(
+                history_fixed_point_resolution, 0.0));
+
   print_sparsity_pattern = prm.get_bool("Print sparsity pattern");
 
   verbose = prm.get_bool("Verbose");
@@ -1026,6 +1156,10 @@ dim(2),
 mapping_degree(1),
 mapping_interior_cells(false),
 n_global_refinements(0),
+refinement_frequency(0),
+n_max_adaptive_refinements(2),
+refinement_fraction(0.3),
+coarsening_fraction(0.03),
 fe_degree_displacements(2),
 fe_degree_slips(1),
 slips_normals_pathname("input/slip_normals"),
@@ -1040,6 +1174,9 @@ flag_output_damage_variable(false),
 flag_output_residual(false),
 flag_output_fluctuations(false),
 flag_store_checkpoint(false),
+checkpoint_frequency(0),
+checkpoint_wall_time_interval(0.0),
+flag_restart_from_checkpoint(false),
 verbose(true)
 {}
 
@@ -1103,6 +1240,22 @@ void ProblemParameters::declare_parameters(dealii::ParameterHandler &prm)
                       "0",
                       dealii::Patterns::Integer(0));
 
+    prm.declare_entry("Adaptive mesh refinement frequency",
+                      "0",
+                      dealii::Patterns::Integer(0));
+
+    prm.declare_entry("Maximum number of adaptive refinements",
+                      "2",
+                      dealii::Patterns::Integer(0));
+
+    prm.declare_entry("Fraction of cells to refine",
+                      "0.3",
+                      dealii::Patterns::Double(0.0, 1.0));
+
+    prm.declare_entry("Fraction of cells to coarsen",
+                      "0.03",
+                      dealii::Patterns::Double(0.0, 1.0));
+
     prm.declare_entry("FE's polynomial degree - Displacements",
                       "2",
                       dealii::Patterns::Integer(1));
@@ -1190,6 +1343,18 @@ void ProblemParameters::declare_parameters(dealii::ParameterHandler &prm)
     prm.declare_entry("Store checkpoints",
                       "false",
                       dealii::Patterns::Bool());
+
+    prm.declare_entry("Checkpoint frequency",
+                      "0",
+                      dealii::Patterns::Integer(0));
+
+    prm.declare_entry("Checkpoint wall-clock interval",
+                      "0.0",
+                      dealii::Patterns::Double(0.0));
+
+    prm.declare_entry("Restart from checkpoint",
+                      "false",
+                      dealii::Patterns::Bool());
   }
   prm.leave_subsection();
 
@@ -1228,6 +1393,19 @@ void ProblemParameters::parse_parameters(dealii::ParameterHandler &prm)
 
     n_global_refinements = prm.get_integer("Number of global refinements");
 
+    refinement_frequency = prm.get_integer("Adaptive mesh refinement frequency");
+
+    n_max_adaptive_refinements =
+      prm.get_integer("Maximum number of adaptive refinements");
+
+    refinement_fraction = prm.get_double("Fraction of cells to refine");
+
+    coarsening_fraction = prm.get_double("Fraction of cells to coarsen");
+
+    AssertThrow(refinement_fraction + coarsening_fraction <= 1.0,
+                dealii::ExcMessage("The fractions of cells to refine and "
+                                   "to coarsen add up to more than one."));
+
     fe_degree_displacements = prm.get_integer("FE's polynomial degree - Displacements");
     AssertThrow(fe_degree_displacements > 0,
                 dealii::ExcLowerRange(fe_degree_displacements, 0));
@@ -1282,6 +1460,20 @@ void ProblemParameters::parse_parameters(dealii::ParameterHandler &prm)
 
     flag_store_checkpoint       = prm.get_bool("Store checkpoints");
 
+    checkpoint_frequency        = prm.get_integer("Checkpoint frequency");
+
+    checkpoint_wall_time_interval =
+      prm.get_double("Checkpoint wall-clock interval");
+
+    flag_restart_from_checkpoint = prm.get_bool("Restart from checkpoint");
+
+    AssertThrow(!flag_store_checkpoint ||
+                checkpoint_frequency > 0 ||
+                checkpoint_wall_time_interval > 0.0,
+                dealii::ExcMessage("Checkpoints are to be stored but "
+                                   "neither a checkpoint frequency nor a "
+                                   "wall-clock interval was specified."));
+
     if ((dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0) &&
         !fs::exists(graphical_output_directory + "paraview/"))
     {
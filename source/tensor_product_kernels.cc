@@ -0,0 +1,282 @@
+#include <gCP/tensor_product_kernels.h>
+
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_tools.h>
+
+#include <algorithm>
+
+
+
+namespace gCP
+{
+
+
+
+template <int dim, typename Number>
+TensorProductKernels<dim, Number>::TensorProductKernels(
+  const dealii::FiniteElement<dim> &finite_element,
+  const dealii::Quadrature<1>      &quadrature)
+:
+n_dofs_1d(finite_element.degree + 1),
+n_q_points_1d(quadrature.size()),
+shape_values(n_q_points_1d * n_dofs_1d),
+shape_gradients(n_q_points_1d * n_dofs_1d),
+lexicographic_numbering(
+  dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(
+    finite_element.degree))
+{
+  AssertThrow(
+    dynamic_cast<const dealii::FE_Q<dim> *>(&finite_element) != nullptr,
+    dealii::ExcMessage("The sum-factorized kernels are only implemented "
+                       "for FE_Q elements."));
+
+  AssertDimension(lexicographic_numbering.size(),
+                  finite_element.n_dofs_per_cell());
+
+  const std::vector<unsigned int> hierarchic_numbering =
+    dealii::FETools::lexicographic_to_hierarchic_numbering<dim>(
+      finite_element.degree);
+
+  // The one-dimensional shape functions are the restrictions of the
+  // shape functions of the lexicographic degrees of freedom (i,0,...,0)
+  // to the first coordinate axis, as their remaining factors are one at
+  // the origin
+  for (unsigned int q_point = 0; q_point < n_q_points_1d; ++q_point)
+  {
+    dealii::Point<dim> point;
+
+    point[0] = quadrature.point(q_point)[0];
+
+    for (unsigned int i = 0; i < n_dofs_1d; ++i)
+    {
+      shape_values[q_point * n_dofs_1d + i] =
+        finite_element.shape_value(hierarchic_numbering[i], point);
+
+      shape_gradients[q_point * n_dofs_1d + i] =
+        finite_element.shape_grad(hierarchic_numbering[i], point)[0];
+    }
+  }
+}
+
+
+
+template <int dim, typename Number>
+void TensorProductKernels<dim, Number>::evaluate(
+  const dealii::ArrayView<const Number>                   &dof_values,
+  const dealii::ArrayView<Number>                         &values,
+  const dealii::ArrayView<dealii::Tensor<1,dim,Number>>   &reference_gradients,
+  Workspace                                               &workspace) const
+{
+  AssertDimension(dof_values.size(), n_dofs_per_cell());
+
+  const unsigned int buffer_size =
+    dealii::Utilities::fixed_power<dim>(std::max(n_dofs_1d, n_q_points_1d));
+
+  workspace.buffer_0.resize(buffer_size);
+  workspace.buffer_1.resize(buffer_size);
+  workspace.buffer_2.resize(buffer_size);
+
+  // Applies the matrices of all directions in a row. The derivative
+  // matrix is used along derivative_direction, i.e., nowhere if it
+  // equals dim
+  auto interpolate = [&](const unsigned int derivative_direction,
+                         Number             *result)
+  {
+    std::array<unsigned int, dim> extents;
+
+    extents.fill(n_dofs_1d);
+
+    const Number *input = dof_values.data();
+
+    for (unsigned int direction = 0; direction < dim; ++direction)
+    {
+      Number *output =
+        (direction == dim - 1) ?
+          result :
+          (direction % 2 == 0 ? workspace.buffer_0.begin() :
+                                workspace.buffer_1.begin());
+
+      apply(direction == derivative_direction ?
+              shape_gradients : shape_values,
+            false,
+            direction,
+            extents,
+            input,
+            output,
+            false);
+
+      input = output;
+    }
+  };
+
+  if (values.size() > 0)
+  {
+    AssertDimension(values.size(), n_quadrature_points());
+
+    interpolate(dim, values.data());
+  }
+
+  if (reference_gradients.size() > 0)
+  {
+    AssertDimension(reference_gradients.size(), n_quadrature_points());
+
+    for (unsigned int direction = 0; direction < dim; ++direction)
+    {
+      interpolate(direction, workspace.buffer_2.begin());
+
+      for (unsigned int q_point = 0;
+           q_point < reference_gradients.size();
+           ++q_point)
+        reference_gradients[q_point][direction] =
+          workspace.buffer_2[q_point];
+    }
+  }
+}
+
+
+
+template <int dim, typename Number>
+void TensorProductKernels<dim, Number>::integrate(
+  const dealii::ArrayView<const Number>                         &values,
+  const dealii::ArrayView<const dealii::Tensor<1,dim,Number>>   &reference_gradients,
+  const dealii::ArrayView<Number>                               &dof_values,
+  Workspace                                                     &workspace) const
+{
+  AssertDimension(dof_values.size(), n_dofs_per_cell());
+
+  const unsigned int buffer_size =
+    dealii::Utilities::fixed_power<dim>(std::max(n_dofs_1d, n_q_points_1d));
+
+  workspace.buffer_0.resize(buffer_size);
+  workspace.buffer_1.resize(buffer_size);
+  workspace.buffer_2.resize(buffer_size);
+
+  // Applies the transposed matrices of all directions in reverse
+  // order and adds the result to dof_values. The derivative matrix is
+  // used along derivative_direction, i.e., nowhere if it equals dim
+  auto test = [&](const unsigned int derivative_direction,
+                  const Number       *quadrature_point_values)
+  {
+    std::array<unsigned int, dim> extents;
+
+    extents.fill(n_q_points_1d);
+
+    const Number *input = quadrature_point_values;
+
+    for (unsigned int direction = dim; direction-- > 0;)
+    {
+      Number *output =
+        (direction == 0) ?
+          dof_values.data() :
+          ((dim - 1 - direction) % 2 == 0 ? workspace.buffer_0.begin() :
+                                            workspace.buffer_1.begin());
+
+      apply(direction == derivative_direction ?
+              shape_gradients : shape_values,
+            true,
+            direction,
+            extents,
+            input,
+            output,
+            direction == 0);
+
+      input = output;
+    }
+  };
+
+  if (values.size() > 0)
+  {
+    AssertDimension(values.size(), n_quadrature_points());
+
+    test(dim, values.data());
+  }
+
+  if (reference_gradients.size() > 0)
+  {
+    AssertDimension(reference_gradients.size(), n_quadrature_points());
+
+    for (unsigned int direction = 0; direction < dim; ++direction)
+    {
+      for (unsigned int q_point = 0;
+           q_point < reference_gradients.size();
+           ++q_point)
+        workspace.buffer_2[q_point] =
+          reference_gradients[q_point][direction];
+
+      test(direction, workspace.buffer_2.begin());
+    }
+  }
+}
+
+
+
+template <int dim, typename Number>
+void TensorProductKernels<dim, Number>::apply(
+  const std::vector<double>     &matrix,
+  const bool                    transpose,
+  const unsigned int            direction,
+  std::array<unsigned int, dim> &extents,
+  const Number                  *input,
+  Number                        *output,
+  const bool                    add) const
+{
+  const unsigned int n_input  = transpose ? n_q_points_1d : n_dofs_1d;
+
+  const unsigned int n_output = transpose ? n_dofs_1d : n_q_points_1d;
+
+  AssertDimension(extents[direction], n_input);
+
+  // Distance between two consecutive entries along the direction and
+  // number of independent blocks of the remaining directions
+  unsigned int stride = 1;
+
+  for (unsigned int d = 0; d < direction; ++d)
+    stride *= extents[d];
+
+  unsigned int n_blocks = 1;
+
+  for (unsigned int d = direction + 1; d < dim; ++d)
+    n_blocks *= extents[d];
+
+  for (unsigned int block = 0; block < n_blocks; ++block)
+  {
+    const Number *block_input   = input + block * n_input * stride;
+
+    Number       *block_output  = output + block * n_output * stride;
+
+    for (unsigned int row = 0; row < n_output; ++row)
+      for (unsigned int offset = 0; offset < stride; ++offset)
+      {
+        Number sum;
+
+        sum = 0.0;
+
+        for (unsigned int column = 0; column < n_input; ++column)
+          sum += (transpose ?
+                    matrix[column * n_dofs_1d + row] :
+                    matrix[row * n_dofs_1d + column]) *
+                 block_input[column * stride + offset];
+
+        if (add)
+          block_output[row * stride + offset] += sum;
+        else
+          block_output[row * stride + offset] = sum;
+      }
+  }
+
+  extents[direction] = n_output;
+}
+
+
+
+} // namespace gCP
+
+
+
+template class gCP::TensorProductKernels<2>;
+template class gCP::TensorProductKernels<3>;
+
+template class gCP::TensorProductKernels<2, dealii::VectorizedArray<double>>;
+template class gCP::TensorProductKernels<3, dealii::VectorizedArray<double>>;
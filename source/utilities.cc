@@ -1,6 +1,11 @@
 
 #include <gCP/utilities.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
 
 
 namespace gCP
@@ -17,6 +22,7 @@ Logger::Logger(const std::string output_filepath)
 :
 pcout(std::cout,
       dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0),
+output_filename(output_filepath),
 output_filepath(output_filepath)
 {}
 
@@ -140,6 +146,226 @@ void Logger::add_break(const std::string message)
 
 
 
+void Logger::save(const std::string &filepath)
+{
+  output_filepath.flush();
+
+  if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+  {
+    std::ifstream input_file(output_filename, std::ios::binary);
+
+    std::ofstream output_file(filepath, std::ios::binary);
+
+    AssertThrow(input_file && output_file,
+                dealii::ExcMessage("The log file could not be copied "
+                                   "to " + filepath + "."));
+
+    output_file << input_file.rdbuf();
+  }
+}
+
+
+
+void Logger::load(const std::string &filepath)
+{
+  output_filepath.close();
+
+  if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+  {
+    std::ifstream input_file(filepath, std::ios::binary);
+
+    std::ofstream output_file(output_filename, std::ios::binary);
+
+    AssertThrow(input_file && output_file,
+                dealii::ExcMessage("The log file could not be restored "
+                                   "from " + filepath + "."));
+
+    output_file << input_file.rdbuf();
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  output_filepath.open(output_filename, std::ios::out | std::ios::app);
+}
+
+
+
+std::string get_next_checkpoint_prefix(const std::string &filepath)
+{
+  if (!std::ifstream(filepath + ".latest"))
+    return (filepath + "-A");
+
+  return (get_latest_checkpoint_prefix(filepath) == filepath + "-A" ?
+            filepath + "-B" :
+            filepath + "-A");
+}
+
+
+
+std::string get_latest_checkpoint_prefix(const std::string &filepath)
+{
+  std::ifstream input_file(filepath + ".latest");
+
+  AssertThrow(input_file,
+              dealii::ExcMessage("The file " + filepath + ".latest could "
+                                 "not be opened."));
+
+  std::string suffix;
+
+  input_file >> suffix;
+
+  AssertThrow(suffix == "A" || suffix == "B",
+              dealii::ExcMessage("The file " + filepath + ".latest could "
+                                 "not be parsed."));
+
+  return (filepath + "-" + suffix);
+}
+
+
+
+void commit_checkpoint(const std::string &filepath,
+                       const std::string &prefix)
+{
+  AssertThrow(prefix == filepath + "-A" || prefix == filepath + "-B",
+              dealii::ExcMessage("The prefix " + prefix + " does not "
+                                 "belong to the checkpoints of " +
+                                 filepath + "."));
+
+  // All processes have to be done writing the checkpoint
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+  {
+    const std::string temporary_filepath = filepath + ".latest.tmp";
+
+    {
+      std::ofstream output_file(temporary_filepath);
+
+      AssertThrow(output_file,
+                  dealii::ExcMessage("The file " + temporary_filepath +
+                                     " could not be opened."));
+
+      output_file << prefix.back() << std::endl;
+
+      output_file.close();
+
+      AssertThrow(!output_file.fail(),
+                  dealii::ExcMessage("The file " + temporary_filepath +
+                                     " could not be written."));
+    }
+
+    // std::rename replaces the destination atomically on POSIX systems
+    AssertThrow(std::rename(temporary_filepath.c_str(),
+                            (filepath + ".latest").c_str()) == 0,
+                dealii::ExcMessage("The file " + temporary_filepath +
+                                   " could not be renamed."));
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+
+
+void save_discrete_time(const dealii::DiscreteTime  &discrete_time,
+                        const std::string           &filepath)
+{
+  if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) != 0)
+    return;
+
+  std::ofstream output_file(filepath);
+
+  AssertThrow(output_file,
+              dealii::ExcMessage("The file " + filepath + " could not "
+                                 "be opened."));
+
+  output_file << std::setprecision(std::numeric_limits<double>::max_digits10)
+              << discrete_time.get_current_time() << std::endl
+              << discrete_time.get_step_number() << std::endl
+              << discrete_time.get_previous_step_size() << std::endl
+              << discrete_time.get_next_step_size() << std::endl;
+}
+
+
+
+void load_discrete_time(dealii::DiscreteTime  &discrete_time,
+                        const std::string     &filepath)
+{
+  std::ifstream input_file(filepath);
+
+  AssertThrow(input_file,
+              dealii::ExcMessage("The file " + filepath + " could not "
+                                 "be opened."));
+
+  double        current_time;
+
+  unsigned int  step_number;
+
+  double        previous_step_size;
+
+  double        next_step_size;
+
+  input_file >> current_time
+             >> step_number
+             >> previous_step_size
+             >> next_step_size;
+
+  AssertThrow(!input_file.fail(),
+              dealii::ExcMessage("The file " + filepath + " could not "
+                                 "be parsed."));
+
+  AssertThrow(current_time >= discrete_time.get_start_time() &&
+                current_time <= discrete_time.get_end_time(),
+              dealii::ExcMessage("The saved current time lies outside of "
+                                 "the time interval of the "
+                                 "dealii::DiscreteTime instance."));
+
+  // Rebuild the instance at its start time
+  discrete_time = dealii::DiscreteTime(discrete_time.get_start_time(),
+                                       discrete_time.get_end_time(),
+                                       next_step_size);
+
+  if (step_number > 0)
+  {
+    // Only the previous time enters the state of the instance. The
+    // steps leading to it are therefore equidistant
+    const double previous_time = current_time - previous_step_size;
+
+    for (unsigned int step = 1; step < step_number; ++step)
+    {
+      discrete_time.set_desired_next_step_size(
+        (previous_time - discrete_time.get_current_time()) /
+        (step_number - step));
+
+      discrete_time.advance_time();
+    }
+
+    // The last step is the difference between the saved current time
+    // and the time reached so far
+    discrete_time.set_desired_next_step_size(
+      current_time - discrete_time.get_current_time());
+
+    discrete_time.advance_time();
+  }
+
+  // The replayed steps are subject to round-off errors, which are
+  // bounded relative to the length of the time interval
+  const double tolerance =
+    1e3 * std::numeric_limits<double>::epsilon() *
+    std::max(std::fabs(current_time),
+             discrete_time.get_end_time() - discrete_time.get_start_time());
+
+  AssertThrow(discrete_time.get_step_number() == step_number &&
+                std::fabs(discrete_time.get_current_time() -
+                          current_time) <= tolerance,
+              dealii::ExcMessage("The temporal discretization saved in "
+                                 "the file " + filepath + " could not be "
+                                 "restored."));
+
+  discrete_time.set_desired_next_step_size(next_step_size);
+}
+
+
+
 std::string get_fullmatrix_as_string(
   const dealii::FullMatrix<double>  fullmatrix,
   const unsigned int                offset,
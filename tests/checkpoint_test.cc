@@ -0,0 +1,234 @@
+#include <gCP/utilities.h>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+
+#include <bicrystal.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+
+
+namespace Tests
+{
+
+
+
+/*!
+ * @brief Writes a checkpoint after two time steps, restores it into a
+ * new instance and compares the restored state and the solution of the
+ * subsequent time step with the ones of the original instance
+ */
+template <int dim>
+class Checkpoint
+{
+public:
+  Checkpoint(const gCP::RunTimeParameters::ProblemParameters &parameters);
+
+  void run();
+
+private:
+  const gCP::RunTimeParameters::ProblemParameters parameters;
+
+  dealii::ConditionalOStream                      pcout;
+
+  const std::string                               checkpoint_filepath;
+
+  /*!
+   * @brief Throws if the relative difference between @p vector and
+   * @p reference_vector exceeds @p tolerance
+   */
+  void compare(
+    const dealii::LinearAlgebraTrilinos::MPI::Vector  &vector,
+    const dealii::LinearAlgebraTrilinos::MPI::Vector  &reference_vector,
+    const double                                      tolerance,
+    const std::string                                 &name) const;
+};
+
+
+
+template <int dim>
+Checkpoint<dim>::Checkpoint(
+  const gCP::RunTimeParameters::ProblemParameters &parameters)
+:
+parameters(parameters),
+pcout(
+  std::cout,
+  dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0),
+checkpoint_filepath("checkpoint_test_" + std::to_string(dim) + "d")
+{}
+
+
+
+template <int dim>
+void Checkpoint<dim>::run()
+{
+  Bicrystal<dim> original(parameters,
+                          checkpoint_filepath + "_original_");
+
+  original.setup();
+
+  original.advance();
+
+  original.advance();
+
+  original.gCP_solver.save_checkpoint(checkpoint_filepath);
+
+  const dealii::LinearAlgebraTrilinos::MPI::Vector
+    checkpoint_solution(original.fe_field->solution);
+
+  const dealii::LinearAlgebraTrilinos::MPI::Vector
+    checkpoint_old_solution(original.fe_field->old_solution);
+
+  const double checkpoint_damage =
+    original.gCP_solver.get_macroscopic_damage();
+
+  original.advance();
+
+  // Restore the checkpoint
+  Bicrystal<dim> restored(parameters,
+                          checkpoint_filepath + "_restored_");
+
+  const std::string prefix =
+    gCP::Utilities::get_latest_checkpoint_prefix(checkpoint_filepath);
+
+  restored.setup(prefix);
+
+  restored.gCP_solver.load_checkpoint(checkpoint_filepath);
+
+  gCP::Utilities::load_discrete_time(restored.discrete_time,
+                                     prefix + ".time");
+
+  AssertThrow(restored.discrete_time.get_step_number() == 2 &&
+                std::fabs(restored.discrete_time.get_current_time() -
+                          2.0 * parameters.temporal_discretization_parameters.
+                            time_step_size) < 1e-12,
+              dealii::ExcMessage("The time was not restored."));
+
+  // Solution vectors
+  compare(restored.fe_field->solution,
+          checkpoint_solution,
+          0.0,
+          "solution");
+
+  compare(restored.fe_field->old_solution,
+          checkpoint_old_solution,
+          0.0,
+          "old solution");
+
+  // Internal variables of the cohesive law
+  const double restored_damage =
+    restored.gCP_solver.get_macroscopic_damage();
+
+  pcout << "Macroscopic damage at the checkpoint (" << dim << "D)"
+        << std::endl
+        << "  Original = " << checkpoint_damage << std::endl
+        << "  Restored = " << restored_damage << std::endl;
+
+  AssertThrow(std::fabs(restored_damage - checkpoint_damage) <=
+                1e-12 * std::fabs(checkpoint_damage),
+              dealii::ExcMessage("The interface history was not "
+                                 "restored."));
+
+  // The slip resistances and the internal variables of the cohesive
+  // law enter the subsequent time step
+  restored.advance();
+
+  compare(restored.fe_field->solution,
+          original.fe_field->solution,
+          1e-10,
+          "solution of the subsequent time step");
+}
+
+
+
+template <int dim>
+void Checkpoint<dim>::compare(
+  const dealii::LinearAlgebraTrilinos::MPI::Vector  &vector,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector  &reference_vector,
+  const double                                      tolerance,
+  const std::string                                 &name) const
+{
+  AssertThrow(vector.locally_owned_elements() ==
+                reference_vector.locally_owned_elements(),
+              dealii::ExcMessage("The degrees of freedom of the " + name +
+                                 " are distributed differently."));
+
+  double error = 0.0;
+
+  for (const auto locally_owned_dof : vector.locally_owned_elements())
+    error = std::max(error,
+                     std::fabs(vector[locally_owned_dof] -
+                               reference_vector[locally_owned_dof]));
+
+  error = dealii::Utilities::MPI::max(error, MPI_COMM_WORLD);
+
+  const double reference_norm = reference_vector.linfty_norm();
+
+  pcout << "Restored " << name << " (" << dim << "D)" << std::endl
+        << "  Maximum difference = " << error << std::endl
+        << "  Maximum norm       = " << reference_norm << std::endl;
+
+  AssertThrow(reference_norm > 0.0,
+              dealii::ExcMessage("The " + name + " vanishes."));
+
+  AssertThrow(error <= tolerance * reference_norm,
+              dealii::ExcMessage("The " + name + " was not restored."));
+}
+
+
+
+} // namespace Tests
+
+
+
+int main(int argc, char *argv[])
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(
+      argc, argv, dealii::numbers::invalid_unsigned_int);
+
+    {
+      gCP::RunTimeParameters::ProblemParameters parameters("input/2d.prm");
+
+      Tests::Checkpoint<2> test(parameters);
+      test.run();
+    }
+
+    {
+      gCP::RunTimeParameters::ProblemParameters parameters("input/3d.prm");
+
+      Tests::Checkpoint<3> test(parameters);
+      test.run();
+    }
+  }
+  catch (std::exception &exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    return 1;
+  }
+  return 0;
+}
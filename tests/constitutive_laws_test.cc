@@ -18,6 +18,7 @@
 
 #include <deal.II/numerics/data_out.h>
 
+#include <algorithm>
 #include <string>
 
 
@@ -69,7 +70,7 @@ private:
 
   gCP::ConstitutiveLaws::CohesiveLaw<dim>                 cohesive_law;
 
-  gCP::QuadraturePointHistory<dim>                        quadrature_point_history;
+  gCP::QuadraturePointHistoryStorage<dim>                 quadrature_point_history;
 
   gCP::InterfaceQuadraturePointHistory<dim>               interface_quadrature_point_history;
 
@@ -228,12 +229,12 @@ void CrystalData<dim>::init()
 
   vectorial_microstress_law.init();
 
-  quadrature_point_history.init(
+  // A single quadrature point per cell
+  quadrature_point_history.initialize(
     parameters.solver_parameters.constitutive_laws_parameters.scalar_microstress_law_parameters,
+    triangulation,
+    1,
     crystals_data->get_n_slips());
-
-  interface_quadrature_point_history.init(
-    parameters.solver_parameters.constitutive_laws_parameters.cohesive_law_parameters);
 }
 
 
@@ -298,6 +299,100 @@ void CrystalData<dim>::test_constitutive_laws()
             << gCP::Utilities::get_tensor_as_string(stress_tensor, string_width + 3, 15, 3, true)
             << "\n\n";
 
+  // Compare the rotated stiffness tetrads against their contraction
+  // with four rotation tensors
+  {
+    const gCP::RunTimeParameters::HookeLawParameters &hooke_law_parameters =
+      parameters.solver_parameters.constitutive_laws_parameters.hooke_law_parameters;
+
+    auto get_reference_stiffness_tetrad = [&](auto reference_stiffness_tetrad)
+    {
+      constexpr int spacedim = decltype(reference_stiffness_tetrad)::dimension;
+
+      for (unsigned int i = 0; i < spacedim; i++)
+        for (unsigned int j = 0; j < spacedim; j++)
+          for (unsigned int k = 0; k < spacedim; k++)
+            for (unsigned int l = 0; l < spacedim; l++)
+              if (i == j && j == k && k == l)
+                reference_stiffness_tetrad[i][j][k][l] = hooke_law_parameters.C1111;
+              else if (i == k && j == l)
+                reference_stiffness_tetrad[i][j][k][l] = hooke_law_parameters.C1212;
+              else if (i == j && k == l)
+                reference_stiffness_tetrad[i][j][k][l] = hooke_law_parameters.C1122;
+
+      return reference_stiffness_tetrad;
+    };
+
+    auto get_relative_error = [](const auto &stiffness_tetrad,
+                                 const auto &reference_stiffness_tetrad,
+                                 const auto &rotation_tensor)
+    {
+      constexpr int spacedim = std::decay_t<
+        decltype(rotation_tensor)>::dimension;
+
+      double error = 0.0;
+
+      for (unsigned int i = 0; i < spacedim; i++)
+        for (unsigned int j = 0; j < spacedim; j++)
+          for (unsigned int k = 0; k < spacedim; k++)
+            for (unsigned int l = 0; l < spacedim; l++)
+            {
+              double value = 0.0;
+
+              for (unsigned int o = 0; o < spacedim; o++)
+                for (unsigned int p = 0; p < spacedim; p++)
+                  for (unsigned int q = 0; q < spacedim; q++)
+                    for (unsigned int r = 0; r < spacedim; r++)
+                      value +=
+                        rotation_tensor[i][o] *
+                        rotation_tensor[j][p] *
+                        rotation_tensor[k][q] *
+                        rotation_tensor[l][r] *
+                        reference_stiffness_tetrad[o][p][q][r];
+
+              error = std::max(error,
+                               std::fabs(value - stiffness_tetrad[i][j][k][l]));
+            }
+
+      return (error / reference_stiffness_tetrad.norm());
+    };
+
+    const dealii::SymmetricTensor<4,dim> reference_stiffness_tetrad =
+      get_reference_stiffness_tetrad(dealii::SymmetricTensor<4,dim>());
+
+    const dealii::SymmetricTensor<4,3> reference_stiffness_tetrad_3d =
+      get_reference_stiffness_tetrad(dealii::SymmetricTensor<4,3>());
+
+    double max_relative_error = 0.0;
+
+    for (unsigned int crystal_id = 0;
+         crystal_id < crystals_data->get_n_crystals(); ++crystal_id)
+    {
+      max_relative_error =
+        std::max(max_relative_error,
+                 get_relative_error(
+                   hooke_law.get_stiffness_tetrad(crystal_id),
+                   reference_stiffness_tetrad,
+                   crystals_data->get_rotation_tensor(crystal_id)));
+
+      max_relative_error =
+        std::max(max_relative_error,
+                 get_relative_error(
+                   hooke_law.get_stiffness_tetrad_3d(crystal_id),
+                   reference_stiffness_tetrad_3d,
+                   crystals_data->get_3d_rotation_tensor(crystal_id)));
+    }
+
+    std::cout << std::setw(string_width) << std::left
+              << " Rotation relative error" << " = "
+              << std::scientific << max_relative_error << "\n\n";
+
+    AssertThrow(max_relative_error < 1e-12,
+                dealii::ExcMessage("The rotated stiffness tetrads do not "
+                                   "match the contraction with the "
+                                   "rotation tensors."));
+  }
+
   std::cout << "Testing ResolvedShearStressLaw<dim> \n\n";
 
   for (unsigned int i = 0; i  < crystals_data->get_n_slips(); ++i)
@@ -311,7 +406,7 @@ void CrystalData<dim>::test_constitutive_laws()
           stress_tensor)
       << "\n\n";
 
-  std::cout << "Testing QuadraturePointHistory<dim> \n\n";
+  std::cout << "Testing QuadraturePointHistoryStorage<dim> \n\n";
 
   std::vector<std::vector<double>> old_slip_values(
     crystals_data->get_n_slips(),
@@ -320,15 +415,29 @@ void CrystalData<dim>::test_constitutive_laws()
   old_slip_values[0][0] = 1.5;
   old_slip_values[1][0] = 0.75;
 
+  // The slip resistances are only stored at the locally owned cells
+  unsigned int cell_index = dealii::numbers::invalid_unsigned_int;
+
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned())
+    {
+      cell_index = cell->active_cell_index();
+      break;
+    }
+
   quadrature_point_history.update_values(
+    cell_index,
     0, // q_point
     slip_values,
     old_slip_values);
 
   quadrature_point_history.store_current_values();
 
-  std::vector<double> slip_resistances =
-    quadrature_point_history.get_slip_resistances();
+  const dealii::ArrayView<const double> committed_slip_resistances =
+    quadrature_point_history.get_slip_resistances(cell_index, 0);
+
+  std::vector<double> slip_resistances(committed_slip_resistances.begin(),
+                                       committed_slip_resistances.end());
 
   for (unsigned int i = 0; i  < crystals_data->get_n_slips(); ++i)
     std::cout
@@ -375,13 +484,16 @@ void CrystalData<dim>::test_constitutive_laws()
       << "\n\n";
 
 
-  const dealii::FullMatrix<double> gateaux_derivative_matrix =
-    scalar_microstress_law.get_jacobian(
-      0, // q_point
-      slip_values,
-      old_slip_values,
-      slip_resistances,
-      time_step_size);
+  dealii::FullMatrix<double> gateaux_derivative_matrix(
+    crystals_data->get_n_slips());
+
+  scalar_microstress_law.get_jacobian(
+    0, // q_point
+    slip_values,
+    old_slip_values,
+    slip_resistances,
+    time_step_size,
+    gateaux_derivative_matrix);
 
   std::cout
     << std::setw(string_width) << std::left
@@ -421,6 +533,124 @@ void CrystalData<dim>::test_constitutive_laws()
       << gCP::Utilities::get_tensor_as_string(vectorial_microstresses[slip_id])
       << "\n\n";
 
+  // Compare the point-wise and the batched evaluations against the
+  // definition of the vectorial microstress, for the quadratic case
+  // and a general one
+  for (const double defect_energy_index : {2.0, 3.5})
+  {
+    gCP::RunTimeParameters::VectorMicroscopicStressLawParameters
+      vectorial_microstress_law_parameters =
+        parameters.solver_parameters.constitutive_laws_parameters.vectorial_microstress_law_parameters;
+
+    vectorial_microstress_law_parameters.defect_energy_index =
+      defect_energy_index;
+
+    gCP::ConstitutiveLaws::VectorialMicrostressLaw<dim>
+      local_vectorial_microstress_law(crystals_data,
+                                      vectorial_microstress_law_parameters);
+
+    local_vectorial_microstress_law.init();
+
+    const unsigned int n_slips    = crystals_data->get_n_slips();
+
+    const unsigned int n_q_points = 4;
+
+    const double prefactor =
+      vectorial_microstress_law_parameters.initial_slip_resistance *
+      std::pow(vectorial_microstress_law_parameters.energetic_length_scale,
+               defect_energy_index);
+
+    std::vector<std::vector<dealii::Tensor<1,dim>>> slip_gradient_values(
+      n_slips,
+      std::vector<dealii::Tensor<1,dim>>(n_q_points));
+
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+      for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+        for (unsigned int i = 0; i < dim; ++i)
+          slip_gradient_values[slip_id][q_point][i] =
+            std::sin(1.0 + slip_id + 2.0 * q_point + 3.0 * i);
+
+    std::vector<std::vector<dealii::Tensor<1,dim>>> batched_microstresses(
+      n_slips,
+      std::vector<dealii::Tensor<1,dim>>(n_q_points));
+
+    std::vector<std::vector<dealii::SymmetricTensor<2,dim>>> batched_jacobians(
+      n_q_points,
+      std::vector<dealii::SymmetricTensor<2,dim>>(n_slips));
+
+    local_vectorial_microstress_law.get_vectorial_microstresses(
+      0, slip_gradient_values, batched_microstresses);
+
+    local_vectorial_microstress_law.get_jacobians(
+      0, slip_gradient_values, batched_jacobians);
+
+    double max_error = 0.0;
+
+    for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+      for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+      {
+        const dealii::Tensor<1,dim> &slip_gradient_value =
+          slip_gradient_values[slip_id][q_point];
+
+        const dealii::Tensor<1,dim> &slip_direction =
+          crystals_data->get_slip_direction(0, slip_id);
+
+        const dealii::Tensor<1,dim> &slip_orthogonal =
+          crystals_data->get_slip_orthogonal(0, slip_id);
+
+        const double direction_projection =
+          slip_direction * slip_gradient_value;
+
+        const double orthogonal_projection =
+          slip_orthogonal * slip_gradient_value;
+
+        const dealii::Tensor<1,dim> reference_microstress =
+          prefactor *
+          (std::pow(std::abs(direction_projection), defect_energy_index - 2.) *
+             direction_projection * slip_direction
+           +
+           std::pow(std::abs(orthogonal_projection), defect_energy_index - 2.) *
+             orthogonal_projection * slip_orthogonal);
+
+        const dealii::SymmetricTensor<2,dim> reference_jacobian =
+          prefactor * (defect_energy_index - 1.0) *
+          (std::pow(std::abs(direction_projection), defect_energy_index - 2.) *
+             dealii::symmetrize(dealii::outer_product(slip_direction,
+                                                      slip_direction))
+           +
+           std::pow(std::abs(orthogonal_projection), defect_energy_index - 2.) *
+             dealii::symmetrize(dealii::outer_product(slip_orthogonal,
+                                                      slip_orthogonal)));
+
+        const double microstress_norm = 1.0 + reference_microstress.norm();
+
+        const double jacobian_norm    = 1.0 + reference_jacobian.norm();
+
+        max_error =
+          std::max({max_error,
+                    (batched_microstresses[slip_id][q_point] -
+                     reference_microstress).norm() / microstress_norm,
+                    (local_vectorial_microstress_law.get_vectorial_microstress(
+                       0, slip_id, slip_gradient_value) -
+                     reference_microstress).norm() / microstress_norm,
+                    (batched_jacobians[q_point][slip_id] -
+                     reference_jacobian).norm() / jacobian_norm,
+                    (local_vectorial_microstress_law.get_jacobian(
+                       0, slip_id, slip_gradient_value) -
+                     reference_jacobian).norm() / jacobian_norm});
+      }
+
+    std::cout
+      << std::setw(string_width) << std::left
+      << (" Evaluation error (p = " + std::to_string(defect_energy_index) + ")")
+      << " = " << max_error << "\n\n";
+
+    AssertThrow(max_error < 1e-12,
+                dealii::ExcMessage("The evaluation of the vectorial "
+                                   "microstress law does not match its "
+                                   "definition."));
+  }
+
   std::cout << "Testing MicroscopicTractionLaw<dim> \n\n";
 
   std::vector<dealii::Tensor<1,dim>> normal_vector_values(1);
@@ -557,6 +787,125 @@ void CrystalData<dim>::test_constitutive_laws()
     << cohesive_law_free_energy_density
     << "\n\n";
 
+  // Compare the batched evaluation of the grain boundary laws against
+  // their evaluation one quadrature point at a time. Even points are
+  // loading, odd points unloading and every third one is in contact
+  {
+    const gCP::ConstitutiveLaws::ContactLaw<dim> contact_law(
+      parameters.solver_parameters.constitutive_laws_parameters.contact_law_parameters);
+
+    const unsigned int n_points = 12;
+
+    const double time_step_size = 0.1;
+
+    std::vector<dealii::Tensor<1,dim>>          opening_displacements(n_points);
+    std::vector<dealii::Tensor<1,dim>>          normal_vectors(n_points);
+    std::vector<double>                         max_effective_opening_displacements(n_points);
+    std::vector<double>                         old_effective_opening_displacements(n_points);
+    std::vector<dealii::Tensor<1,dim>>          cohesive_tractions(n_points);
+    std::vector<dealii::Tensor<1,dim>>          contact_tractions(n_points);
+    std::vector<dealii::SymmetricTensor<2,dim>> cohesive_law_jacobians(n_points);
+    std::vector<dealii::SymmetricTensor<2,dim>> contact_law_jacobians(n_points);
+
+    for (unsigned int q_point = 0; q_point < n_points; ++q_point)
+    {
+      normal_vectors[q_point][0] = std::cos(0.3 * q_point);
+      normal_vectors[q_point][1] = std::sin(0.3 * q_point);
+
+      for (unsigned int i = 0; i < dim; ++i)
+        opening_displacements[q_point][i] = 1e-3 * (1.0 + q_point + i);
+
+      if (q_point % 3 == 0)
+        opening_displacements[q_point] -=
+          2.0 * (opening_displacements[q_point] * normal_vectors[q_point]) *
+          normal_vectors[q_point];
+
+      const double effective_opening_displacement =
+        cohesive_law.get_effective_opening_displacement(
+          opening_displacements[q_point],
+          normal_vectors[q_point]);
+
+      max_effective_opening_displacements[q_point] =
+        (q_point % 2 == 0 ? 1.0 : 1.5) * effective_opening_displacement;
+
+      old_effective_opening_displacements[q_point] =
+        0.5 * effective_opening_displacement;
+    }
+
+    cohesive_law.get_cohesive_tractions(opening_displacements,
+                                        normal_vectors,
+                                        max_effective_opening_displacements,
+                                        cohesive_tractions);
+
+    cohesive_law.get_jacobians(opening_displacements,
+                               normal_vectors,
+                               max_effective_opening_displacements,
+                               old_effective_opening_displacements,
+                               time_step_size,
+                               cohesive_law_jacobians);
+
+    contact_law.get_contact_tractions(opening_displacements,
+                                      normal_vectors,
+                                      contact_tractions);
+
+    contact_law.get_jacobians(opening_displacements,
+                              normal_vectors,
+                              contact_law_jacobians);
+
+    double max_error = 0.0;
+
+    for (unsigned int q_point = 0; q_point < n_points; ++q_point)
+    {
+      const dealii::Tensor<1,dim> cohesive_traction =
+        cohesive_law.get_cohesive_traction(
+          opening_displacements[q_point],
+          normal_vectors[q_point],
+          max_effective_opening_displacements[q_point],
+          old_effective_opening_displacements[q_point],
+          time_step_size);
+
+      const dealii::SymmetricTensor<2,dim> cohesive_law_jacobian =
+        cohesive_law.get_jacobian(
+          opening_displacements[q_point],
+          normal_vectors[q_point],
+          max_effective_opening_displacements[q_point],
+          old_effective_opening_displacements[q_point],
+          time_step_size);
+
+      const dealii::Tensor<1,dim> contact_traction =
+        contact_law.get_contact_traction(
+          opening_displacements[q_point],
+          normal_vectors[q_point]);
+
+      const dealii::SymmetricTensor<2,dim> contact_law_jacobian =
+        contact_law.get_jacobian(
+          opening_displacements[q_point],
+          normal_vectors[q_point]);
+
+      max_error =
+        std::max({max_error,
+                  (cohesive_traction - cohesive_tractions[q_point]).norm() /
+                    (1.0 + cohesive_traction.norm()),
+                  (cohesive_law_jacobian - cohesive_law_jacobians[q_point]).norm() /
+                    (1.0 + cohesive_law_jacobian.norm()),
+                  (contact_traction - contact_tractions[q_point]).norm() /
+                    (1.0 + contact_traction.norm()),
+                  (contact_law_jacobian - contact_law_jacobians[q_point]).norm() /
+                    (1.0 + contact_law_jacobian.norm())});
+    }
+
+    std::cout
+      << std::setw(string_width) << std::left
+      << " Batched evaluation error" << " = "
+      << max_error
+      << "\n\n";
+
+    AssertThrow(max_error < 1e-12,
+                dealii::ExcMessage("The batched evaluation of the grain "
+                                   "boundary laws does not match the "
+                                   "point-wise one."));
+  }
+
 
   std::cout << "Testing InterfaceQuadraturePointHistory<dim> \n\n";
 
@@ -570,9 +919,12 @@ void CrystalData<dim>::test_constitutive_laws()
   const double old_damage_value =
     interface_quadrature_point_history.get_damage_variable();
 
+  // The committed values are those of the initial state
   interface_quadrature_point_history.update_values(
     effective_opening_displacement,
-    thermodynamic_force);
+    thermodynamic_force,
+    gCP::InterfaceQuadraturePointHistory<dim>::CommittedValues{0.0, 0.0, 0.0},
+    cohesive_law);
 
   const double damage_value =
     interface_quadrature_point_history.get_damage_variable();
@@ -0,0 +1,282 @@
+#include <gCP/utilities.h>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <cmath>
+#include <functional>
+#include <string>
+
+
+
+namespace Tests
+{
+
+
+
+template<int dim>
+class GrainBoundaryRefinement
+{
+public:
+
+  GrainBoundaryRefinement();
+
+  void run();
+
+private:
+
+  dealii::ConditionalOStream                    pcout;
+
+  dealii::parallel::distributed::Triangulation<dim>
+                                                triangulation;
+
+  void make_grid();
+
+  /*!
+   * @brief Flags the locally owned cells for which @p predicate is true
+   * for refinement or coarsening, matches the flags at the grain
+   * boundary and executes the refinement. Cells on the level
+   * @p max_level or finer are not refined.
+   */
+  void refine_grid(
+    const std::function<bool(
+      const typename dealii::Triangulation<dim>::active_cell_iterator &)>
+      &predicate,
+    const bool flag_coarsen,
+    const unsigned int max_level = dealii::numbers::invalid_unsigned_int);
+
+  void check_grain_boundary(const std::string &step_name) const;
+};
+
+
+
+template<int dim>
+GrainBoundaryRefinement<dim>::GrainBoundaryRefinement()
+:
+pcout(
+  std::cout,
+  dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0),
+triangulation(MPI_COMM_WORLD)
+{}
+
+
+
+template<int dim>
+void GrainBoundaryRefinement<dim>::run()
+{
+  make_grid();
+
+  check_grain_boundary("Initial grid");
+
+  // Only the cells of the first crystal at the grain boundary are
+  // flagged for refinement. On two processes they are all owned by the
+  // first one.
+  refine_grid(
+    [](const typename dealii::Triangulation<dim>::active_cell_iterator &cell)
+    {
+      return (cell->material_id() == 1 &&
+              std::fabs(cell->center()[0] - 1.0) < cell->diameter());
+    },
+    false);
+
+  check_grain_boundary("Refinement of one side");
+
+  // Only the cells of the second crystal are flagged for coarsening
+  refine_grid(
+    [](const typename dealii::Triangulation<dim>::active_cell_iterator &cell)
+    {
+      return (cell->material_id() == 2);
+    },
+    true);
+
+  check_grain_boundary("Coarsening of one side");
+
+  // The cells of the second crystal and those of the upper half of the
+  // first crystal are flagged for coarsening. The families of the
+  // second crystal next to the lower half have to be kept
+  refine_grid(
+    [](const typename dealii::Triangulation<dim>::active_cell_iterator &cell)
+    {
+      return (cell->material_id() == 2 ||
+              cell->center()[1] > 0.5);
+    },
+    true);
+
+  check_grain_boundary("Coarsening of an incomplete family");
+
+  // All cells of the first crystal are flagged for refinement, but the
+  // finest level is capped. Its cells on the finest level are thus not
+  // refined and neither are their neighbours across the grain boundary
+  const unsigned int max_level = triangulation.n_global_levels() - 1;
+
+  refine_grid(
+    [](const typename dealii::Triangulation<dim>::active_cell_iterator &cell)
+    {
+      return (cell->material_id() == 1);
+    },
+    false,
+    max_level);
+
+  check_grain_boundary("Refinement up to the level cap");
+
+  AssertThrow(triangulation.n_global_levels() - 1 == max_level,
+              dealii::ExcMessage("The level cap was exceeded."));
+}
+
+
+
+template<int dim>
+void GrainBoundaryRefinement<dim>::make_grid()
+{
+  // Two coarse cells, i.e., one per process on two processes, with
+  // the grain boundary between them
+  std::vector<unsigned int> repetitions(dim, 1);
+
+  repetitions[0] = 2;
+
+  dealii::Point<dim> top_right;
+
+  for (unsigned int d = 0; d < dim; ++d)
+    top_right[d] = 1.0;
+
+  top_right[0] = 2.0;
+
+  dealii::GridGenerator::subdivided_hyper_rectangle(triangulation,
+                                                    repetitions,
+                                                    dealii::Point<dim>(),
+                                                    top_right);
+
+  // The material identifiers are set on the coarse grid and are thus
+  // known to all processes
+  for (const auto &cell : triangulation.active_cell_iterators())
+    cell->set_material_id(cell->center()[0] < 1.0 ? 1 : 2);
+
+  triangulation.refine_global(dim == 2 ? 3 : 2);
+}
+
+
+
+template<int dim>
+void GrainBoundaryRefinement<dim>::refine_grid(
+  const std::function<bool(
+    const typename dealii::Triangulation<dim>::active_cell_iterator &)>
+    &predicate,
+  const bool          flag_coarsen,
+  const unsigned int  max_level)
+{
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned() && predicate(cell))
+    {
+      if (flag_coarsen)
+        cell->set_coarsen_flag();
+      else
+        cell->set_refine_flag();
+    }
+
+  gCP::Utilities::match_refinement_flags_at_grain_boundaries(triangulation,
+                                                             max_level);
+
+  triangulation.execute_coarsening_and_refinement();
+}
+
+
+
+template<int dim>
+void GrainBoundaryRefinement<dim>::check_grain_boundary(
+  const std::string &step_name) const
+{
+  unsigned int n_grain_boundary_faces = 0;
+
+  unsigned int n_non_conforming_faces = 0;
+
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned())
+      for (const auto &face_index : cell->face_indices())
+        if (!cell->face(face_index)->at_boundary() &&
+            cell->material_id() !=
+              cell->neighbor(face_index)->material_id())
+        {
+          ++n_grain_boundary_faces;
+
+          if (!cell->neighbor(face_index)->is_active() ||
+              cell->neighbor_is_coarser(face_index))
+            ++n_non_conforming_faces;
+        }
+
+  n_grain_boundary_faces =
+    dealii::Utilities::MPI::sum(n_grain_boundary_faces, MPI_COMM_WORLD);
+
+  n_non_conforming_faces =
+    dealii::Utilities::MPI::sum(n_non_conforming_faces, MPI_COMM_WORLD);
+
+  pcout << step_name << " (" << dim << "D, "
+        << dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD)
+        << " processes)" << std::endl
+        << "  Number of active cells           = "
+        << triangulation.n_global_active_cells() << std::endl
+        << "  Number of grain boundary faces   = "
+        << n_grain_boundary_faces << std::endl
+        << "  Number of non-conforming faces   = "
+        << n_non_conforming_faces << std::endl;
+
+  AssertThrow(n_grain_boundary_faces > 0,
+              dealii::ExcMessage("The grid has no grain boundary."));
+
+  AssertThrow(n_non_conforming_faces == 0,
+              dealii::ExcMessage("The grain boundary is not conforming."));
+}
+
+
+
+} // namespace Tests
+
+
+
+int main(int argc, char *argv[])
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(
+      argc, argv, dealii::numbers::invalid_unsigned_int);
+
+    {
+      Tests::GrainBoundaryRefinement<2> test;
+      test.run();
+    }
+
+    {
+      Tests::GrainBoundaryRefinement<3> test;
+      test.run();
+    }
+  }
+  catch (std::exception &exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    return 1;
+  }
+  return 0;
+}
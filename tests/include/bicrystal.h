@@ -0,0 +1,399 @@
+#ifndef INCLUDE_BICRYSTAL_H_
+#define INCLUDE_BICRYSTAL_H_
+
+#include <gCP/crystal_data.h>
+#include <gCP/fe_field.h>
+#include <gCP/gradient_crystal_plasticity.h>
+#include <gCP/run_time_parameters.h>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/discrete_time.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+
+
+namespace Tests
+{
+
+
+
+/*!
+ * @brief Shear load applied to the displacements of all crystals in
+ * the y-direction
+ */
+template <int dim>
+class ShearLoad : public dealii::Function<dim>
+{
+public:
+  ShearLoad(const std::vector<unsigned int> &components,
+            const unsigned int              n_components,
+            const double                    rate);
+
+  virtual void vector_value(
+    const dealii::Point<dim>  &point,
+    dealii::Vector<double>    &return_vector) const override;
+
+private:
+  const std::vector<unsigned int> components;
+
+  const double                    rate;
+};
+
+
+
+template <int dim>
+ShearLoad<dim>::ShearLoad(
+  const std::vector<unsigned int> &components,
+  const unsigned int              n_components,
+  const double                    rate)
+:
+dealii::Function<dim>(n_components),
+components(components),
+rate(rate)
+{}
+
+
+
+template <int dim>
+void ShearLoad<dim>::vector_value(
+  const dealii::Point<dim>  &/*point*/,
+  dealii::Vector<double>    &return_vector) const
+{
+  return_vector = 0.0;
+
+  for (const unsigned int component : components)
+    return_vector[component] = rate * this->get_time();
+}
+
+
+
+/*!
+ * @brief Returns @p parameters with decohesion and microtraction at
+ * the grain boundaries. The log of the nonlinear solver is written to
+ * the file prefixed by @p logger_prefix
+ */
+inline gCP::RunTimeParameters::ProblemParameters make_parameters(
+  const gCP::RunTimeParameters::ProblemParameters &parameters,
+  const std::string                               &logger_prefix)
+{
+  gCP::RunTimeParameters::ProblemParameters bicrystal_parameters(parameters);
+
+  bicrystal_parameters.solver_parameters.logger_output_directory =
+    logger_prefix;
+
+  bicrystal_parameters.solver_parameters.allow_decohesion = true;
+
+  bicrystal_parameters.solver_parameters.
+    boundary_conditions_at_grain_boundaries =
+      gCP::RunTimeParameters::BoundaryConditionsAtGrainBoundaries::
+        Microtraction;
+
+  return (bicrystal_parameters);
+}
+
+
+
+/*!
+ * @brief Bicrystal under shear with decohesion and microtraction at
+ * the grain boundary
+ */
+template <int dim>
+class Bicrystal
+{
+public:
+  Bicrystal(const gCP::RunTimeParameters::ProblemParameters &parameters,
+            const std::string                               &logger_prefix);
+
+  /*!
+   * @brief Sets up the problem. The refinement of the coarse grid is
+   * loaded from @p checkpoint_prefix if it is not empty
+   */
+  void setup(const std::string &checkpoint_prefix = "");
+
+  /*!
+   * @brief Solves for the next time step and advances the time
+   */
+  void advance();
+
+  /*!
+   * @brief Executes the coarsening and refinement flagged in
+   * @ref triangulation, transferring the solution vectors and the
+   * quadrature point history, and sets up the problem anew
+   */
+  void execute_coarsening_and_refinement();
+
+  gCP::RunTimeParameters::ProblemParameters         parameters;
+
+  std::shared_ptr<dealii::ConditionalOStream>       pcout;
+
+  std::shared_ptr<dealii::TimerOutput>              timer_output;
+
+  std::shared_ptr<dealii::Mapping<dim>>             mapping;
+
+  dealii::DiscreteTime                              discrete_time;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation;
+
+  std::shared_ptr<gCP::FEField<dim>>                fe_field;
+
+  std::shared_ptr<gCP::CrystalsData<dim>>           crystals_data;
+
+  gCP::GradientCrystalPlasticitySolver<dim>         gCP_solver;
+
+private:
+  std::unique_ptr<ShearLoad<dim>>                   shear_load;
+
+  void make_grid(const std::string &checkpoint_prefix);
+
+  void setup_constraints();
+};
+
+
+
+template <int dim>
+Bicrystal<dim>::Bicrystal(
+  const gCP::RunTimeParameters::ProblemParameters &parameters_,
+  const std::string                               &logger_prefix)
+:
+parameters(make_parameters(parameters_, logger_prefix)),
+pcout(std::make_shared<dealii::ConditionalOStream>(
+  std::cout,
+  dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)),
+timer_output(std::make_shared<dealii::TimerOutput>(
+  MPI_COMM_WORLD,
+  *pcout,
+  dealii::TimerOutput::never,
+  dealii::TimerOutput::wall_times)),
+mapping(std::make_shared<dealii::MappingQ<dim>>(1)),
+discrete_time(
+  parameters.temporal_discretization_parameters.start_time,
+  parameters.temporal_discretization_parameters.end_time,
+  parameters.temporal_discretization_parameters.time_step_size),
+triangulation(MPI_COMM_WORLD),
+fe_field(std::make_shared<gCP::FEField<dim>>(
+  triangulation,
+  parameters.fe_degree_displacements,
+  parameters.fe_degree_slips,
+  true)),
+crystals_data(std::make_shared<gCP::CrystalsData<dim>>()),
+gCP_solver(
+  parameters.solver_parameters,
+  parameters.temporal_discretization_parameters,
+  discrete_time,
+  fe_field,
+  crystals_data,
+  mapping,
+  pcout,
+  timer_output)
+{}
+
+
+
+template <int dim>
+void Bicrystal<dim>::setup(const std::string &checkpoint_prefix)
+{
+  make_grid(checkpoint_prefix);
+
+  crystals_data->init(triangulation,
+                      parameters.euler_angles_pathname,
+                      parameters.slips_directions_pathname,
+                      parameters.slips_normals_pathname);
+
+  fe_field->setup_extractors(crystals_data->get_n_crystals(),
+                             crystals_data->get_n_slips());
+
+  fe_field->update_ghost_material_ids();
+
+  for (const auto &cell :
+       fe_field->get_dof_handler().active_cell_iterators())
+    if (cell->is_locally_owned())
+      cell->set_active_fe_index(cell->material_id());
+
+  fe_field->setup_dofs();
+
+  std::vector<unsigned int> components;
+
+  for (unsigned int crystal_id = 0;
+       crystal_id < crystals_data->get_n_crystals();
+       ++crystal_id)
+    components.push_back(
+      fe_field->get_displacement_extractor(crystal_id).
+        first_vector_component + 1);
+
+  shear_load = std::make_unique<ShearLoad<dim>>(
+    components, fe_field->get_n_components(), 10.0);
+
+  setup_constraints();
+
+  fe_field->setup_vectors();
+
+  gCP_solver.init();
+}
+
+
+
+template <int dim>
+void Bicrystal<dim>::make_grid(const std::string &checkpoint_prefix)
+{
+  // Two coarse cells with the grain boundary between them. The left
+  // and right boundaries have the identifiers 0 and 1
+  std::vector<unsigned int> repetitions(dim, 1);
+
+  repetitions[0] = 2;
+
+  dealii::Point<dim> top_right;
+
+  for (unsigned int d = 0; d < dim; ++d)
+    top_right[d] = 1.0;
+
+  top_right[0] = 2.0;
+
+  dealii::GridGenerator::subdivided_hyper_rectangle(triangulation,
+                                                    repetitions,
+                                                    dealii::Point<dim>(),
+                                                    top_right,
+                                                    true);
+
+  for (const auto &cell : triangulation.active_cell_iterators())
+    cell->set_material_id(cell->center()[0] < 1.0 ? 0 : 1);
+
+  if (checkpoint_prefix.empty())
+    triangulation.refine_global(dim == 2 ? 2 : 1);
+  else
+    triangulation.load(checkpoint_prefix);
+}
+
+
+
+template <int dim>
+void Bicrystal<dim>::setup_constraints()
+{
+  shear_load->set_time(discrete_time.get_next_time());
+
+  dealii::Functions::ZeroFunction<dim> zero_function(
+    fe_field->get_n_components());
+
+  // The left boundary is clamped and the right one is sheared. The
+  // slips vanish at both of them
+  auto make_constraints = [&](const dealii::Function<dim> &load)
+  {
+    dealii::AffineConstraints<double> constraints;
+
+    constraints.reinit(fe_field->get_locally_relevant_dofs());
+
+    constraints.merge(fe_field->get_hanging_node_constraints());
+
+    for (unsigned int crystal_id = 0;
+         crystal_id < crystals_data->get_n_crystals();
+         ++crystal_id)
+    {
+      dealii::VectorTools::interpolate_boundary_values(
+        *mapping,
+        fe_field->get_dof_handler(),
+        0,
+        zero_function,
+        constraints,
+        fe_field->get_fe_collection().component_mask(
+          fe_field->get_displacement_extractor(crystal_id)));
+
+      dealii::VectorTools::interpolate_boundary_values(
+        *mapping,
+        fe_field->get_dof_handler(),
+        1,
+        load,
+        constraints,
+        fe_field->get_fe_collection().component_mask(
+          fe_field->get_displacement_extractor(crystal_id)));
+
+      for (unsigned int slip_id = 0;
+           slip_id < crystals_data->get_n_slips();
+           ++slip_id)
+        for (const dealii::types::boundary_id boundary_id : {0, 1})
+          dealii::VectorTools::interpolate_boundary_values(
+            *mapping,
+            fe_field->get_dof_handler(),
+            boundary_id,
+            zero_function,
+            constraints,
+            fe_field->get_fe_collection().component_mask(
+              fe_field->get_slip_extractor(crystal_id, slip_id)));
+    }
+
+    constraints.close();
+
+    return (constraints);
+  };
+
+  fe_field->set_affine_constraints(make_constraints(*shear_load));
+
+  fe_field->set_newton_method_constraints(make_constraints(zero_function));
+}
+
+
+
+template <int dim>
+void Bicrystal<dim>::advance()
+{
+  setup_constraints();
+
+  const auto results = gCP_solver.solve_nonlinear_system();
+
+  AssertThrow(std::get<0>(results),
+              dealii::ExcMessage("The nonlinear solver did not converge."));
+
+  fe_field->update_solution_vectors();
+
+  discrete_time.advance_time();
+}
+
+
+
+template <int dim>
+void Bicrystal<dim>::execute_coarsening_and_refinement()
+{
+  gCP_solver.prepare_for_coarsening_and_refinement(triangulation);
+
+  triangulation.execute_coarsening_and_refinement();
+
+  // The children inherit the material id of their parent
+  fe_field->update_ghost_material_ids();
+
+  for (const auto &cell :
+       fe_field->get_dof_handler().active_cell_iterators())
+    if (cell->is_locally_owned())
+      cell->set_active_fe_index(cell->material_id());
+
+  fe_field->setup_dofs();
+
+  setup_constraints();
+
+  fe_field->setup_vectors();
+
+  gCP_solver.init();
+
+  gCP_solver.interpolate_after_coarsening_and_refinement();
+}
+
+
+
+} // namespace Tests
+
+
+
+#endif /* INCLUDE_BICRYSTAL_H_ */
@@ -0,0 +1,223 @@
+#ifndef INCLUDE_SOLVER_ACCESS_H_
+#define INCLUDE_SOLVER_ACCESS_H_
+
+#include <gCP/gradient_crystal_plasticity.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/trilinos_vector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+
+namespace Tests
+{
+
+
+
+/*!
+ * @brief Access of the tests to the internals of
+ * gCP::GradientCrystalPlasticitySolver, of which it is a friend
+ */
+template <int dim>
+class SolverAccess
+{
+public:
+  /*!
+   * @brief See
+   * gCP::GradientCrystalPlasticitySolver::compute_matrix_free_jacobian_error
+   */
+  static double compute_matrix_free_jacobian_error(
+    gCP::GradientCrystalPlasticitySolver<dim>         &solver,
+    const dealii::LinearAlgebraTrilinos::MPI::Vector  &src);
+
+  /*!
+   * @brief Sets the trial and the committed slip resistances of all
+   * slip systems at all quadrature points of the locally owned cells
+   * to @p slip_resistance and the trial and committed internal
+   * variables of the cohesive law at their grain boundary faces to
+   * @p committed_values
+   */
+  static void set_quadrature_point_history(
+    gCP::GradientCrystalPlasticitySolver<dim> &solver,
+    const double                              slip_resistance,
+    const typename gCP::InterfaceQuadraturePointHistory<dim>::
+      CommittedValues                         &committed_values);
+
+  /*!
+   * @brief Returns the maximum difference over all processes between
+   * the slip resistances and @p slip_resistance. See
+   * @ref set_quadrature_point_history
+   */
+  static double compute_slip_resistance_error(
+    const gCP::GradientCrystalPlasticitySolver<dim> &solver,
+    const double                                    slip_resistance);
+
+  /*!
+   * @brief Returns the maximum difference over all processes between
+   * the internal variables of the cohesive law and
+   * @p committed_values. See @ref set_quadrature_point_history
+   */
+  static double compute_interface_values_error(
+    gCP::GradientCrystalPlasticitySolver<dim> &solver,
+    const typename gCP::InterfaceQuadraturePointHistory<dim>::
+      CommittedValues                         &committed_values);
+};
+
+
+
+template <int dim>
+double SolverAccess<dim>::compute_matrix_free_jacobian_error(
+  gCP::GradientCrystalPlasticitySolver<dim>         &solver,
+  const dealii::LinearAlgebraTrilinos::MPI::Vector  &src)
+{
+  return (solver.compute_matrix_free_jacobian_error(src));
+}
+
+
+
+template <int dim>
+void SolverAccess<dim>::set_quadrature_point_history(
+  gCP::GradientCrystalPlasticitySolver<dim> &solver,
+  const double                              slip_resistance,
+  const typename gCP::InterfaceQuadraturePointHistory<dim>::
+    CommittedValues                         &committed_values)
+{
+  const unsigned int n_q_points =
+    solver.quadrature_collection.max_n_quadrature_points();
+
+  const std::vector<double> slip_resistances(
+    solver.crystals_data->get_n_slips(), slip_resistance);
+
+  for (const auto &cell :
+       solver.fe_field->get_triangulation().active_cell_iterators())
+    if (cell->is_locally_owned())
+      for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+        solver.quadrature_point_history.set_slip_resistances(
+          cell->active_cell_index(),
+          q_point,
+          dealii::make_array_view(slip_resistances));
+
+  for (const auto &grain_boundary_face : solver.grain_boundary_faces)
+  {
+    const dealii::ArrayView<gCP::InterfaceQuadraturePointHistory<dim>>
+      local_interface_quadrature_point_history =
+        solver.interface_quadrature_point_history.get_data(
+          grain_boundary_face.interface_id);
+
+    for (unsigned int face_q_point = 0;
+         face_q_point < local_interface_quadrature_point_history.size();
+         ++face_q_point)
+    {
+      local_interface_quadrature_point_history[face_q_point].reset_values(
+        committed_values);
+
+      solver.set_committed_interface_values(
+        grain_boundary_face.interface_id,
+        face_q_point,
+        committed_values);
+    }
+  }
+}
+
+
+
+template <int dim>
+double SolverAccess<dim>::compute_slip_resistance_error(
+  const gCP::GradientCrystalPlasticitySolver<dim> &solver,
+  const double                                    slip_resistance)
+{
+  const unsigned int n_q_points =
+    solver.quadrature_collection.max_n_quadrature_points();
+
+  const unsigned int n_slips = solver.crystals_data->get_n_slips();
+
+  double error = 0.0;
+
+  for (const auto &cell :
+       solver.fe_field->get_triangulation().active_cell_iterators())
+    if (cell->is_locally_owned())
+      for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+        for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+          error =
+            std::max({error,
+                      std::fabs(
+                        solver.quadrature_point_history.
+                          get_slip_resistance(cell->active_cell_index(),
+                                              q_point,
+                                              slip_id) -
+                        slip_resistance),
+                      std::fabs(
+                        solver.quadrature_point_history.
+                          get_committed_slip_resistance(
+                            cell->active_cell_index(),
+                            q_point,
+                            slip_id) -
+                        slip_resistance)});
+
+  return (dealii::Utilities::MPI::max(error, MPI_COMM_WORLD));
+}
+
+
+
+template <int dim>
+double SolverAccess<dim>::compute_interface_values_error(
+  gCP::GradientCrystalPlasticitySolver<dim> &solver,
+  const typename gCP::InterfaceQuadraturePointHistory<dim>::
+    CommittedValues                         &committed_values)
+{
+  double error = 0.0;
+
+  for (const auto &grain_boundary_face : solver.grain_boundary_faces)
+  {
+    const dealii::ArrayView<gCP::InterfaceQuadraturePointHistory<dim>>
+      local_interface_quadrature_point_history =
+        solver.interface_quadrature_point_history.get_data(
+          grain_boundary_face.interface_id);
+
+    for (unsigned int face_q_point = 0;
+         face_q_point < local_interface_quadrature_point_history.size();
+         ++face_q_point)
+    {
+      const auto &trial_values =
+        local_interface_quadrature_point_history[face_q_point];
+
+      const typename gCP::InterfaceQuadraturePointHistory<dim>::
+        CommittedValues stored_committed_values =
+          solver.get_committed_interface_values(
+            grain_boundary_face.interface_id,
+            face_q_point);
+
+      error =
+        std::max({error,
+                  std::fabs(trial_values.get_damage_variable() -
+                            committed_values.damage_variable),
+                  std::fabs(
+                    trial_values.get_max_effective_opening_displacement() -
+                    committed_values.max_effective_opening_displacement),
+                  std::fabs(stored_committed_values.damage_variable -
+                            committed_values.damage_variable),
+                  std::fabs(
+                    stored_committed_values.
+                      max_effective_opening_displacement -
+                    committed_values.max_effective_opening_displacement),
+                  std::fabs(
+                    stored_committed_values.
+                      old_effective_opening_displacement -
+                    committed_values.old_effective_opening_displacement)});
+    }
+  }
+
+  return (dealii::Utilities::MPI::max(error, MPI_COMM_WORLD));
+}
+
+
+
+} // namespace Tests
+
+
+
+#endif /* INCLUDE_SOLVER_ACCESS_H_ */
@@ -0,0 +1,155 @@
+#include <gCP/run_time_parameters.h>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+
+#include <bicrystal.h>
+#include <solver_access.h>
+
+#include <cmath>
+#include <string>
+
+
+
+namespace Tests
+{
+
+
+
+/*!
+ * @brief Compares the action of the matrix-free Jacobian with the one
+ * of the assembled Jacobian on a bicrystal with decohesion and
+ * microtraction at the grain boundary
+ *
+ * @details The actions are compared at the initial state and after
+ * each of two time steps, i.e., with and without plastic slips, opening
+ * displacements and damage.
+ */
+template <int dim>
+class MatrixFreeJacobian
+{
+public:
+  MatrixFreeJacobian(
+    const gCP::RunTimeParameters::ProblemParameters &parameters);
+
+  void run();
+
+private:
+  Bicrystal<dim>              bicrystal;
+
+  dealii::ConditionalOStream  pcout;
+
+  void check(const std::string &step_name);
+};
+
+
+
+template <int dim>
+MatrixFreeJacobian<dim>::MatrixFreeJacobian(
+  const gCP::RunTimeParameters::ProblemParameters &parameters)
+:
+bicrystal(parameters,
+          "matrix_free_jacobian_test_" + std::to_string(dim) + "d_"),
+pcout(
+  std::cout,
+  dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+{}
+
+
+
+template <int dim>
+void MatrixFreeJacobian<dim>::run()
+{
+  bicrystal.setup();
+
+  check("Initial state");
+
+  bicrystal.advance();
+
+  check("First time step");
+
+  bicrystal.advance();
+
+  check("Second time step");
+}
+
+
+
+template <int dim>
+void MatrixFreeJacobian<dim>::check(const std::string &step_name)
+{
+  // A source vector without any structure
+  dealii::LinearAlgebraTrilinos::MPI::Vector
+    src(bicrystal.fe_field->distributed_vector);
+
+  for (const auto locally_owned_dof : src.locally_owned_elements())
+    src(locally_owned_dof) = std::sin(1.0 + locally_owned_dof);
+
+  src.compress(dealii::VectorOperation::insert);
+
+  const double error =
+    SolverAccess<dim>::compute_matrix_free_jacobian_error(
+      bicrystal.gCP_solver, src);
+
+  pcout << step_name << " (" << dim << "D)" << std::endl
+        << "  Relative difference = " << error << std::endl;
+
+  AssertThrow(error < 1e-10,
+              dealii::ExcMessage("The matrix-free Jacobian does not match "
+                                 "the assembled one."));
+}
+
+
+
+} // namespace Tests
+
+
+
+int main(int argc, char *argv[])
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(
+      argc, argv, dealii::numbers::invalid_unsigned_int);
+
+    {
+      gCP::RunTimeParameters::ProblemParameters parameters("input/2d.prm");
+
+      Tests::MatrixFreeJacobian<2> test(parameters);
+      test.run();
+    }
+
+    {
+      gCP::RunTimeParameters::ProblemParameters parameters("input/3d.prm");
+
+      Tests::MatrixFreeJacobian<3> test(parameters);
+      test.run();
+    }
+  }
+  catch (std::exception &exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    return 1;
+  }
+  return 0;
+}
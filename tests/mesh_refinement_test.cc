@@ -0,0 +1,239 @@
+#include <gCP/quadrature_point_history.h>
+#include <gCP/run_time_parameters.h>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+
+#include <bicrystal.h>
+#include <solver_access.h>
+
+#include <cmath>
+#include <string>
+#include <tuple>
+
+
+
+namespace Tests
+{
+
+
+
+/*!
+ * @brief Refines a bicrystal with decohesion and microtraction at the
+ * grain boundary globally and coarsens it back
+ *
+ * @details A constant slip resistance and constant internal variables
+ * of the cohesive law are set before the refinement. They have to
+ * survive the projections between the parent and the children cells
+ * and faces. The solution vector is prolongated and restricted, i.e.,
+ * its norms have to be restored once the mesh is coarsened back. The
+ * norms of its displacement and slip parts are additionally checked
+ * against the one of the whole vector on each mesh.
+ */
+template <int dim>
+class MeshRefinement
+{
+public:
+  MeshRefinement(
+    const gCP::RunTimeParameters::ProblemParameters &parameters);
+
+  void run();
+
+private:
+  Bicrystal<dim>                                  bicrystal;
+
+  dealii::ConditionalOStream                      pcout;
+
+  const double                                    slip_resistance;
+
+  const typename gCP::InterfaceQuadraturePointHistory<dim>::
+    CommittedValues                               interface_values;
+
+  /*!
+   * @brief Checks the quadrature point history and returns the norms
+   * of the solution vector, see gCP::FEField::get_l2_norms
+   */
+  std::tuple<double, double, double> check(const std::string &mesh_name);
+};
+
+
+
+template <int dim>
+MeshRefinement<dim>::MeshRefinement(
+  const gCP::RunTimeParameters::ProblemParameters &parameters)
+:
+bicrystal(parameters,
+          "mesh_refinement_test_" + std::to_string(dim) + "d_"),
+pcout(
+  std::cout,
+  dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0),
+slip_resistance(
+  1.25 * parameters.solver_parameters.constitutive_laws_parameters.
+    scalar_microstress_law_parameters.initial_slip_resistance),
+interface_values{0.25, 1e-3, 5e-4}
+{}
+
+
+
+template <int dim>
+void MeshRefinement<dim>::run()
+{
+  bicrystal.setup();
+
+  // A solution vector which does not vanish
+  bicrystal.advance();
+
+  SolverAccess<dim>::set_quadrature_point_history(bicrystal.gCP_solver,
+                                                  slip_resistance,
+                                                  interface_values);
+
+  const unsigned int n_active_cells =
+    bicrystal.triangulation.n_global_active_cells();
+
+  const unsigned int n_dofs = bicrystal.fe_field->n_dofs();
+
+  const std::tuple<double, double, double> initial_norms =
+    check("Initial mesh");
+
+  // Global refinement
+  for (const auto &cell : bicrystal.triangulation.active_cell_iterators())
+    if (cell->is_locally_owned())
+      cell->set_refine_flag();
+
+  bicrystal.execute_coarsening_and_refinement();
+
+  AssertThrow(bicrystal.fe_field->n_dofs() > n_dofs,
+              dealii::ExcMessage("The mesh was not refined."));
+
+  check("Refined mesh");
+
+  // Coarsening back to the initial mesh
+  for (const auto &cell : bicrystal.triangulation.active_cell_iterators())
+    if (cell->is_locally_owned())
+      cell->set_coarsen_flag();
+
+  bicrystal.execute_coarsening_and_refinement();
+
+  AssertThrow(bicrystal.triangulation.n_global_active_cells() ==
+                n_active_cells &&
+              bicrystal.fe_field->n_dofs() == n_dofs,
+              dealii::ExcMessage("The mesh was not coarsened back."));
+
+  const std::tuple<double, double, double> final_norms =
+    check("Coarsened mesh");
+
+  AssertThrow(
+    std::fabs(std::get<0>(final_norms) - std::get<0>(initial_norms)) <=
+      1e-12 * std::get<0>(initial_norms) &&
+    std::fabs(std::get<1>(final_norms) - std::get<1>(initial_norms)) <=
+      1e-12 * std::get<0>(initial_norms) &&
+    std::fabs(std::get<2>(final_norms) - std::get<2>(initial_norms)) <=
+      1e-12 * std::get<0>(initial_norms),
+    dealii::ExcMessage("The solution was not restored."));
+}
+
+
+
+template <int dim>
+std::tuple<double, double, double>
+MeshRefinement<dim>::check(const std::string &mesh_name)
+{
+  const double slip_resistance_error =
+    SolverAccess<dim>::compute_slip_resistance_error(bicrystal.gCP_solver,
+                                                     slip_resistance);
+
+  const double interface_values_error =
+    SolverAccess<dim>::compute_interface_values_error(bicrystal.gCP_solver,
+                                                      interface_values);
+
+  const std::tuple<double, double, double> norms =
+    bicrystal.fe_field->get_l2_norms(bicrystal.fe_field->solution);
+
+  pcout << mesh_name << " (" << dim << "D)" << std::endl
+        << "  Number of active cells            = "
+        << bicrystal.triangulation.n_global_active_cells() << std::endl
+        << "  Slip resistance error             = "
+        << slip_resistance_error << std::endl
+        << "  Internal variables error          = "
+        << interface_values_error << std::endl
+        << "  L2 norm (total, R_U, R_G)         = "
+        << std::get<0>(norms) << ", " << std::get<1>(norms) << ", "
+        << std::get<2>(norms) << std::endl;
+
+  AssertThrow(slip_resistance_error <= 1e-10 * slip_resistance,
+              dealii::ExcMessage("The slip resistances were not "
+                                 "transferred."));
+
+  AssertThrow(interface_values_error <=
+                1e-10 * interface_values.damage_variable,
+              dealii::ExcMessage("The internal variables of the cohesive "
+                                 "law were not transferred."));
+
+  AssertThrow(std::get<0>(norms) > 0.0,
+              dealii::ExcMessage("The solution vanishes."));
+
+  AssertThrow(
+    std::fabs(std::get<0>(norms) * std::get<0>(norms) -
+              std::get<1>(norms) * std::get<1>(norms) -
+              std::get<2>(norms) * std::get<2>(norms)) <=
+      1e-12 * std::get<0>(norms) * std::get<0>(norms),
+    dealii::ExcMessage("The norms of the displacement and slip parts do "
+                       "not add up to the one of the solution."));
+
+  return (norms);
+}
+
+
+
+} // namespace Tests
+
+
+
+int main(int argc, char *argv[])
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(
+      argc, argv, dealii::numbers::invalid_unsigned_int);
+
+    {
+      gCP::RunTimeParameters::ProblemParameters parameters("input/2d.prm");
+
+      Tests::MeshRefinement<2> test(parameters);
+      test.run();
+    }
+
+    {
+      gCP::RunTimeParameters::ProblemParameters parameters("input/3d.prm");
+
+      Tests::MeshRefinement<3> test(parameters);
+      test.run();
+    }
+  }
+  catch (std::exception &exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -1,6 +1,7 @@
 #include <gCP/quadrature_point_history.h>
 
 #include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/quadrature_lib.h>
 
 #include <deal.II/distributed/tria.h>
 
@@ -82,6 +83,10 @@ private:
 
   void read_quadrature_point_history();
 
+  void check_reduced_precision_storage(
+    const gCP::RunTimeParameters::HistoryStoragePrecision precision,
+    const double                                          tolerance);
+
   void output();
 };
 
@@ -126,6 +131,14 @@ void QuadraturePointHistory<dim>::run()
 
   read_quadrature_point_history();
 
+  check_reduced_precision_storage(
+    gCP::RunTimeParameters::HistoryStoragePrecision::Single,
+    1e-5);
+
+  check_reduced_precision_storage(
+    gCP::RunTimeParameters::HistoryStoragePrecision::FixedPoint,
+    1e-6);
+
   output();
 }
 
@@ -267,7 +280,7 @@ void QuadraturePointHistory<dim>::init_quadrature_point_history()
             cell->material_id() !=
               cell->neighbor(face_index)->material_id())
         {
-          const std::vector<std::shared_ptr<gCP::InterfaceData<dim>>>
+          const dealii::ArrayView<gCP::InterfaceData<dim>>
             local_quadrature_point_history =
               interface_data_storage.get_data(
                 cell->id(),
@@ -278,7 +291,7 @@ void QuadraturePointHistory<dim>::init_quadrature_point_history()
 
           for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
           {
-            local_quadrature_point_history[q_point]->init(q_point/10.);
+            local_quadrature_point_history[q_point].init(q_point/10.);
           }
         }
 }
@@ -298,7 +311,7 @@ void QuadraturePointHistory<dim>::prepare_quadrature_point_history_for_update()
             cell->material_id() !=
               cell->neighbor(face_index)->material_id())
         {
-          const std::vector<std::shared_ptr<gCP::InterfaceData<dim>>>
+          const dealii::ArrayView<gCP::InterfaceData<dim>>
             local_quadrature_point_history =
               interface_data_storage.get_data(
                 cell->id(),
@@ -308,7 +321,7 @@ void QuadraturePointHistory<dim>::prepare_quadrature_point_history_for_update()
                   dealii::ExcInternalError());
 
           for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
-            local_quadrature_point_history[q_point]->prepare_for_update_call();
+            local_quadrature_point_history[q_point].prepare_for_update_call();
         }
 }
 
@@ -340,7 +353,7 @@ void QuadraturePointHistory<dim>::update_quadrature_point_history()
           const std::vector<dealii::Point<dim>> quadrature_points =
             fe_face_values.get_quadrature_points();
 
-          const std::vector<std::shared_ptr<gCP::InterfaceData<dim>>>
+          const dealii::ArrayView<gCP::InterfaceData<dim>>
             local_quadrature_point_history =
               interface_data_storage.get_data(
                 cell->id(),
@@ -350,7 +363,7 @@ void QuadraturePointHistory<dim>::update_quadrature_point_history()
                   dealii::ExcInternalError());
 
           for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
-            local_quadrature_point_history[q_point]->update(
+            local_quadrature_point_history[q_point].update(
               quadrature_points[q_point],
               dealii::Tensor<1,dim>());
         }
@@ -371,7 +384,7 @@ void QuadraturePointHistory<dim>::read_quadrature_point_history()
             cell->material_id() !=
               cell->neighbor(face_index)->material_id())
         {
-          const std::vector<std::shared_ptr<gCP::InterfaceData<dim>>>
+          const dealii::ArrayView<gCP::InterfaceData<dim>>
             local_quadrature_point_history =
               interface_data_storage.get_data(
                 cell->id(),
@@ -402,13 +415,171 @@ void QuadraturePointHistory<dim>::read_quadrature_point_history()
           for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
             std::cout
               << " [" << q_point << "].get_values() = "
-              << local_quadrature_point_history[q_point]->get_value()
+              << local_quadrature_point_history[q_point].get_value()
               << "\n";
         }
 }
 
 
 
+template<int dim>
+void QuadraturePointHistory<dim>::check_reduced_precision_storage(
+  const gCP::RunTimeParameters::HistoryStoragePrecision precision,
+  const double                                          tolerance)
+{
+  const gCP::RunTimeParameters::ScalarMicroscopicStressLawParameters
+    parameters;
+
+  const unsigned int n_q_points = dealii::QGauss<dim>(2).size();
+
+  const unsigned int n_slips    = 3;
+
+  const unsigned int n_steps    = 20;
+
+  const double fixed_point_resolution = 1e-6;
+
+  gCP::QuadraturePointHistoryStorage<dim> reference_storage;
+
+  gCP::QuadraturePointHistoryStorage<dim> reduced_precision_storage;
+
+  reference_storage.initialize(parameters,
+                               triangulation,
+                               n_q_points,
+                               n_slips);
+
+  reduced_precision_storage.initialize(parameters,
+                                       triangulation,
+                                       n_q_points,
+                                       n_slips,
+                                       precision,
+                                       fixed_point_resolution);
+
+  std::vector<std::vector<double>> slips(n_slips,
+                                         std::vector<double>(n_q_points));
+
+  std::vector<std::vector<double>> old_slips(slips);
+
+  std::vector<double> trial_slip_resistances;
+
+  double max_error = 0.0;
+
+  double max_slip_resistance = 0.0;
+
+  for (unsigned int step = 1; step <= n_steps; ++step)
+  {
+    // Two pseudo Newton-Raphson iterations, the first of which is
+    // discarded, followed by the commit of the trial values. The
+    // compressed storage holds no trial values. They are computed on
+    // demand and committed once the last iteration converged
+    for (unsigned int iteration = 0; iteration < 2; ++iteration)
+    {
+      for (const auto &cell : triangulation.active_cell_iterators())
+        if (cell->is_locally_owned())
+        {
+          const unsigned int cell_index = cell->active_cell_index();
+
+          for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+            for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+            {
+              const double phase =
+                cell->center()[0] + cell->center()[1] +
+                0.1 * q_point + 0.7 * slip_id;
+
+              old_slips[slip_id][q_point] =
+                1e-4 * (step - 1) * std::sin(phase * (step - 1));
+
+              slips[slip_id][q_point] =
+                1e-4 * (step + iteration) * std::sin(phase * step);
+            }
+
+          for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+            reference_storage.update_values(cell_index,
+                                            q_point,
+                                            slips,
+                                            old_slips);
+
+          const dealii::ArrayView<const double> reference_values =
+            reference_storage.get_slip_resistances(cell_index);
+
+          const dealii::ArrayView<const double> reduced_precision_values =
+            reduced_precision_storage.get_slip_resistances(
+              cell_index,
+              slips,
+              old_slips,
+              trial_slip_resistances);
+
+          AssertDimension(reference_values.size(),
+                          reduced_precision_values.size());
+
+          for (unsigned int i = 0; i < reference_values.size(); ++i)
+            max_error =
+              std::max(max_error,
+                       std::fabs(reference_values[i] -
+                                 reduced_precision_values[i]));
+
+          if (iteration == 1)
+            for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+              reduced_precision_storage.commit_values(cell_index,
+                                                      q_point,
+                                                      slips,
+                                                      old_slips);
+        }
+
+      if (iteration == 0)
+        reference_storage.reset_values();
+    }
+
+    reference_storage.store_current_values();
+
+    for (const auto &cell : triangulation.active_cell_iterators())
+      if (cell->is_locally_owned())
+        for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+          for (unsigned int slip_id = 0; slip_id < n_slips; ++slip_id)
+          {
+            const double reference_value =
+              reference_storage.get_slip_resistance(
+                cell->active_cell_index(), q_point, slip_id);
+
+            const double reduced_precision_value =
+              reduced_precision_storage.get_committed_slip_resistance(
+                cell->active_cell_index(), q_point, slip_id);
+
+            max_error =
+              std::max(max_error,
+                       std::fabs(reference_value - reduced_precision_value));
+
+            max_slip_resistance =
+              std::max(max_slip_resistance, std::fabs(reference_value));
+          }
+  }
+
+  max_error = dealii::Utilities::MPI::max(max_error, MPI_COMM_WORLD);
+
+  max_slip_resistance =
+    dealii::Utilities::MPI::max(max_slip_resistance, MPI_COMM_WORLD);
+
+  const double relative_error = max_error / max_slip_resistance;
+
+  this->pcout << "Reduced precision storage: " << std::endl
+              << " Maximum relative error = " << relative_error
+              << std::endl
+              << " Memory consumption     = "
+              << reduced_precision_storage.memory_consumption()
+              << " (" << reference_storage.memory_consumption()
+              << ") bytes" << std::endl << std::endl;
+
+  AssertThrow(relative_error < tolerance,
+              dealii::ExcMessage("The relative error of the reduced "
+                                 "precision storage is too large."));
+
+  AssertThrow(reduced_precision_storage.memory_consumption() <
+                reference_storage.memory_consumption(),
+              dealii::ExcMessage("The reduced precision storage does not "
+                                 "consume less memory."));
+}
+
+
+
 template<int dim>
 void QuadraturePointHistory<dim>::output()
 {
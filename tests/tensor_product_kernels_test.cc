@@ -0,0 +1,317 @@
+#include <gCP/tensor_product_kernels.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <cmath>
+
+namespace Tests
+{
+
+
+
+template<int dim>
+class TensorProductKernels
+{
+public:
+
+  TensorProductKernels(const unsigned int fe_degree);
+
+  void run();
+
+private:
+
+  dealii::ConditionalOStream  pcout;
+
+  const dealii::FE_Q<dim>     finite_element;
+
+  const dealii::QGauss<1>     quadrature_1d;
+
+  const dealii::QGauss<dim>   quadrature;
+};
+
+
+
+template<int dim>
+TensorProductKernels<dim>::TensorProductKernels(const unsigned int fe_degree)
+:
+pcout(std::cout,
+      dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0),
+finite_element(fe_degree),
+quadrature_1d(3),
+quadrature(3)
+{}
+
+
+
+template<int dim>
+void TensorProductKernels<dim>::run()
+{
+  const gCP::TensorProductKernels<dim> kernels(finite_element,
+                                               quadrature_1d);
+
+  typename gCP::TensorProductKernels<dim>::Workspace workspace;
+
+  const std::vector<unsigned int> &lexicographic_numbering =
+    kernels.get_lexicographic_numbering();
+
+  const unsigned int dofs_per_cell  = finite_element.n_dofs_per_cell();
+
+  const unsigned int n_q_points     = quadrature.size();
+
+  AssertThrow(kernels.n_dofs_per_cell() == dofs_per_cell,
+              dealii::ExcDimensionMismatch(kernels.n_dofs_per_cell(),
+                                           dofs_per_cell));
+
+  AssertThrow(kernels.n_quadrature_points() == n_q_points,
+              dealii::ExcDimensionMismatch(kernels.n_quadrature_points(),
+                                           n_q_points));
+
+  // Evaluation. The reference cell is used, i.e., the reference
+  // gradients are the gradients of the shape functions
+  std::vector<double> dof_values(dofs_per_cell);
+
+  std::vector<double> lexicographic_dof_values(dofs_per_cell);
+
+  for (unsigned int i = 0; i < dofs_per_cell; ++i)
+  {
+    dof_values[i] = std::sin(1.0 + i);
+
+    lexicographic_dof_values[lexicographic_numbering[i]] = dof_values[i];
+  }
+
+  std::vector<double>                 values(n_q_points);
+
+  std::vector<dealii::Tensor<1,dim>>  gradients(n_q_points);
+
+  kernels.evaluate(dealii::make_array_view(lexicographic_dof_values),
+                   dealii::make_array_view(values),
+                   dealii::make_array_view(gradients),
+                   workspace);
+
+  double max_evaluation_error = 0.0;
+
+  for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+  {
+    double                value = 0.0;
+
+    dealii::Tensor<1,dim> gradient;
+
+    for (unsigned int i = 0; i < dofs_per_cell; ++i)
+    {
+      value += dof_values[i] *
+               finite_element.shape_value(i, quadrature.point(q_point));
+
+      gradient += dof_values[i] *
+                  finite_element.shape_grad(i, quadrature.point(q_point));
+    }
+
+    max_evaluation_error =
+      std::max(max_evaluation_error,
+               std::max(std::abs(value - values[q_point]),
+                        (gradient - gradients[q_point]).norm()));
+  }
+
+  // Integration
+  std::vector<double>                 value_fluxes(n_q_points);
+
+  std::vector<dealii::Tensor<1,dim>>  gradient_fluxes(n_q_points);
+
+  for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+  {
+    value_fluxes[q_point] =
+      std::cos(1.0 + q_point) * quadrature.weight(q_point);
+
+    for (unsigned int d = 0; d < dim; ++d)
+      gradient_fluxes[q_point][d] =
+        std::sin(2.0 + q_point + d) * quadrature.weight(q_point);
+  }
+
+  std::vector<double> lexicographic_integrals(dofs_per_cell, 0.0);
+
+  kernels.integrate(
+    dealii::make_array_view(value_fluxes),
+    dealii::ArrayView<const dealii::Tensor<1,dim>>(gradient_fluxes),
+    dealii::make_array_view(lexicographic_integrals),
+    workspace);
+
+  double max_integration_error = 0.0;
+
+  for (unsigned int i = 0; i < dofs_per_cell; ++i)
+  {
+    double integral = 0.0;
+
+    for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+      integral +=
+        value_fluxes[q_point] *
+        finite_element.shape_value(i, quadrature.point(q_point))
+        +
+        gradient_fluxes[q_point] *
+        finite_element.shape_grad(i, quadrature.point(q_point));
+
+    max_integration_error =
+      std::max(max_integration_error,
+               std::abs(integral -
+                        lexicographic_integrals[lexicographic_numbering[i]]));
+  }
+
+  // Batched evaluation and integration. Each lane holds the values of
+  // another cell, here the ones above scaled by a factor per lane, and
+  // has to reproduce the results of the scalar kernels
+  using VectorizedArrayType = dealii::VectorizedArray<double>;
+
+  const gCP::TensorProductKernels<dim, VectorizedArrayType>
+    batch_kernels(finite_element, quadrature_1d);
+
+  typename gCP::TensorProductKernels<dim, VectorizedArrayType>::Workspace
+    batch_workspace;
+
+  const unsigned int n_lanes = VectorizedArrayType::size();
+
+  dealii::AlignedVector<VectorizedArrayType>
+    batch_dof_values(dofs_per_cell);
+
+  dealii::AlignedVector<VectorizedArrayType>
+    batch_integrals(dofs_per_cell);
+
+  dealii::AlignedVector<VectorizedArrayType>
+    batch_values(n_q_points);
+
+  dealii::AlignedVector<dealii::Tensor<1,dim,VectorizedArrayType>>
+    batch_gradients(n_q_points);
+
+  dealii::AlignedVector<VectorizedArrayType>
+    batch_value_fluxes(n_q_points);
+
+  dealii::AlignedVector<dealii::Tensor<1,dim,VectorizedArrayType>>
+    batch_gradient_fluxes(n_q_points);
+
+  for (unsigned int i = 0; i < dofs_per_cell; ++i)
+  {
+    batch_integrals[i] = 0.0;
+
+    for (unsigned int lane = 0; lane < n_lanes; ++lane)
+      batch_dof_values[i][lane] =
+        (1.0 + lane) * lexicographic_dof_values[i];
+  }
+
+  for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+    for (unsigned int lane = 0; lane < n_lanes; ++lane)
+    {
+      batch_value_fluxes[q_point][lane] =
+        (1.0 + lane) * value_fluxes[q_point];
+
+      for (unsigned int d = 0; d < dim; ++d)
+        batch_gradient_fluxes[q_point][d][lane] =
+          (1.0 + lane) * gradient_fluxes[q_point][d];
+    }
+
+  batch_kernels.evaluate(dealii::make_array_view(batch_dof_values),
+                         dealii::make_array_view(batch_values),
+                         dealii::make_array_view(batch_gradients),
+                         batch_workspace);
+
+  batch_kernels.integrate(dealii::make_array_view(batch_value_fluxes),
+                          dealii::make_array_view(batch_gradient_fluxes),
+                          dealii::make_array_view(batch_integrals),
+                          batch_workspace);
+
+  double max_batch_error = 0.0;
+
+  for (unsigned int lane = 0; lane < n_lanes; ++lane)
+  {
+    for (unsigned int q_point = 0; q_point < n_q_points; ++q_point)
+    {
+      max_batch_error =
+        std::max(max_batch_error,
+                 std::abs(batch_values[q_point][lane] -
+                          (1.0 + lane) * values[q_point]));
+
+      for (unsigned int d = 0; d < dim; ++d)
+        max_batch_error =
+          std::max(max_batch_error,
+                   std::abs(batch_gradients[q_point][d][lane] -
+                            (1.0 + lane) * gradients[q_point][d]));
+    }
+
+    for (unsigned int i = 0; i < dofs_per_cell; ++i)
+      max_batch_error =
+        std::max(max_batch_error,
+                 std::abs(batch_integrals[i][lane] -
+                          (1.0 + lane) * lexicographic_integrals[i]));
+  }
+
+  pcout << finite_element.get_name() << std::endl
+        << "  Maximum evaluation error  = " << max_evaluation_error
+        << std::endl
+        << "  Maximum integration error = " << max_integration_error
+        << std::endl
+        << "  Maximum batch error       = " << max_batch_error
+        << std::endl;
+
+  AssertThrow(max_evaluation_error < 1e-12 &&
+              max_integration_error < 1e-12,
+              dealii::ExcMessage("The sum-factorized kernels do not "
+                                 "match the shape functions of the "
+                                 "finite element."));
+
+  AssertThrow(max_batch_error < 1e-12,
+              dealii::ExcMessage("The batched kernels do not match the "
+                                 "scalar ones lane by lane."));
+}
+
+
+
+} // namespace Tests
+
+
+
+
+int main(int argc, char *argv[])
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(
+      argc, argv, dealii::numbers::invalid_unsigned_int);
+
+    for (unsigned int fe_degree = 1; fe_degree < 4; ++fe_degree)
+    {
+      Tests::TensorProductKernels<2> problem_2d(fe_degree);
+      problem_2d.run();
+
+      Tests::TensorProductKernels<3> problem_3d(fe_degree);
+      problem_3d.run();
+    }
+  }
+  catch (std::exception &exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------"
+              << std::endl;
+    return 1;
+  }
+  return 0;
+}